@@ -7,6 +7,7 @@ Description: Comprehensive sorting algorithm comparison tool with statistical
 analysis and performance metrics for educational and professional demonstration
 purposes. This implementation showcases fundamental sorting algorithms with
 detailed execution analysis.
+Build: g++ -std=c++20 -O2 -pthread "ALGO SORTER BY ARTLEST.cpp"
 ================================================================================
 */
 
@@ -16,14 +17,523 @@ detailed execution analysis.
 #include <chrono>       // High-resolution timing functionality
 #include <iomanip>      // Input/output manipulation for formatting
 #include <random>       // Random number generation capabilities
+#include <cstdint>      // Fixed-width integer types for radix keys
+#include <thread>       // Worker threads for the parallel engines
+#include <mutex>        // Deque and completion synchronisation
+#include <condition_variable>  // Idle worker and fork-join signalling
+#include <atomic>       // Lock-free task counters
+#include <deque>        // Per-worker double-ended task queues
+#include <functional>   // Type-erased task callables, std::identity, ranges::less
+#include <memory>       // Owning pointers for worker queues
+#include <span>         // Non-owning views accepted by the sorting engines
+#include <iterator>     // Iterator concepts and value type traits
+#include <concepts>     // Constraints for key-based engines
+#include <type_traits>  // Key type transformations
+#include <cmath>        // Square roots and powers for statistics
+#include <sstream>      // Duration formatting
+#include <limits>       // Numeric limits for sentinels
+#include <numeric>      // iota for generated key sequences
+#include <array>        // Fixed-size counter tables
+#include <cerrno>       // Error codes of failed system calls
+#include <cstring>      // strerror for counter diagnostics
+#include <bit>          // bit_cast for element fingerprints
+#include <future>       // Completion of background file transfers
+#include <fstream>      // /proc memory statistics
+#include <optional>     // Lazily borrowed scratch buffers
+#include <cstdlib>      // getenv for calibration and configuration paths
+#include <ctime>        // Timestamps of exported results
+#include <regex>        // Algorithm name filters of the run configuration
+#include <charconv>     // to_chars for generated string keys
+#include <coroutine>    // Awaitable front end of the sort service
+#include <queue>        // Deadline-ordered request queues
+#include <filesystem>   // Worst-case corpus directory of the fuzz harness
+#include <map>          // Per-size-class reference times of the fuzz harness
+#include <numbers>      // pi for Box-Muller Gaussian keys
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>         // AVX2 / AVX-512 intrinsics, enabled per function
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>          // NEON intrinsics for the ARM sorting networks
+#endif
+
+#ifdef __linux__
+#include <linux/perf_event.h>  // Hardware performance counter events
+#include <sys/ioctl.h>         // Counter enable/disable requests
+#include <sys/syscall.h>       // perf_event_open has no libc wrapper
+#include <unistd.h>            // read/close on counter descriptors
+#include <linux/mempolicy.h>   // MPOL_LOCAL binding of scratch arena blocks
+#include <sched.h>             // CPU pinning of the main thread and pool workers
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>             // open flags of the external sort files
+#include <sys/mman.h>          // Memory-mapped external sort input
+#include <sys/stat.h>          // Input file sizes
+#include <unistd.h>            // pread/pwrite/fsync for run files
+#include <sys/resource.h>      // getrusage page-fault counters
+#include <sys/utsname.h>       // Kernel name and release for exported results
+#endif
+
+// Build flags recorded in exported results - the build passes them in, e.g.
+// -DSORTER_BUILD_FLAGS="\"-O2 -march=native\""
+#ifndef SORTER_BUILD_FLAGS
+#define SORTER_BUILD_FLAGS "unspecified"
+#endif
+
+// libFuzzer target - replaces main with LLVMFuzzerTestOneInput, e.g.
+// clang++ -std=c++20 -O1 -g -DSORTER_FUZZ_TARGET -fsanitize=fuzzer,address,undefined
 
 using namespace std;
 using namespace std::chrono;
 
 // Global configuration constants for algorithm execution parameters
 const int DATASET_SIZE = 1000;           // Size of data arrays for sorting operations
-const int ALGORITHM_ITERATIONS = 5;      // Number of test iterations per algorithm
+const int ALGORITHM_ITERATIONS = 5;      // Minimum timed iterations per algorithm
+const int MAXIMUM_ALGORITHM_ITERATIONS = 200; // Cap on adaptive repetitions
+const int WARMUP_ITERATIONS = 2;         // Untimed runs before measurement starts
+const double TARGET_RELATIVE_CONFIDENCE = 0.02;  // Stop once 95% CI half-width <= 2% of mean
+const double MEASUREMENT_TIME_BUDGET_SECONDS = 2.0;  // Stop repeating after this much timed work
+const double CONFIDENCE_Z_SCORE = 1.96;  // Two-sided 95% normal quantile
+const double OUTLIER_MODIFIED_Z_THRESHOLD = 3.5;  // Modified z-score marking a sample as outlier
 const int PROGRESS_BAR_WIDTH = 50;       // Width of console progress indicators
+const size_t PROGRESS_EVENT_RING_CAPACITY = 256;  // Progress events buffered for the reporter thread
+const int PROGRESS_RENDER_INTERVAL_MILLISECONDS = 100;  // Minimum gap between two bar redraws
+const int PROGRESS_POLL_INTERVAL_MILLISECONDS = 10;     // Reporter wake-up period while draining
+const int SMALL_PARTITION_THRESHOLD = 16; // Range size handed over to insertion sort
+const int SIMD_NETWORK_MAXIMUM_SIZE = 64; // Largest range sorted by one SIMD sorting network
+const uint64_t DATASET_SEED = 0x5EED2024u; // Base seed of every generated input
+const int INPUT_POOL_VARIANTS = 4;       // Distinct pre-generated inputs per pool
+const bool ENABLE_HARDWARE_COUNTERS = true;  // Record perf_event counters around timed runs when permitted
+const bool ENABLE_SCRATCH_HUGE_PAGES = true;  // Back scratch arenas with huge pages when the system allows
+const size_t SCRATCH_ARENA_ALIGNMENT = 64;   // Cache-line alignment of every scratch borrow
+const size_t SCRATCH_ARENA_MINIMUM_BYTES = size_t(2) << 20;  // Smallest arena block (one 2 MB huge page)
+
+// Natural-run merging and adaptive dispatch
+const ptrdiff_t POWERSORT_MINIMUM_RUN = 32;              // Short natural runs are extended to this length
+const int MERGE_GALLOP_THRESHOLD = 7;                    // Consecutive wins by one run before a merge gallops
+const int64_t STABILITY_CHECK_KEY_CARDINALITY = 61;      // Distinct keys of the tagged stability input (many ties)
+const size_t ADAPTIVE_INSERTION_MAXIMUM_SIZE = 24;       // Largest N the dispatcher hands to insertion sort
+const size_t ADAPTIVE_RADIX_MINIMUM_SIZE = 256;          // Smallest N the dispatcher hands to radix sort
+const double ADAPTIVE_RUN_MERGE_WINDOW_RATIO = 0.75;     // Monotone sample windows that trigger run merging
+const size_t ADAPTIVE_SAMPLE_WINDOWS = 16;               // Presortedness sample windows
+const size_t ADAPTIVE_SAMPLE_WINDOW_PAIRS = 16;          // Adjacent pairs compared per window
+const size_t ADAPTIVE_SAMPLE_KEYS = 32;                  // Strided keys sampled for duplicates and range
+const size_t ADAPTIVE_DECISION_LOG_CAPACITY = 4096;      // Recent decisions kept for the audit report
+
+// Cache-blocked merge sort and bandwidth reporting
+const size_t CACHE_FALLBACK_L1D_BYTES = size_t(32) << 10;  // Assumed cache sizes when detection fails
+const size_t CACHE_FALLBACK_L2_BYTES = size_t(1) << 20;
+const size_t CACHE_FALLBACK_L3_BYTES = size_t(8) << 20;
+const size_t BLOCKED_MERGE_MAXIMUM_FAN_IN = 64;          // Widest loser tree (6 matches per element)
+const size_t BLOCKED_MERGE_STAGING_BYTES = 4096;         // L1-resident staging before non-temporal flushes
+const size_t BANDWIDTH_PROBE_MINIMUM_BYTES = size_t(64) << 20;  // Copy-ceiling probe size (at least 4x L3)
+
+// Key transforms and key-type coverage
+const size_t SHORT_STRING_CAPACITY = 31;                 // Bytes of text held by a short string element
+const size_t STRING_PREFIX_BYTES = sizeof(uint64_t);     // Leading bytes packed into a string's radix key
+const int SHORT_STRING_KEY_UNIVERSE = 1000000000;        // Generated string keys are decimal numbers below this
+const int FLOAT_SPECIAL_VALUE_PERIOD = 16;               // Every n-th generated float is NaN, +-0, +-inf or denormal
+const int KEY_TRANSFORM_BENCHMARK_SIZE = 1 << 20;        // Elements per key type in the key transform report
+
+// Radix sort digit configuration
+const int RADIX_DIGIT_BITS = 8;                          // Bits consumed per distribution pass
+const int RADIX_BUCKET_COUNT = 1 << RADIX_DIGIT_BITS;    // Histogram buckets per digit
+const uint32_t RADIX_DIGIT_MASK = RADIX_BUCKET_COUNT - 1; // Mask isolating one digit
+const int MSD_RADIX_INSERTION_THRESHOLD = 64;            // Bucket size finished by insertion sort
+
+// Counting sort configuration
+const size_t COUNTING_SORT_HISTOGRAM_BYTES = 256 << 10;  // Largest per-thread histogram (fits in L2)
+const size_t COUNTING_SORT_MAXIMUM_RANGE_RATIO = 4;      // Adaptive dispatch: sampled key range may exceed N by at most this factor
+
+// Indirect sorting
+const size_t INDIRECT_GATHER_BLOCK_BYTES = 16 << 10;     // Output bytes per prefetched gather block (half an L1D)
+const size_t INDIRECT_BENCHMARK_SIZE = 1 << 17;          // Records per run of the record-size benchmark
+
+// Parallel engine configuration
+const int PARALLEL_SEQUENTIAL_CUTOFF = 1 << 15;          // Range size sorted by a single task
+const int PARALLEL_MERGE_GRAIN = 1 << 16;                // Output elements per merge-path slice
+const int PARALLEL_SCALING_DATASET_SIZE = 1 << 22;       // Elements used by the scaling analysis
+const unsigned PARALLEL_MAXIMUM_THREADS_PER_CPU = 4;     // --threads may oversubscribe the CPUs at most this much
+
+// NUMA-aware sample sort
+const int NUMA_MAXIMUM_NODES = 64;                       // Highest node number probed in sysfs
+const size_t NUMA_SPLITTER_OVERSAMPLING = 64;            // Samples per partition in the splitter round
+const size_t NUMA_PAGE_SAMPLE_COUNT = 256;               // Pages queried per partition for placement checks
+
+// Output validation
+const size_t PARALLEL_VALIDATION_THRESHOLD = 1 << 20;    // Outputs at least this long are validated in parallel
+const size_t PARALLEL_VALIDATION_GRAIN = 1 << 18;        // Elements checked per validation task
+
+// Small-array kernel analysis
+const int SMALL_KERNEL_BATCH_ELEMENTS = 1 << 16;         // Keys per batch of independent small arrays
+const int SIMD_PARTITION_BENCHMARK_SIZE = 1 << 20;       // Keys partitioned by the partition benchmark
+
+// Segmented batch sorting
+const size_t CSR_BATCH_MAXIMUM_NETWORK_SIZE = 256;       // Longest segment sorted by a vertical network
+const size_t SIMD_VERTICAL_MAXIMUM_LANES = 16;           // Widest segment group (one AVX-512 register)
+const size_t CSR_BATCH_TASK_ELEMENTS = 1 << 15;          // Minimum keys per batch task
+const size_t CSR_BATCH_BENCHMARK_ELEMENTS = 1 << 20;     // Keys per batch in the batch benchmark
+
+// Async sort service and its load generator
+const size_t ASYNC_SORT_BATCH_REQUEST_ELEMENTS = CSR_BATCH_MAXIMUM_NETWORK_SIZE;  // Requests this small are coalesced into batch tasks
+const size_t ASYNC_SORT_BATCH_MAXIMUM_REQUESTS = 512;    // Requests coalesced into one batch task, at most
+const size_t ASYNC_SORT_SPLIT_ELEMENTS = 1 << 17;        // Requests above this are split across the pool
+const size_t ASYNC_SORT_TASKS_PER_WORKER = 2;            // In-flight tasks per worker; the rest wait in EDF order
+const int ASYNC_SORT_DEFAULT_DEADLINE_MICROSECONDS = 10000;  // Deadline of requests that name none
+const size_t ASYNC_LOAD_REQUESTS_PER_RATE = 2000;        // Requests issued per offered rate
+constexpr double ASYNC_LOAD_DEFAULT_RATES[] = {1000, 4000, 16000, 64000};  // Offered requests per second
+const int ASYNC_LOAD_DEADLINE_BASE_MICROSECONDS = 1000;  // Deadline slack of every generated request
+const double ASYNC_LOAD_DEADLINE_NANOSECONDS_PER_KEY = 100.0;  // Extra slack per requested key
+
+// Differential fuzzing
+const size_t FUZZ_MAXIMUM_ELEMENTS = 4096;               // Elements decoded from one fuzz input, at most
+const size_t FUZZ_MAXIMUM_INPUT_BYTES = 1 << 16;         // Longest input the fuzz campaign generates
+const size_t FUZZ_STRING_CHUNK_BYTES = 12;               // Input bytes per decoded string (length + 11 characters)
+const size_t FUZZ_SEED_ELEMENTS = 2048;                  // Keys per distribution seed input
+const int FUZZ_DEFAULT_ITERATIONS = 2000;                // Inputs tried by one fuzz campaign
+const int FUZZ_MAXIMUM_MUTATIONS = 8;                    // Edits applied to a seed per generated input
+const int FUZZ_REFERENCE_REPETITIONS = 3;                // Runs behind each cached reference time (fastest kept)
+const double FUZZ_SLOWDOWN_FACTOR = 8.0;                 // Slowdown over the reference flagged as an anomaly
+const double FUZZ_MINIMUM_ANOMALY_NANOSECONDS = 200000.0;  // Shorter runs are never flagged as slow (timer noise)
+const char* const FUZZ_DEFAULT_CORPUS_DIRECTORY = "fuzz_worst_cases";  // Where worst-case inputs are kept
+
+// Scaling sweep defaults
+const size_t SWEEP_MINIMUM_SIZE = 16;                    // First swept dataset size
+const size_t SWEEP_MAXIMUM_SIZE = 100000000;             // Last swept dataset size
+const double SWEEP_GROWTH_FACTOR = 4.0;                  // Ratio between consecutive sizes
+const double SWEEP_CELL_TIME_BUDGET_SECONDS = 1.0;       // Median run time that retires an engine
+const size_t SWEEP_FIT_MINIMUM_SIZE = 256;               // Smallest N used for exponent fits
+const double SWEEP_CROSSOVER_MARGIN = 0.10;              // Relative gap required on both sides of a crossover
+
+// Input distribution shapes
+const size_t DISTRIBUTION_K_SORTED_DISPLACEMENT = 16;    // Window each k-sorted element is shuffled within
+const int DISTRIBUTION_FEW_UNIQUE_VALUES = 8;            // Distinct keys of the few-unique input
+const int DISTRIBUTION_ZIPF_UNIVERSE = 10000;            // Ranks a Zipf key is drawn from
+const double DISTRIBUTION_ZIPF_EXPONENT = 1.0;           // Zipf skew parameter s
+const double DISTRIBUTION_GAUSSIAN_DEVIATION = 1 << 20;  // Standard deviation of Gaussian keys
+const double DISTRIBUTION_MATRIX_TIME_BUDGET_SECONDS = 0.5;  // Per-cell budget of the matrix run
+
+// Counter-based dataset generation
+const size_t DATASET_GENERATION_GRAIN = 1 << 16;         // Elements generated per pool task
+const uint64_t COUNTER_DRAWS_PER_ELEMENT = 4;            // Counter values reserved for each generated element
+const size_t GENERATION_BENCHMARK_SIZE = 1 << 24;        // Keys produced per generator by the generation report
+
+// Recorded datasets
+const char DATASET_FILE_MAGIC[] = "SORTKEYS";            // First 8 bytes of every dataset file
+const uint32_t DATASET_FORMAT_VERSION = 1;               // Bumped when the file layout changes
+const size_t DATASET_PAYLOAD_ALIGNMENT = 4096;           // Payload offset alignment (one page)
+const size_t DATASET_DEFAULT_CHUNK_KEYS = 1 << 20;       // Keys per chunk index entry written by convert-dataset
+const size_t DATASET_COLUMN_LABEL_CHARACTERS = 9;        // Matrix column label length of a recorded dataset
+
+// Streaming engine tiers and query benchmark
+const size_t STREAMING_COMPACTION_RATIO = 1;            // Merge when the previous run is at most this many times larger
+const size_t STREAMING_BENCHMARK_SIZE = 1 << 20;        // Elements streamed per benchmark pass
+const size_t STREAMING_BATCH_SIZE = 1 << 12;            // Elements per appended batch
+const size_t STREAMING_QUERY_K = 100;                   // k of the top-k / partial-sort queries
+
+// External merge sort sizing
+const size_t EXTERNAL_RUN_BYTES = size_t(64) << 20;         // Keys sorted in memory per run (64 MiB)
+const size_t EXTERNAL_MERGE_BLOCK_BYTES = size_t(1) << 20;  // Largest per-run read block while merging
+const size_t EXTERNAL_MINIMUM_BLOCK_BYTES = size_t(64) << 10;  // Smallest block kept efficient for the disk
+
+// Result export and baseline comparison
+const int RESULT_EXPORT_FORMAT_VERSION = 1;               // Bumped when the JSON layout changes
+const double REGRESSION_MINIMUM_SLOWDOWN = 0.05;          // Median slowdowns below this are never flagged
+const double REGRESSION_Z_SCORE = 1.645;                  // One-sided 95% normal quantile of the Welch test
+
+// Report identifiers of the standard library reference implementations
+constexpr const char* STD_SORT_REFERENCE_NAME = "std::sort";
+constexpr const char* STD_STABLE_SORT_REFERENCE_NAME = "std::stable_sort";
+
+/*
+================================================================================
+RUN CONFIGURATION - Runtime experiment settings from SORTER_* variables and flags
+================================================================================
+*/
+
+// Structure: benchmark_run_configuration
+// Purpose: Everything an experiment varies without a rebuild. Defaults are the
+//          compile-time constants above; SORTER_* environment variables override
+//          them and command-line flags override the environment.
+struct benchmark_run_configuration {
+    vector<size_t> dataset_sizes = {DATASET_SIZE};                  // --sizes: N of every suite and matrix
+    int warmup_iterations = WARMUP_ITERATIONS;                      // --warmup
+    int minimum_iterations = ALGORITHM_ITERATIONS;                  // --repetitions MIN[..MAX]
+    int maximum_iterations = MAXIMUM_ALGORITHM_ITERATIONS;
+    double target_relative_confidence = TARGET_RELATIVE_CONFIDENCE; // --confidence PCT
+    double time_budget_seconds = MEASUREMENT_TIME_BUDGET_SECONDS;   // --budget SECONDS
+    string algorithm_pattern;         // --algorithms: case-insensitive regex searched in engine names
+    regex algorithm_filter;           // Compiled algorithm_pattern
+    vector<string> dataset_paths;     // --datasets: recorded dataset files, added to the distributions
+    vector<string> distribution_labels;  // --distributions: column labels, first one feeds the suites
+    vector<string> element_labels;    // --types: element type labels
+    vector<string> report_sections;   // --reports: default-run sections
+    unsigned thread_count = 0;        // --threads: shared pool workers, 0 = hardware concurrency
+    bool pin_threads = false;         // --pin: bind the main thread and pool workers to CPUs
+    uint64_t dataset_seed = DATASET_SEED;          // --seed: base seed of every generated input
+    int progress_bar_width = PROGRESS_BAR_WIDTH;   // --progress-width: 0 hides the bars
+    size_t merge_block_bytes = 0;     // --block-bytes: blocked merge sort block, 0 = half of L2
+    size_t merge_fan_in = 0;          // --fan-in: runs per multiway merge, 0 = derived from L3
+
+    // Function: selects_algorithm
+    // Returns: true when the algorithm filter is empty or matches the engine name
+    bool selects_algorithm(const string& algorithm_name) const {
+        return algorithm_pattern.empty() || regex_search(algorithm_name, algorithm_filter);
+    }
+
+    // Function: selects_label
+    // Returns: true when a label list is empty (everything selected) or contains the label
+    static bool selects_label(const vector<string>& selected_labels, const string& candidate_label) {
+        return selected_labels.empty() ||
+               find(selected_labels.begin(), selected_labels.end(), candidate_label) != selected_labels.end();
+    }
+
+    bool selects_distribution(const string& column_label) const { return selects_label(distribution_labels, column_label); }
+    bool selects_element(const string& element_label) const { return selects_label(element_labels, element_label); }
+    bool selects_report(const string& section_name) const { return selects_label(report_sections, section_name); }
+
+    // Function: resolved_thread_count
+    // Returns: configured worker count, or the hardware concurrency when unset
+    unsigned resolved_thread_count() const {
+        return thread_count != 0 ? thread_count : max(1u, thread::hardware_concurrency());
+    }
+};
+
+// Function: active_run_configuration
+// Purpose: Process-wide configuration, written once by main before anything runs
+// Returns: mutable reference
+benchmark_run_configuration& active_run_configuration() {
+    static benchmark_run_configuration process_configuration;
+    return process_configuration;
+}
+
+// Function: pin_calling_thread
+// Purpose: Binds the calling thread to one CPU of the process affinity mask, round-robin
+// Parameters: pin_slot - logical slot (0 = first allowed CPU)
+// Returns: false when pinning is unsupported or refused
+bool pin_calling_thread(unsigned pin_slot) {
+#if defined(__linux__)
+    cpu_set_t allowed_cpus;
+    if (sched_getaffinity(0, sizeof(allowed_cpus), &allowed_cpus) != 0 || CPU_COUNT(&allowed_cpus) == 0) {
+        return false;
+    }
+    unsigned target_slot = pin_slot % static_cast<unsigned>(CPU_COUNT(&allowed_cpus));
+    for (int cpu_index = 0; cpu_index < CPU_SETSIZE; cpu_index++) {
+        if (CPU_ISSET(cpu_index, &allowed_cpus) && target_slot-- == 0) {
+            cpu_set_t pinned_cpu;
+            CPU_ZERO(&pinned_cpu);
+            CPU_SET(cpu_index, &pinned_cpu);
+            return sched_setaffinity(0, sizeof(pinned_cpu), &pinned_cpu) == 0;
+        }
+    }
+    return false;
+#else
+    (void)pin_slot;
+    return false;
+#endif
+}
+
+/*
+================================================================================
+ELEMENT TYPES AND COMPARATORS - Key types exercised by the generic engines
+================================================================================
+*/
+
+// Structure: benchmark_record
+// Purpose: 16-byte record with an embedded 64-bit sort key and opaque payload
+struct benchmark_record {
+    int64_t sort_key;   // Key the engines order by
+    int64_t payload;    // Data travelling with the key
+};
+
+// Structure: benchmark_element_traits
+// Purpose: Per-type key projection and element construction used by the benchmark
+template <typename Element>
+struct benchmark_element_traits {
+    static constexpr identity key_projection{};  // Scalars are their own key
+
+    // Function: make_element
+    // Purpose: Builds an element whose key equals key_value
+    static Element make_element(int64_t key_value, int64_t /*element_index*/) {
+        return static_cast<Element>(key_value);
+    }
+};
+
+template <>
+struct benchmark_element_traits<benchmark_record> {
+    static constexpr auto key_projection = &benchmark_record::sort_key;  // Sort by embedded key
+
+    static benchmark_record make_element(int64_t key_value, int64_t element_index) {
+        return benchmark_record{key_value, element_index};
+    }
+};
+
+// Structure: short_string_record
+// Purpose: Inline string of at most SHORT_STRING_CAPACITY bytes, ordered lexicographically
+struct short_string_record {
+    char text_bytes[SHORT_STRING_CAPACITY];  // Text, not NUL-terminated
+    uint8_t text_length;                     // Bytes of text in use
+
+    string_view text_view() const { return string_view(text_bytes, text_length); }
+};
+
+template <>
+struct benchmark_element_traits<short_string_record> {
+    static constexpr auto key_projection = &short_string_record::text_view;  // Sort by the full text
+
+    // Keys become "key:<decimal>", so nearby keys share the packed 8-byte prefix
+    static short_string_record make_element(int64_t key_value, int64_t /*element_index*/) {
+        short_string_record string_element{};
+        constexpr string_view key_label = "key:";
+        copy(key_label.begin(), key_label.end(), string_element.text_bytes);
+        char* text_end = to_chars(string_element.text_bytes + key_label.size(),
+                                  string_element.text_bytes + SHORT_STRING_CAPACITY, key_value).ptr;
+        string_element.text_length = static_cast<uint8_t>(text_end - string_element.text_bytes);
+        return string_element;
+    }
+};
+
+// Function: element_type_label
+// Purpose: Human-readable name of a benchmarked element type
+// Returns: label used in report headings
+template <typename Element>
+const char* element_type_label() {
+    if constexpr (is_same_v<Element, int32_t>) {
+        return "int32";
+    } else if constexpr (is_same_v<Element, int64_t>) {
+        return "int64";
+    } else if constexpr (is_same_v<Element, uint64_t>) {
+        return "uint64";
+    } else if constexpr (is_same_v<Element, double>) {
+        return "double";
+    } else if constexpr (is_same_v<Element, float>) {
+        return "float";
+    } else if constexpr (is_same_v<Element, short_string_record>) {
+        return "string";
+    } else {
+        return "record16";
+    }
+}
+
+// Structure: ordered_key_transform
+// Purpose: Compile-time map from a key type onto an unsigned integer whose natural
+//          order is the key order, so the radix and SIMD engines can sort the key
+//          without calling a comparator. Exact transforms are bijective; inexact ones
+//          (string prefixes) only guarantee a < b whenever apply(a) < apply(b), and
+//          equal transformed keys still need the full comparison.
+template <typename Key>
+struct ordered_key_transform;
+
+// Signed integers flip the sign bit so negative values order first
+template <integral Key>
+struct ordered_key_transform<Key> {
+    using ordered_type = make_unsigned_t<Key>;
+    static constexpr bool is_exact = true;
+
+    static constexpr ordered_type apply(Key key_value) {
+        ordered_type ordered_key = static_cast<ordered_type>(key_value);
+        if constexpr (is_signed_v<Key>) {
+            ordered_key ^= ordered_type(1) << (sizeof(Key) * 8 - 1);
+        }
+        return ordered_key;
+    }
+
+    static constexpr Key restore(ordered_type ordered_key) {
+        if constexpr (is_signed_v<Key>) {
+            ordered_key ^= ordered_type(1) << (sizeof(Key) * 8 - 1);
+        }
+        return static_cast<Key>(ordered_key);
+    }
+};
+
+// IEEE floats follow totalOrder: negatives have every bit flipped, non-negatives only
+// the sign bit, giving -NaN < -inf < ... < -0.0 < +0.0 < ... < +inf < +NaN
+template <floating_point Key>
+    requires (numeric_limits<Key>::is_iec559 && (sizeof(Key) == sizeof(uint32_t) || sizeof(Key) == sizeof(uint64_t)))
+struct ordered_key_transform<Key> {
+    using ordered_type = conditional_t<sizeof(Key) == sizeof(uint32_t), uint32_t, uint64_t>;
+    static constexpr bool is_exact = true;
+    static constexpr ordered_type sign_bit = ordered_type(1) << (sizeof(Key) * 8 - 1);
+
+    static constexpr ordered_type apply(Key key_value) {
+        ordered_type key_bits = bit_cast<ordered_type>(key_value);
+        ordered_type flip_mask = ordered_type(0) - (key_bits >> (sizeof(Key) * 8 - 1));  // All ones for negatives
+        return key_bits ^ (flip_mask | sign_bit);
+    }
+
+    static constexpr Key restore(ordered_type ordered_key) {
+        ordered_type flip_mask = (ordered_key & sign_bit) ? sign_bit : ~ordered_type(0);
+        return bit_cast<Key>(ordered_key ^ flip_mask);
+    }
+};
+
+// Strings pack their first STRING_PREFIX_BYTES bytes big-endian, zero padded; bytes
+// compare unsigned, matching char_traits<char>::compare
+template <>
+struct ordered_key_transform<string_view> {
+    using ordered_type = uint64_t;
+    static constexpr bool is_exact = false;
+
+    static ordered_type apply(string_view key_value) {
+        uint64_t packed_prefix = 0;
+        if (key_value.size() >= STRING_PREFIX_BYTES) {
+            memcpy(&packed_prefix, key_value.data(), STRING_PREFIX_BYTES);
+            if constexpr (endian::native == endian::little) {
+                packed_prefix = __builtin_bswap64(packed_prefix);
+            }
+            return packed_prefix;
+        }
+        for (size_t byte_index = 0; byte_index < key_value.size(); byte_index++) {
+            packed_prefix |= uint64_t(static_cast<unsigned char>(key_value[byte_index])) << (56 - 8 * byte_index);
+        }
+        return packed_prefix;
+    }
+};
+
+// Concept: ordered_key_transformable
+// Purpose: Key types with an ordered_key_transform specialization
+template <typename Key>
+concept ordered_key_transformable = requires(const Key& key_value) {
+    typename ordered_key_transform<Key>::ordered_type;
+    { ordered_key_transform<Key>::apply(key_value) } -> same_as<typename ordered_key_transform<Key>::ordered_type>;
+};
+
+// Structure: ordered_key_less
+// Purpose: Comparator ordering keys by their transform - a total order for floats (NaN
+//          included), falling back to operator< between equal inexact prefixes
+struct ordered_key_less {
+    template <ordered_key_transformable Key>
+    bool operator()(const Key& left_key, const Key& right_key) const {
+        auto left_ordered = ordered_key_transform<Key>::apply(left_key);
+        auto right_ordered = ordered_key_transform<Key>::apply(right_key);
+        if constexpr (ordered_key_transform<Key>::is_exact) {
+            return left_ordered < right_ordered;
+        } else {
+            return left_ordered != right_ordered ? left_ordered < right_ordered : left_key < right_key;
+        }
+    }
+};
+
+// Structure: projected_comparator
+// Purpose: Folds a comparator and a key projection into one element comparator,
+//          so engines call less_than(a, b) and the compiler inlines both parts
+template <typename Compare, typename Projection>
+struct projected_comparator {
+    Compare comparator;     // Ordering applied to projected keys
+    Projection projection;  // Extracts the key from an element
+
+    template <typename LeftElement, typename RightElement>
+    bool operator()(const LeftElement& left_element, const RightElement& right_element) const {
+        return invoke(comparator, invoke(projection, left_element), invoke(projection, right_element));
+    }
+};
+
+// Function: make_element_comparator
+// Purpose: Convenience constructor for projected_comparator
+template <typename Compare, typename Projection>
+projected_comparator<Compare, Projection> make_element_comparator(Compare comparator, Projection projection) {
+    return projected_comparator<Compare, Projection>{comparator, projection};
+}
 
 /*
 ================================================================================
@@ -31,65 +541,575 @@ UTILITY FUNCTIONS - Core helper methods for program operations
 ================================================================================
 */
 
-// Function: display_progress_indicator
+// Function: format_progress_indicator
 // Purpose: Renders visual progress bar for algorithm execution tracking
-// Parameters: current_step - present iteration number, total_steps - maximum iterations
-void display_progress_indicator(int current_step, int total_steps) {
+// Parameters: current_step - present iteration number, total_steps - projected iterations,
+//             progress_bar_width - bar segments, last_sample_nanoseconds - latest timing
+// Returns: one console line ending in a carriage return
+string format_progress_indicator(int current_step, int total_steps, int progress_bar_width,
+                                 double last_sample_nanoseconds) {
     // Calculate completion percentage for progress visualization
-    double completion_percentage = static_cast<double>(current_step) / total_steps;
-    int filled_segments = static_cast<int>(completion_percentage * PROGRESS_BAR_WIDTH);
-    
+    double completion_percentage = total_steps > 0 ? static_cast<double>(current_step) / total_steps : 0.0;
+    int filled_segments = static_cast<int>(completion_percentage * progress_bar_width);
+
     // Output progress bar with completion indicators
-    cout << "[";
-    for (int segment_index = 0; segment_index < PROGRESS_BAR_WIDTH; segment_index++) {
+    ostringstream progress_line;
+    progress_line << "[";
+    for (int segment_index = 0; segment_index < progress_bar_width; segment_index++) {
         // Determine whether current segment should be filled or empty
         if (segment_index < filled_segments) {
-            cout << "█";  // Filled progress segment
+            progress_line << "█";  // Filled progress segment
         } else {
-            cout << "░";  // Empty progress segment
+            progress_line << "░";  // Empty progress segment
         }
     }
-    // Display numerical progress percentage
-    cout << "] " << setprecision(1) << fixed << (completion_percentage * 100) << "%\r";
-    cout.flush();  // Force immediate output buffer flush
+    // Display numerical progress percentage and the latest sample
+    progress_line << "] " << setprecision(1) << fixed << (completion_percentage * 100) << "% "
+                  << current_step << "/" << total_steps << "  last " << setprecision(3)
+                  << last_sample_nanoseconds / 1e6 << " ms   \r";
+    return progress_line.str();
 }
 
-// Function: generate_random_dataset
-// Purpose: Creates pseudo-random integer array for algorithm testing
-// Parameters: dataset_size - number of elements to generate
-// Returns: vector containing randomly distributed integers
-vector<int> generate_random_dataset(int dataset_size) {
-    vector<int> data_container;  // Initialize dynamic array container
-    data_container.reserve(dataset_size);  // Pre-allocate memory for efficiency
-    
-    // Initialize random number generator with time-based seed
-    random_device entropy_source;
-    mt19937 generator_engine(entropy_source());
-    uniform_int_distribution<int> distribution_range(1, 10000);
-    
-    // Populate container with randomly generated values
-    for (int element_index = 0; element_index < dataset_size; element_index++) {
-        data_container.push_back(distribution_range(generator_engine));
+// Class: spsc_event_ring
+// Purpose: Bounded lock-free queue between exactly one producer and one consumer thread.
+//          Each cursor is written by one side only and lives on its own cache line; the
+//          producer caches the consumer cursor so a push normally touches no shared line.
+template <typename Event, size_t Capacity>
+class spsc_event_ring {
+    static_assert(has_single_bit(Capacity), "ring capacity must be a power of two");
+
+public:
+    // Function: try_push
+    // Purpose: Appends an event without waiting (producer thread only)
+    // Returns: false when the ring is full and the event was not stored
+    bool try_push(const Event& event) {
+        size_t write_index = write_cursor.load(memory_order_relaxed);
+        if (write_index - cached_read_cursor == Capacity) {
+            cached_read_cursor = read_cursor.load(memory_order_acquire);
+            if (write_index - cached_read_cursor == Capacity) {
+                return false;
+            }
+        }
+        ring_slots[write_index & (Capacity - 1)] = event;
+        write_cursor.store(write_index + 1, memory_order_release);
+        return true;
     }
-    
-    return data_container;  // Return populated dataset
+
+    // Function: try_pop
+    // Purpose: Removes the oldest event (consumer thread only)
+    // Returns: false when the ring is empty
+    bool try_pop(Event& event) {
+        size_t read_index = read_cursor.load(memory_order_relaxed);
+        if (read_index == write_cursor.load(memory_order_acquire)) {
+            return false;
+        }
+        event = ring_slots[read_index & (Capacity - 1)];
+        read_cursor.store(read_index + 1, memory_order_release);
+        return true;
+    }
+
+private:
+    array<Event, Capacity> ring_slots{};
+    alignas(64) atomic<size_t> write_cursor{0};
+    size_t cached_read_cursor = 0;            // Producer-private copy of read_cursor
+    alignas(64) atomic<size_t> read_cursor{0};
+};
+
+// Enumeration: progress_event_kind
+// Purpose: Telemetry published by the benchmark thread
+enum class progress_event_kind : uint8_t {
+    phase_started,     // A measured phase begins; the bar restarts
+    iteration_done,    // One timed repetition finished
+    phase_finished     // The phase ended; the final bar must be on screen
+};
+
+// Structure: progress_event
+// Purpose: Fixed-size ring entry - no strings, so publishing never allocates
+struct progress_event {
+    progress_event_kind event_kind = progress_event_kind::iteration_done;
+    int completed_steps = 0;               // Repetitions finished in this phase
+    int total_steps = 0;                   // Projected repetitions of this phase
+    double last_sample_nanoseconds = 0.0;  // Duration of the latest repetition
+};
+
+// Class: background_progress_reporter
+// Purpose: Owns the console progress bar. The benchmark thread only pushes events into
+//          an SPSC ring; a reporter thread drains it and redraws at most once per render
+//          interval. Rendering is off when stdout is not a terminal or bars are disabled,
+//          in which case no thread is started and every call returns at once.
+class background_progress_reporter {
+public:
+    background_progress_reporter() {
+        rendering_enabled = active_run_configuration().progress_bar_width > 0 && standard_output_is_terminal();
+    }
+
+    ~background_progress_reporter() {
+        if (reporter_thread.joinable()) {
+            stop_requested.store(true, memory_order_release);
+            reporter_thread.join();
+        }
+    }
+
+    background_progress_reporter(const background_progress_reporter&) = delete;
+    background_progress_reporter& operator=(const background_progress_reporter&) = delete;
+
+    // Function: begin_phase
+    // Purpose: Announces a measured phase; starts the reporter thread on first use
+    // Parameters: total_steps - initially projected repetitions
+    void begin_phase(int total_steps) {
+        if (!rendering_enabled) {
+            return;
+        }
+        if (!reporter_thread.joinable()) {
+            reporter_thread = thread([this] { run_reporter_loop(); });
+        }
+        publish_reliably({progress_event_kind::phase_started, 0, total_steps, 0.0});
+    }
+
+    // Function: report_iteration
+    // Purpose: Publishes one finished repetition; never blocks - when the ring is full
+    //          the event is dropped, which only skips an intermediate frame
+    // Parameters: completed_steps/total_steps - progress, last_sample_nanoseconds - timing
+    void report_iteration(int completed_steps, int total_steps, double last_sample_nanoseconds) {
+        if (rendering_enabled &&
+            !event_ring.try_push({progress_event_kind::iteration_done, completed_steps, total_steps,
+                                  last_sample_nanoseconds})) {
+            dropped_events.fetch_add(1, memory_order_relaxed);
+        }
+    }
+
+    // Function: finish_phase
+    // Purpose: Publishes the phase end and waits until its final frame is drawn, so
+    //          console output that follows cannot interleave with the bar. Called after
+    //          the last timed repetition, never inside a measurement.
+    void finish_phase() {
+        if (!rendering_enabled) {
+            return;
+        }
+        publish_reliably({progress_event_kind::phase_finished, 0, 0, 0.0});
+        published_phase_ends++;
+        unique_lock<mutex> phase_lock(phase_mutex);
+        phase_finished_signal.wait(phase_lock, [this] { return rendered_phase_ends == published_phase_ends; });
+    }
+
+    // Function: dropped_event_count
+    // Returns: iteration events discarded because the ring was full
+    size_t dropped_event_count() const { return dropped_events.load(memory_order_relaxed); }
+
+    // Function: standard_output_is_terminal
+    // Returns: whether carriage-return redraws would reach an interactive console
+    static bool standard_output_is_terminal() {
+#if defined(__unix__) || defined(__APPLE__)
+        return isatty(STDOUT_FILENO) == 1;
+#else
+        return true;
+#endif
+    }
+
+private:
+    // Function: publish_reliably
+    // Purpose: Phase boundaries must not be lost; yields until the reporter makes room
+    void publish_reliably(const progress_event& event) {
+        while (!event_ring.try_push(event)) {
+            this_thread::yield();
+        }
+    }
+
+    // Function: run_reporter_loop
+    // Purpose: Drains events, keeps only the latest state and redraws rate-limited
+    void run_reporter_loop() {
+        progress_event latest_state;
+        bool frame_pending = false;
+        auto last_render = steady_clock::now() - milliseconds(PROGRESS_RENDER_INTERVAL_MILLISECONDS);
+
+        while (true) {
+            progress_event event;
+            bool drained_any = false;
+            while (event_ring.try_pop(event)) {
+                drained_any = true;
+                if (event.event_kind == progress_event_kind::phase_finished) {
+                    // Final frame is drawn immediately regardless of the rate limit
+                    if (frame_pending) {
+                        render_frame(latest_state);
+                    }
+                    frame_pending = false;
+                    {
+                        lock_guard<mutex> phase_lock(phase_mutex);
+                        rendered_phase_ends++;
+                    }
+                    phase_finished_signal.notify_one();
+                    continue;
+                }
+                latest_state = event;
+                frame_pending = true;
+            }
+
+            auto current_time = steady_clock::now();
+            if (frame_pending && current_time - last_render >= milliseconds(PROGRESS_RENDER_INTERVAL_MILLISECONDS)) {
+                render_frame(latest_state);
+                frame_pending = false;
+                last_render = current_time;
+            }
+            if (!drained_any && stop_requested.load(memory_order_acquire)) {
+                return;
+            }
+            this_thread::sleep_for(milliseconds(PROGRESS_POLL_INTERVAL_MILLISECONDS));
+        }
+    }
+
+    // Function: render_frame
+    // Purpose: Writes one complete bar line in a single stream operation
+    void render_frame(const progress_event& state) {
+        cout << format_progress_indicator(state.completed_steps, state.total_steps,
+                                          active_run_configuration().progress_bar_width,
+                                          state.last_sample_nanoseconds)
+             << flush;
+    }
+
+    spsc_event_ring<progress_event, PROGRESS_EVENT_RING_CAPACITY> event_ring;
+    bool rendering_enabled = false;
+    thread reporter_thread;
+    atomic<bool> stop_requested{false};
+    atomic<size_t> dropped_events{0};
+    size_t published_phase_ends = 0;       // Benchmark-thread private
+    mutex phase_mutex;
+    condition_variable phase_finished_signal;
+    size_t rendered_phase_ends = 0;        // Guarded by phase_mutex
+};
+
+// Function: active_progress_reporter
+// Purpose: Process-wide reporter shared by every measured phase
+// Returns: reference to the lazily constructed reporter
+background_progress_reporter& active_progress_reporter() {
+    static background_progress_reporter progress_reporter;
+    return progress_reporter;
 }
 
 // Function: validate_sorting_correctness
-// Purpose: Verifies that array elements are arranged in ascending order
-// Parameters: data_array - vector to validate for proper sorting
-// Returns: boolean indicating whether array is correctly sorted
-bool validate_sorting_correctness(const vector<int>& data_array) {
-    // Iterate through array elements to verify ascending order
-    for (size_t element_index = 1; element_index < data_array.size(); element_index++) {
-        // Check if current element violates ascending order requirement
-        if (data_array[element_index] < data_array[element_index - 1]) {
+// Purpose: Verifies that elements are arranged in ascending order of their keys
+// Parameters: first/last - range to validate, comparator/projection - ordering used by the sort
+// Returns: boolean indicating whether range is correctly sorted
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+bool validate_sorting_correctness(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    auto less_than = make_element_comparator(comparator, projection);
+
+    // Iterate through elements to verify ascending order
+    for (RandomIt element_position = first; element_position != last && element_position + 1 != last; ++element_position) {
+        // Check if next element violates ascending order requirement
+        if (less_than(*(element_position + 1), *element_position)) {
             return false;  // Return failure if order violation detected
         }
     }
     return true;  // Return success if no order violations found
 }
 
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+bool validate_sorting_correctness(span<const Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    return validate_sorting_correctness(data_span.begin(), data_span.end(), comparator, projection);
+}
+
+// Function: validate_transformed_key_order
+// Purpose: Verifies the order the key transforms define - IEEE totalOrder for floats,
+//          so NaN placement and -0.0 before +0.0 are checked too, which operator<
+//          cannot see; equal string prefixes must be in full lexicographic order
+// Parameters: data_span - sorted output, projection - key extraction
+// Returns: boolean indicating whether range is in transformed-key order
+template <typename Element, typename Projection = identity>
+bool validate_transformed_key_order(span<const Element> data_span, Projection projection = {}) {
+    return validate_sorting_correctness(data_span.begin(), data_span.end(), ordered_key_less{}, projection);
+}
+
+/*
+================================================================================
+SCRATCH MEMORY ARENA - Reusable huge-page backed scratch buffers for the engines
+================================================================================
+*/
+
+// Enumeration: scratch_page_backing
+// Purpose: Page size that ended up backing an arena block
+enum class scratch_page_backing {
+    default_pages,           // Ordinary base pages
+    transparent_huge_pages,  // Base mapping with MADV_HUGEPAGE advice
+    huge_pages_2mb,          // Explicit MAP_HUGETLB 2 MB pages
+    huge_pages_1gb           // Explicit MAP_HUGETLB 1 GB pages
+};
+
+// Function: scratch_page_backing_label
+// Returns: readable name of a backing kind
+const char* scratch_page_backing_label(scratch_page_backing page_backing) {
+    switch (page_backing) {
+        case scratch_page_backing::transparent_huge_pages: return "transparent huge pages";
+        case scratch_page_backing::huge_pages_2mb:         return "2 MB huge pages";
+        case scratch_page_backing::huge_pages_1gb:         return "1 GB huge pages";
+        default:                                           return "default pages";
+    }
+}
+
+// Class: scratch_memory_arena
+// Purpose: Per-thread bump allocator the engines borrow scratch buffers from. Borrows
+//          are released in LIFO order; once nothing is borrowed, overflow blocks are
+//          coalesced into one block sized for the peak, so repeated sorts reuse the
+//          same already-faulted pages instead of a malloc/free and first-touch faults
+//          per call. Blocks prefer explicit huge pages, then transparent huge pages,
+//          and are bound to the allocating thread's NUMA node.
+class scratch_memory_arena {
+public:
+    scratch_memory_arena() = default;
+    scratch_memory_arena(const scratch_memory_arena&) = delete;
+    scratch_memory_arena& operator=(const scratch_memory_arena&) = delete;
+
+    // Destructor: returns every block to the system
+    ~scratch_memory_arena() {
+        for (arena_block& memory_block : memory_blocks) {
+            release_block(memory_block);
+        }
+    }
+
+    // Function: acquire_bytes
+    // Purpose: Borrows SCRATCH_ARENA_ALIGNMENT-aligned memory from the top of the arena
+    // Parameters: byte_count - requested size
+    // Returns: uninitialised memory valid until the matching release_bytes
+    void* acquire_bytes(size_t byte_count) {
+        size_t rounded_bytes = (byte_count + SCRATCH_ARENA_ALIGNMENT - 1) / SCRATCH_ARENA_ALIGNMENT * SCRATCH_ARENA_ALIGNMENT;
+        if (memory_blocks.empty() || memory_blocks.back().used_bytes + rounded_bytes > memory_blocks.back().capacity_bytes) {
+            size_t previous_capacity = memory_blocks.empty() ? 0 : memory_blocks.back().capacity_bytes;
+            memory_blocks.push_back(map_block(max({rounded_bytes, 2 * previous_capacity, SCRATCH_ARENA_MINIMUM_BYTES})));
+        }
+        arena_block& top_block = memory_blocks.back();
+        void* borrowed_memory = top_block.base_address + top_block.used_bytes;
+        top_block.used_bytes += rounded_bytes;
+        outstanding_borrows.push_back({memory_blocks.size() - 1, rounded_bytes});
+        return borrowed_memory;
+    }
+
+    // Function: release_bytes
+    // Purpose: Returns the most recent borrow; coalesces blocks when the arena is idle
+    void release_bytes() {
+        borrow_record latest_borrow = outstanding_borrows.back();
+        outstanding_borrows.pop_back();
+        memory_blocks[latest_borrow.block_index].used_bytes -= latest_borrow.byte_count;
+
+        if (outstanding_borrows.empty() && memory_blocks.size() > 1) {
+            size_t combined_capacity = 0;
+            for (arena_block& memory_block : memory_blocks) {
+                combined_capacity += memory_block.capacity_bytes;
+                release_block(memory_block);
+            }
+            memory_blocks.clear();
+            memory_blocks.push_back(map_block(combined_capacity));
+        }
+    }
+
+    // Function: reserved_bytes
+    // Returns: total capacity currently mapped by this arena
+    size_t reserved_bytes() const {
+        size_t capacity_total = 0;
+        for (const arena_block& memory_block : memory_blocks) {
+            capacity_total += memory_block.capacity_bytes;
+        }
+        return capacity_total;
+    }
+
+    // Function: page_backing
+    // Returns: backing of the most recently mapped block
+    scratch_page_backing page_backing() const {
+        return memory_blocks.empty() ? scratch_page_backing::default_pages : memory_blocks.back().page_backing;
+    }
+
+private:
+    // Structure: arena_block
+    // Purpose: One contiguous mapping
+    struct arena_block {
+        char* base_address;
+        size_t capacity_bytes;
+        size_t used_bytes;
+        size_t mapped_bytes;              // Capacity rounded to the page size actually used
+        scratch_page_backing page_backing;
+    };
+
+    // Structure: borrow_record
+    // Purpose: Block and size of one outstanding borrow
+    struct borrow_record {
+        size_t block_index;
+        size_t byte_count;
+    };
+
+    // Function: map_block
+    // Purpose: Maps a block, trying 1 GB and 2 MB hugetlbfs pages before falling back
+    //          to base pages advised for transparent huge pages
+    static arena_block map_block(size_t capacity_bytes) {
+#ifdef __linux__
+        auto round_to = [](size_t byte_count, size_t page_bytes) { return (byte_count + page_bytes - 1) / page_bytes * page_bytes; };
+        const size_t huge_page_2mb = size_t(2) << 20;
+        const size_t huge_page_1gb = size_t(1) << 30;
+        auto try_map = [](size_t mapped_bytes, int extra_flags) {
+            void* mapping = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | extra_flags, -1, 0);
+            return mapping == MAP_FAILED ? nullptr : static_cast<char*>(mapping);
+        };
+
+        arena_block new_block{nullptr, capacity_bytes, 0, 0, scratch_page_backing::default_pages};
+        if (ENABLE_SCRATCH_HUGE_PAGES && capacity_bytes >= huge_page_1gb) {
+            new_block.mapped_bytes = round_to(capacity_bytes, huge_page_1gb);
+            new_block.base_address = try_map(new_block.mapped_bytes, MAP_HUGETLB | (30 << MAP_HUGE_SHIFT));
+            new_block.page_backing = scratch_page_backing::huge_pages_1gb;
+        }
+        if (ENABLE_SCRATCH_HUGE_PAGES && new_block.base_address == nullptr) {
+            new_block.mapped_bytes = round_to(capacity_bytes, huge_page_2mb);
+            new_block.base_address = try_map(new_block.mapped_bytes, MAP_HUGETLB | (21 << MAP_HUGE_SHIFT));
+            new_block.page_backing = scratch_page_backing::huge_pages_2mb;
+        }
+        if (new_block.base_address == nullptr) {
+            // No reserved hugetlbfs pages - 2 MB-aligned sizes still let THP back the block
+            new_block.mapped_bytes = round_to(capacity_bytes, huge_page_2mb);
+            new_block.base_address = try_map(new_block.mapped_bytes, 0);
+            new_block.page_backing = scratch_page_backing::default_pages;
+            if (new_block.base_address == nullptr) {
+                throw bad_alloc();
+            }
+            if (ENABLE_SCRATCH_HUGE_PAGES && madvise(new_block.base_address, new_block.mapped_bytes, MADV_HUGEPAGE) == 0) {
+                new_block.page_backing = scratch_page_backing::transparent_huge_pages;
+            }
+        }
+
+        // Keep pages on the allocating thread's node even if a different node touches them first
+        syscall(SYS_mbind, new_block.base_address, new_block.mapped_bytes, MPOL_LOCAL, nullptr, 0, 0);
+        return new_block;
+#else
+        char* block_address = static_cast<char*>(::operator new(capacity_bytes, align_val_t{SCRATCH_ARENA_ALIGNMENT}));
+        return arena_block{block_address, capacity_bytes, 0, capacity_bytes, scratch_page_backing::default_pages};
+#endif
+    }
+
+    // Function: release_block
+    // Purpose: Unmaps (or frees) one block
+    static void release_block(arena_block& memory_block) {
+#ifdef __linux__
+        munmap(memory_block.base_address, memory_block.mapped_bytes);
+#else
+        ::operator delete(memory_block.base_address, align_val_t{SCRATCH_ARENA_ALIGNMENT});
+#endif
+    }
+
+    vector<arena_block> memory_blocks;         // Oldest first; borrows come from the last block
+    vector<borrow_record> outstanding_borrows;  // LIFO stack of live borrows
+};
+
+// Function: thread_scratch_arena
+// Purpose: Arena of the calling thread - lives as long as the thread, so scratch
+//          pages stay mapped across iterations and workers never contend
+// Returns: reference to the thread-local arena
+scratch_memory_arena& thread_scratch_arena() {
+    thread_local scratch_memory_arena calling_thread_arena;
+    return calling_thread_arena;
+}
+
+// Class: scratch_buffer_lease
+// Purpose: RAII scratch array borrowed from the calling thread's arena. Elements are
+//          default-initialised (no zeroing for trivial types) and destroyed on release;
+//          leases must be released on the borrowing thread in LIFO order, which
+//          scoped use guarantees
+template <typename Element>
+class scratch_buffer_lease {
+public:
+    // Constructor: borrows element_count elements
+    explicit scratch_buffer_lease(size_t element_count)
+        : owning_arena(thread_scratch_arena()), buffer_length(element_count) {
+        static_assert(alignof(Element) <= SCRATCH_ARENA_ALIGNMENT, "scratch arena alignment too small");
+        buffer_elements = static_cast<Element*>(owning_arena.acquire_bytes(element_count * sizeof(Element)));
+        uninitialized_default_construct_n(buffer_elements, buffer_length);
+    }
+
+    // Destructor: destroys the elements and returns the memory
+    ~scratch_buffer_lease() {
+        destroy_n(buffer_elements, buffer_length);
+        owning_arena.release_bytes();
+    }
+
+    scratch_buffer_lease(const scratch_buffer_lease&) = delete;
+    scratch_buffer_lease& operator=(const scratch_buffer_lease&) = delete;
+
+    Element* begin() { return buffer_elements; }
+    Element* end() { return buffer_elements + buffer_length; }
+    Element* data() { return buffer_elements; }
+    size_t size() const { return buffer_length; }
+    Element& operator[](size_t element_index) { return buffer_elements[element_index]; }
+
+private:
+    scratch_memory_arena& owning_arena;  // Arena of the borrowing thread
+    Element* buffer_elements;            // Borrowed storage
+    size_t buffer_length;                // Elements in the lease
+};
+
+// Structure: memory_footprint_readings
+// Purpose: Process memory behaviour over one measurement
+struct memory_footprint_readings {
+    bool peak_scoped = false;              // VmHWM was reset at the start (else it is the process lifetime peak)
+    double peak_resident_megabytes = 0.0;  // Peak resident set size
+    double minor_faults_per_run = 0.0;     // Page faults served without I/O, per repetition
+    double major_faults_per_run = 0.0;     // Page faults that required I/O, per repetition
+};
+
+// Class: memory_footprint_probe
+// Purpose: Resets the peak-RSS watermark (via /proc/self/clear_refs) and snapshots the
+//          process page-fault counters; finish() reports the difference
+class memory_footprint_probe {
+public:
+    // Constructor: starts the probe
+    memory_footprint_probe() {
+#ifdef __linux__
+        ofstream clear_refs_file("/proc/self/clear_refs");
+        clear_refs_file << "5";  // 5 resets VmHWM to the current RSS
+        clear_refs_file.flush();
+        peak_scoped = static_cast<bool>(clear_refs_file);
+#endif
+        read_fault_counts(starting_minor_faults, starting_major_faults);
+    }
+
+    // Function: finish
+    // Parameters: run_count - repetitions executed since construction
+    // Returns: peak RSS and per-run fault counts
+    memory_footprint_readings finish(int run_count) const {
+        memory_footprint_readings readings;
+        long minor_faults = 0;
+        long major_faults = 0;
+        read_fault_counts(minor_faults, major_faults);
+        double run_divisor = max(run_count, 1);
+        readings.minor_faults_per_run = (minor_faults - starting_minor_faults) / run_divisor;
+        readings.major_faults_per_run = (major_faults - starting_major_faults) / run_divisor;
+        readings.peak_scoped = peak_scoped;
+#ifdef __linux__
+        ifstream status_file("/proc/self/status");
+        string status_line;
+        while (getline(status_file, status_line)) {
+            if (status_line.rfind("VmHWM:", 0) == 0) {
+                readings.peak_resident_megabytes = stod(status_line.substr(6)) / 1024.0;  // Reported in kB
+                break;
+            }
+        }
+#endif
+        return readings;
+    }
+
+private:
+    // Function: read_fault_counts
+    // Purpose: Process-wide (all threads) fault counters from getrusage
+    static void read_fault_counts(long& minor_faults, long& major_faults) {
+#if defined(__unix__) || defined(__APPLE__)
+        rusage resource_usage {};
+        getrusage(RUSAGE_SELF, &resource_usage);
+        minor_faults = resource_usage.ru_minflt;
+        major_faults = resource_usage.ru_majflt;
+#else
+        minor_faults = 0;
+        major_faults = 0;
+#endif
+    }
+
+    bool peak_scoped = false;
+    long starting_minor_faults = 0;
+    long starting_major_faults = 0;
+};
+
 /*
 ================================================================================
 SORTING ALGORITHM IMPLEMENTATIONS - Core sorting methodologies
@@ -98,24 +1118,27 @@ SORTING ALGORITHM IMPLEMENTATIONS - Core sorting methodologies
 
 // Function: execute_bubble_sort_algorithm
 // Purpose: Implements bubble sort with adjacent element comparison and swapping
-// Parameters: data_array - reference to vector requiring sorting operation
-void execute_bubble_sort_algorithm(vector<int>& data_array) {
-    int array_length = data_array.size();  // Cache array size for optimization
-    
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_bubble_sort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    auto less_than = make_element_comparator(comparator, projection);
+    ptrdiff_t array_length = last - first;  // Cache range size for optimization
+
     // Outer loop controls number of passes through the array
-    for (int pass_iteration = 0; pass_iteration < array_length - 1; pass_iteration++) {
+    for (ptrdiff_t pass_iteration = 0; pass_iteration < array_length - 1; pass_iteration++) {
         bool swap_operation_occurred = false;  // Flag to track element exchanges
-        
+
         // Inner loop performs adjacent element comparisons
-        for (int comparison_index = 0; comparison_index < array_length - pass_iteration - 1; comparison_index++) {
+        for (ptrdiff_t comparison_index = 0; comparison_index < array_length - pass_iteration - 1; comparison_index++) {
             // Compare adjacent elements and swap if out of order
-            if (data_array[comparison_index] > data_array[comparison_index + 1]) {
+            if (less_than(first[comparison_index + 1], first[comparison_index])) {
                 // Perform element exchange using standard library swap
-                swap(data_array[comparison_index], data_array[comparison_index + 1]);
+                iter_swap(first + comparison_index, first + comparison_index + 1);
                 swap_operation_occurred = true;  // Mark that swap occurred
             }
         }
-        
+
         // Early termination optimization - exit if no swaps occurred
         if (!swap_operation_occurred) {
             break;  // Array is already sorted, terminate algorithm
@@ -123,56 +1146,6068 @@ void execute_bubble_sort_algorithm(vector<int>& data_array) {
     }
 }
 
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_bubble_sort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_bubble_sort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
 // Function: execute_selection_sort_algorithm
 // Purpose: Implements selection sort by finding minimum elements iteratively
-// Parameters: data_array - reference to vector requiring sorting operation
-void execute_selection_sort_algorithm(vector<int>& data_array) {
-    int array_length = data_array.size();  // Cache array size for optimization
-    
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_selection_sort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    auto less_than = make_element_comparator(comparator, projection);
+    ptrdiff_t array_length = last - first;  // Cache range size for optimization
+
     // Outer loop establishes sorted boundary position
-    for (int sorted_boundary = 0; sorted_boundary < array_length - 1; sorted_boundary++) {
-        int minimum_element_index = sorted_boundary;  // Initialize minimum position
-        
+    for (ptrdiff_t sorted_boundary = 0; sorted_boundary < array_length - 1; sorted_boundary++) {
+        ptrdiff_t minimum_element_index = sorted_boundary;  // Initialize minimum position
+
         // Inner loop searches for minimum element in unsorted portion
-        for (int search_index = sorted_boundary + 1; search_index < array_length; search_index++) {
+        for (ptrdiff_t search_index = sorted_boundary + 1; search_index < array_length; search_index++) {
             // Update minimum index if smaller element discovered
-            if (data_array[search_index] < data_array[minimum_element_index]) {
+            if (less_than(first[search_index], first[minimum_element_index])) {
                 minimum_element_index = search_index;
             }
         }
-        
+
         // Place minimum element at sorted boundary position
         if (minimum_element_index != sorted_boundary) {
-            swap(data_array[sorted_boundary], data_array[minimum_element_index]);
+            iter_swap(first + sorted_boundary, first + minimum_element_index);
         }
     }
 }
 
-// Function: execute_insertion_sort_algorithm
-// Purpose: Implements insertion sort by building sorted sequence incrementally
-// Parameters: data_array - reference to vector requiring sorting operation
-void execute_insertion_sort_algorithm(vector<int>& data_array) {
-    int array_length = data_array.size();  // Cache array size for optimization
-    
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_selection_sort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_selection_sort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
+// Function: insertion_sort_range
+// Purpose: Insertion sort of the half-open range [range_begin, range_end)
+// Parameters: range_begin/range_end - range bounds, less_than - element comparator
+template <typename RandomIt, typename LessThan>
+void insertion_sort_range(RandomIt range_begin, RandomIt range_end, LessThan less_than) {
+    if (range_begin == range_end) {
+        return;  // Empty range
+    }
+
     // Outer loop processes each element starting from second position
-    for (int current_element = 1; current_element < array_length; current_element++) {
-        int key_value = data_array[current_element];  // Store element to be inserted
-        int insertion_position = current_element - 1;  // Start comparison from previous element
-        
+    for (RandomIt current_element = range_begin + 1; current_element < range_end; ++current_element) {
+        auto key_value = move(*current_element);  // Store element to be inserted
+        RandomIt insertion_position = current_element;  // Hole left by the key
+
         // Shift larger elements rightward to create insertion space
-        while (insertion_position >= 0 && data_array[insertion_position] > key_value) {
-            data_array[insertion_position + 1] = data_array[insertion_position];
-            insertion_position--;  // Move leftward through sorted portion
+        while (insertion_position != range_begin && less_than(key_value, *(insertion_position - 1))) {
+            *insertion_position = move(*(insertion_position - 1));
+            --insertion_position;  // Move leftward through sorted portion
         }
-        
+
         // Insert key value at determined position
-        data_array[insertion_position + 1] = key_value;
+        *insertion_position = move(key_value);
     }
 }
 
+// Function: execute_insertion_sort_algorithm
+// Purpose: Implements insertion sort by building sorted sequence incrementally
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_insertion_sort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    insertion_sort_range(first, last, make_element_comparator(comparator, projection));
+}
+
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_insertion_sort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_insertion_sort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
 /*
 ================================================================================
-PERFORMANCE ANALYSIS SYSTEM - Algorithm execution measurement and reporting
+O(N LOG N) ALGORITHM IMPLEMENTATIONS - Scalable sorting methodologies
+================================================================================
+*/
+
+// Function: sift_down_heap_element
+// Purpose: Restores max-heap order below root_index for a heap stored at heap_base
+// Parameters: heap_base - first heap element, root_index - heap-relative node to sift,
+//             heap_size - live heap elements, less_than - element comparator
+template <typename RandomIt, typename LessThan>
+void sift_down_heap_element(RandomIt heap_base, ptrdiff_t root_index, ptrdiff_t heap_size, LessThan less_than) {
+    auto root_value = move(heap_base[root_index]);  // Element travelling down the heap
+
+    // Descend while the current node still has at least one child
+    while (2 * root_index + 1 < heap_size) {
+        ptrdiff_t child_index = 2 * root_index + 1;  // Start with the left child
+
+        // Prefer the larger of the two children
+        if (child_index + 1 < heap_size && less_than(heap_base[child_index], heap_base[child_index + 1])) {
+            child_index++;
+        }
+
+        // Stop once the travelling element dominates both children
+        if (!less_than(root_value, heap_base[child_index])) {
+            break;
+        }
+
+        // Pull the larger child up and continue from its slot
+        heap_base[root_index] = move(heap_base[child_index]);
+        root_index = child_index;
+    }
+
+    heap_base[root_index] = move(root_value);  // Settle element at final position
+}
+
+// Function: heap_sort_range
+// Purpose: In-place heap sort of the half-open range [range_begin, range_end)
+// Parameters: range_begin/range_end - range bounds, less_than - element comparator
+template <typename RandomIt, typename LessThan>
+void heap_sort_range(RandomIt range_begin, RandomIt range_end, LessThan less_than) {
+    ptrdiff_t heap_size = range_end - range_begin;  // Number of elements under heap management
+
+    // Build max-heap bottom-up starting from last internal node
+    for (ptrdiff_t node_index = heap_size / 2 - 1; node_index >= 0; node_index--) {
+        sift_down_heap_element(range_begin, node_index, heap_size, less_than);
+    }
+
+    // Repeatedly move heap maximum behind the shrinking heap
+    for (ptrdiff_t heap_end = heap_size - 1; heap_end > 0; heap_end--) {
+        iter_swap(range_begin, range_begin + heap_end);
+        sift_down_heap_element(range_begin, 0, heap_end, less_than);
+    }
+}
+
+// Function: execute_heap_sort_algorithm
+// Purpose: Implements in-place heap sort with guaranteed O(n log n) behaviour
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_heap_sort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    heap_sort_range(first, last, make_element_comparator(comparator, projection));
+}
+
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_heap_sort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_heap_sort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
+// Function: select_median_of_three_pivot
+// Purpose: Orders first, middle and last elements and returns the median element
+// Parameters: range_begin/range_end - range bounds, less_than - element comparator
+// Returns: copy of the median element to be used as partitioning pivot
+template <typename RandomIt, typename LessThan>
+iter_value_t<RandomIt> select_median_of_three_pivot(RandomIt range_begin, RandomIt range_end, LessThan less_than) {
+    RandomIt middle_position = range_begin + (range_end - range_begin) / 2;
+    RandomIt last_position = range_end - 1;
+
+    // Sort the three samples in place so the extremes act as partition sentinels
+    if (less_than(*middle_position, *range_begin)) {
+        iter_swap(middle_position, range_begin);
+    }
+    if (less_than(*last_position, *range_begin)) {
+        iter_swap(last_position, range_begin);
+    }
+    if (less_than(*last_position, *middle_position)) {
+        iter_swap(last_position, middle_position);
+    }
+
+    return *middle_position;  // Median of the three samples
+}
+
+// Function: hoare_partition_range
+// Purpose: Splits the range into elements <= pivot and elements >= pivot
+// Parameters: range_begin/range_end - range bounds, pivot_value - partitioning element
+//             taken from inside the range, less_than - element comparator
+// Returns: split position such that [range_begin, split) <= pivot <= [split, range_end)
+template <typename RandomIt, typename Element, typename LessThan>
+RandomIt hoare_partition_range(RandomIt range_begin, RandomIt range_end, const Element& pivot_value, LessThan less_than) {
+    RandomIt left_position = range_begin - 1;
+    RandomIt right_position = range_end;
+
+    // Scan inwards from both ends, swapping misplaced pairs
+    while (true) {
+        do { ++left_position; } while (less_than(*left_position, pivot_value));
+        do { --right_position; } while (less_than(pivot_value, *right_position));
+
+        // Pointers crossed - partition boundary located
+        if (left_position >= right_position) {
+            return right_position + 1;
+        }
+        iter_swap(left_position, right_position);
+    }
+}
+
+// Function: introsort_heap_fallback_counter
+// Purpose: Process-wide count of depth-limit heap sort fallbacks, so the fuzz harness
+//          can tell which inputs defeat median-of-three pivot selection
+atomic<size_t>& introsort_heap_fallback_counter() {
+    static atomic<size_t> heap_fallback_count{0};
+    return heap_fallback_count;
+}
+
+// Function: introsort_partition_loop
+// Purpose: Quicksort recursion with depth limit and heap sort fallback
+// Parameters: range_begin/range_end - range bounds, depth_budget - remaining partition
+//             levels before heap sort takes over, less_than - element comparator
+template <typename RandomIt, typename LessThan>
+void introsort_partition_loop(RandomIt range_begin, RandomIt range_end, int depth_budget, LessThan less_than) {
+    // Keep partitioning until insertion sort becomes cheaper
+    while (range_end - range_begin > SMALL_PARTITION_THRESHOLD) {
+        // Degenerate pivot sequence detected - switch to guaranteed O(n log n)
+        if (depth_budget == 0) {
+            introsort_heap_fallback_counter().fetch_add(1, memory_order_relaxed);
+            heap_sort_range(range_begin, range_end, less_than);
+            return;
+        }
+        depth_budget--;
+
+        auto pivot_value = select_median_of_three_pivot(range_begin, range_end, less_than);
+        RandomIt split_position = hoare_partition_range(range_begin, range_end, pivot_value, less_than);
+
+        // Recurse into smaller side, iterate over larger side to bound stack depth
+        if (split_position - range_begin < range_end - split_position) {
+            introsort_partition_loop(range_begin, split_position, depth_budget, less_than);
+            range_begin = split_position;
+        } else {
+            introsort_partition_loop(split_position, range_end, depth_budget, less_than);
+            range_end = split_position;
+        }
+    }
+
+    insertion_sort_range(range_begin, range_end, less_than);  // Finish small partition
+}
+
+// Function: compute_introsort_depth_budget
+// Purpose: Depth limit of 2 * floor(log2(n)) used by every introsort variant
+// Parameters: range_length - number of elements in the range
+// Returns: partition levels allowed before heap sort takes over
+int compute_introsort_depth_budget(ptrdiff_t range_length) {
+    int depth_budget = 0;
+    for (ptrdiff_t remaining = range_length; remaining > 1; remaining >>= 1) {
+        depth_budget += 2;
+    }
+    return depth_budget;
+}
+
+// Function: execute_introsort_algorithm
+// Purpose: Implements introsort (median-of-three quicksort, heap sort fallback,
+//          insertion sort for small partitions)
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_introsort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    // Allow 2 * floor(log2(n)) partition levels before falling back to heap sort
+    introsort_partition_loop(first, last, compute_introsort_depth_budget(last - first),
+                             make_element_comparator(comparator, projection));
+}
+
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_introsort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_introsort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
+// Function: merge_adjacent_run_pass
+// Purpose: One bottom-up pass merging neighbouring runs of run_width from source to target
+// Parameters: source_begin - input buffer, target_begin - output buffer, array_length -
+//             elements in both buffers, run_width - sorted run length, less_than - comparator
+template <typename SourceIt, typename TargetIt, typename LessThan>
+void merge_adjacent_run_pass(SourceIt source_begin, TargetIt target_begin, ptrdiff_t array_length,
+                             ptrdiff_t run_width, LessThan less_than) {
+    for (ptrdiff_t left_begin = 0; left_begin < array_length; left_begin += 2 * run_width) {
+        ptrdiff_t left_end = min(left_begin + run_width, array_length);
+        ptrdiff_t right_end = min(left_begin + 2 * run_width, array_length);
+
+        // Standard two-way merge, taking from the left run on ties for stability
+        merge(make_move_iterator(source_begin + left_begin), make_move_iterator(source_begin + left_end),
+              make_move_iterator(source_begin + left_end), make_move_iterator(source_begin + right_end),
+              target_begin + left_begin, less_than);
+    }
+}
+
+// Function: execute_merge_sort_algorithm
+// Purpose: Implements bottom-up merge sort that ping-pongs through one scratch buffer
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_merge_sort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    auto less_than = make_element_comparator(comparator, projection);
+    ptrdiff_t array_length = last - first;  // Cache range size for optimization
+
+    // Pick the seed run width (16 or 32) that makes the merge pass count even,
+    // so the final pass lands back in the caller's range without a copy
+    ptrdiff_t seed_run_width = SMALL_PARTITION_THRESHOLD;
+    int merge_pass_count = 0;
+    for (ptrdiff_t run_width = seed_run_width; run_width < array_length; run_width *= 2) {
+        merge_pass_count++;
+    }
+    if (merge_pass_count % 2 == 1) {
+        seed_run_width *= 2;
+    }
+
+    // Seed the merge passes with insertion-sorted runs
+    for (ptrdiff_t run_begin = 0; run_begin < array_length; run_begin += seed_run_width) {
+        insertion_sort_range(first + run_begin, first + min(run_begin + seed_run_width, array_length), less_than);
+    }
+    if (array_length <= seed_run_width) {
+        return;  // Single run already sorted
+    }
+
+    // Single scratch borrow shared by every merge pass
+    scratch_buffer_lease<iter_value_t<RandomIt>> scratch_buffer(array_length);
+    bool result_in_scratch = false;
+
+    // Double run width each pass, alternating source and target buffers
+    for (ptrdiff_t run_width = seed_run_width; run_width < array_length; run_width *= 2) {
+        if (result_in_scratch) {
+            merge_adjacent_run_pass(scratch_buffer.begin(), first, array_length, run_width, less_than);
+        } else {
+            merge_adjacent_run_pass(first, scratch_buffer.begin(), array_length, run_width, less_than);
+        }
+        result_in_scratch = !result_in_scratch;  // Merged output feeds the next pass
+    }
+}
+
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_merge_sort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_merge_sort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
+// Function: extend_natural_run
+// Purpose: Finds the natural run starting at run_begin - non-descending, or strictly
+//          descending (reversed in place, which keeps equal keys stable) - and extends
+//          runs shorter than POWERSORT_MINIMUM_RUN with insertion sort
+// Parameters: run_begin/range_end - remaining range, less_than - element comparator
+// Returns: end of the sorted run
+template <typename RandomIt, typename LessThan>
+RandomIt extend_natural_run(RandomIt run_begin, RandomIt range_end, LessThan less_than) {
+    RandomIt run_end = run_begin + 1;
+    if (run_end == range_end) {
+        return run_end;
+    }
+    if (less_than(*run_end, *run_begin)) {
+        while (run_end != range_end && less_than(*run_end, *(run_end - 1))) {
+            ++run_end;
+        }
+        reverse(run_begin, run_end);
+    } else {
+        while (run_end != range_end && !less_than(*run_end, *(run_end - 1))) {
+            ++run_end;
+        }
+    }
+
+    RandomIt minimum_run_end = run_begin + min<ptrdiff_t>(POWERSORT_MINIMUM_RUN, range_end - run_begin);
+    if (run_end < minimum_run_end) {
+        insertion_sort_range(run_begin, minimum_run_end, less_than);  // Prefix already sorted - cheap
+        run_end = minimum_run_end;
+    }
+    return run_end;
+}
+
+// Function: powersort_node_power
+// Purpose: Depth of the boundary between two adjacent runs in the nearly-optimal
+//          merge tree (Munro & Wild): the first bit where the runs' scaled midpoints differ
+// Parameters: left_begin - offset of the left run, left_length/right_length - run sizes,
+//             total_length - whole range size
+// Returns: node power (smaller means closer to the root)
+inline int powersort_node_power(size_t left_begin, size_t left_length, size_t right_length, size_t total_length) {
+    size_t left_midpoint = 2 * left_begin + left_length;       // Twice the left run's midpoint
+    size_t right_midpoint = left_midpoint + left_length + right_length;  // Twice the right run's midpoint
+    int node_power = 0;
+    while (true) {
+        ++node_power;
+        if (left_midpoint >= total_length) {
+            left_midpoint -= total_length;
+            right_midpoint -= total_length;
+        } else if (right_midpoint >= total_length) {
+            return node_power;
+        }
+        left_midpoint <<= 1;
+        right_midpoint <<= 1;
+    }
+}
+
+// Function: gallop_partition_point
+// Purpose: Exponential search from the front for the end of the prefix satisfying a
+//          monotone predicate - O(log d) probes when the answer is d elements away
+// Parameters: range_begin/range_end - range whose prefix satisfies predicate
+// Returns: first element for which predicate is false, or range_end
+template <typename RandomIt, typename Predicate>
+RandomIt gallop_partition_point(RandomIt range_begin, RandomIt range_end, Predicate predicate) {
+    ptrdiff_t range_length = range_end - range_begin;
+    ptrdiff_t known_true = 0;
+    ptrdiff_t gallop_step = 1;
+    while (known_true + gallop_step <= range_length && predicate(range_begin[known_true + gallop_step - 1])) {
+        known_true += gallop_step;
+        gallop_step *= 2;
+    }
+    return partition_point(range_begin + known_true,
+                           range_begin + min(known_true + gallop_step - 1, range_length), predicate);
+}
+
+// Function: gallop_partition_point_backward
+// Purpose: Mirror of gallop_partition_point that searches from the back for the start
+//          of the suffix satisfying a monotone predicate
+// Returns: first element of the satisfying suffix, or range_end when it is empty
+template <typename RandomIt, typename Predicate>
+RandomIt gallop_partition_point_backward(RandomIt range_begin, RandomIt range_end, Predicate predicate) {
+    ptrdiff_t range_length = range_end - range_begin;
+    ptrdiff_t known_true = 0;
+    ptrdiff_t gallop_step = 1;
+    while (known_true + gallop_step <= range_length && predicate(range_end[-(known_true + gallop_step)])) {
+        known_true += gallop_step;
+        gallop_step *= 2;
+    }
+    return partition_point(range_begin + max<ptrdiff_t>(range_length - known_true - gallop_step + 1, 0),
+                           range_end - known_true, [&](const auto& element) { return !predicate(element); });
+}
+
+// Function: merge_through_buffer
+// Purpose: Stable in-range merge of [range_begin, middle) and [middle, range_end).
+//          Elements already in their final place at either end are trimmed by
+//          galloping first; the shorter remainder is moved into scratch - a left run
+//          merges forward, a right run merges backward, so scratch never exceeds half
+//          the range. Once one run wins MERGE_GALLOP_THRESHOLD times in a row, its
+//          whole winning stretch is found by galloping and moved as a block.
+// Parameters: range_begin/middle/range_end - the two adjacent runs, scratch_begin -
+//             buffer holding at least the shorter run, less_than - element comparator
+template <typename RandomIt, typename BufferIt, typename LessThan>
+void merge_through_buffer(RandomIt range_begin, RandomIt middle, RandomIt range_end, BufferIt scratch_begin,
+                          LessThan less_than) {
+    // Already in order across the boundary - nothing to do
+    if (middle == range_begin || middle == range_end || !less_than(*middle, *(middle - 1))) {
+        return;
+    }
+
+    // Left elements not above the right head, and right elements not below the left
+    // tail, are already in place
+    range_begin = gallop_partition_point(range_begin, middle,
+                                         [&](const auto& element) { return !less_than(*middle, element); });
+    range_end = gallop_partition_point_backward(middle, range_end,
+                                                [&](const auto& element) { return !less_than(element, *(middle - 1)); });
+
+    int left_streak = 0;
+    int right_streak = 0;
+    if (middle - range_begin <= range_end - middle) {
+        // Forward merge: on ties the left (buffered) element goes first
+        BufferIt scratch_end = move(range_begin, middle, scratch_begin);
+        BufferIt left_cursor = scratch_begin;
+        RandomIt right_cursor = middle;
+        RandomIt output_cursor = range_begin;
+        while (left_cursor != scratch_end && right_cursor != range_end) {
+            if (less_than(*right_cursor, *left_cursor)) {
+                *output_cursor++ = move(*right_cursor++);
+                left_streak = 0;
+                if (++right_streak >= MERGE_GALLOP_THRESHOLD) {
+                    RandomIt stretch_end = gallop_partition_point(right_cursor, range_end,
+                        [&](const auto& element) { return less_than(element, *left_cursor); });
+                    output_cursor = move(right_cursor, stretch_end, output_cursor);
+                    right_cursor = stretch_end;
+                    right_streak = 0;
+                }
+            } else {
+                *output_cursor++ = move(*left_cursor++);
+                right_streak = 0;
+                if (++left_streak >= MERGE_GALLOP_THRESHOLD) {
+                    BufferIt stretch_end = gallop_partition_point(left_cursor, scratch_end,
+                        [&](const auto& element) { return !less_than(*right_cursor, element); });
+                    output_cursor = move(left_cursor, stretch_end, output_cursor);
+                    left_cursor = stretch_end;
+                    left_streak = 0;
+                }
+            }
+        }
+        move(left_cursor, scratch_end, output_cursor);  // A right remainder is already in place
+        return;
+    }
+
+    // Backward merge: on ties the right (buffered) element goes last, preserving stability
+    BufferIt scratch_end = move(middle, range_end, scratch_begin);
+    RandomIt left_cursor = middle;
+    RandomIt output_cursor = range_end;
+    while (scratch_end != scratch_begin && left_cursor != range_begin) {
+        if (less_than(*(scratch_end - 1), *(left_cursor - 1))) {
+            *--output_cursor = move(*--left_cursor);
+            right_streak = 0;
+            if (++left_streak >= MERGE_GALLOP_THRESHOLD) {
+                RandomIt stretch_begin = gallop_partition_point_backward(range_begin, left_cursor,
+                    [&](const auto& element) { return less_than(*(scratch_end - 1), element); });
+                output_cursor = move_backward(stretch_begin, left_cursor, output_cursor);
+                left_cursor = stretch_begin;
+                left_streak = 0;
+            }
+        } else {
+            *--output_cursor = move(*--scratch_end);
+            left_streak = 0;
+            if (++right_streak >= MERGE_GALLOP_THRESHOLD) {
+                BufferIt stretch_begin = gallop_partition_point_backward(scratch_begin, scratch_end,
+                    [&](const auto& element) { return !less_than(element, *(left_cursor - 1)); });
+                output_cursor = move_backward(stretch_begin, scratch_end, output_cursor);
+                scratch_end = stretch_begin;
+                right_streak = 0;
+            }
+        }
+    }
+    move_backward(scratch_begin, scratch_end, output_cursor);
+}
+
+// Function: execute_powersort_algorithm
+// Purpose: Implements powersort - natural runs are merged in the order given by
+//          their node powers, which is within a constant of the optimal merge cost and
+//          makes presorted, reversed and run-structured inputs linear. Merges gallop
+//          through long one-sided stretches. Stable.
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_powersort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    auto less_than = make_element_comparator(comparator, projection);
+    size_t array_length = last - first;
+    if (array_length < 2) {
+        return;
+    }
+
+    // Pending runs with the power of the boundary to their right neighbour
+    struct pending_run {
+        RandomIt run_begin;
+        RandomIt run_end;
+        int node_power;
+    };
+    vector<pending_run> run_stack;
+    optional<scratch_buffer_lease<iter_value_t<RandomIt>>> scratch_buffer;  // Borrowed on the first real merge
+    auto merge_runs = [&](RandomIt range_begin, RandomIt middle, RandomIt range_end) {
+        if (!scratch_buffer) {
+            scratch_buffer.emplace(array_length / 2 + 1);
+        }
+        merge_through_buffer(range_begin, middle, range_end, scratch_buffer->begin(), less_than);
+    };
+
+    RandomIt current_begin = first;
+    RandomIt current_end = extend_natural_run(first, last, less_than);
+    while (current_end != last) {
+        RandomIt next_end = extend_natural_run(current_end, last, less_than);
+        int boundary_power = powersort_node_power(current_begin - first, current_end - current_begin,
+                                                  next_end - current_end, array_length);
+        // Merge every pending run that sits deeper in the tree than this boundary
+        while (!run_stack.empty() && run_stack.back().node_power > boundary_power) {
+            merge_runs(run_stack.back().run_begin, current_begin, current_end);
+            current_begin = run_stack.back().run_begin;
+            run_stack.pop_back();
+        }
+        run_stack.push_back({current_begin, current_end, boundary_power});
+        current_begin = current_end;
+        current_end = next_end;
+    }
+    while (!run_stack.empty()) {
+        merge_runs(run_stack.back().run_begin, current_begin, current_end);
+        current_begin = run_stack.back().run_begin;
+        run_stack.pop_back();
+    }
+}
+
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_powersort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_powersort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
+// Function: execute_std_sort_reference
+// Purpose: Wraps std::sort as the standard library reference for unstable sorting
+// Parameters: data_span - elements requiring sorting, comparator/projection - key ordering
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_std_sort_reference(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    ranges::sort(data_span, comparator, projection);
+}
+
+// Function: execute_std_stable_sort_reference
+// Purpose: Wraps std::stable_sort as the standard library reference for stable sorting
+// Parameters: data_span - elements requiring sorting, comparator/projection - key ordering
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_std_stable_sort_reference(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    ranges::stable_sort(data_span, comparator, projection);
+}
+
+/*
+================================================================================
+BRANCHLESS AND SIMD KERNELS - Mispredict-free loops, sorting networks, partition
+================================================================================
+*/
+
+// Function: execute_branchless_bubble_sort_algorithm
+// Purpose: Bubble sort whose compare-exchange is a pair of selects (cmov for scalar
+//          keys) - the larger element is carried along the pass in a register
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_branchless_bubble_sort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    auto less_than = make_element_comparator(comparator, projection);
+    ptrdiff_t array_length = last - first;
+
+    for (ptrdiff_t pass_length = array_length; pass_length > 1; pass_length--) {
+        bool swap_operation_occurred = false;
+        iter_value_t<RandomIt> carried_element = first[0];  // Largest element seen in this pass
+
+        for (ptrdiff_t comparison_index = 1; comparison_index < pass_length; comparison_index++) {
+            iter_value_t<RandomIt> next_element = first[comparison_index];
+            bool out_of_order = less_than(next_element, carried_element);
+            first[comparison_index - 1] = out_of_order ? next_element : carried_element;
+            carried_element = out_of_order ? carried_element : next_element;
+            swap_operation_occurred |= out_of_order;
+        }
+        first[pass_length - 1] = carried_element;
+
+        // Same early exit as the branching version - one predictable branch per pass
+        if (!swap_operation_occurred) {
+            break;
+        }
+    }
+}
+
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_branchless_bubble_sort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_branchless_bubble_sort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
+// Function: branchless_insertion_sort_range
+// Purpose: Binary insertion sort - the insertion point comes from a branchless upper
+//          bound (conditional pointer advance), the shift is one block move
+// Parameters: range_begin/range_end - range bounds, less_than - element comparator
+template <typename RandomIt, typename LessThan>
+void branchless_insertion_sort_range(RandomIt range_begin, RandomIt range_end, LessThan less_than) {
+    for (RandomIt current_element = range_begin + (range_begin != range_end); current_element < range_end; ++current_element) {
+        auto key_value = move(*current_element);
+
+        // Upper bound in the sorted prefix: halve the window, advance with a select
+        RandomIt search_base = range_begin;
+        ptrdiff_t window_length = current_element - range_begin;
+        while (window_length > 1) {
+            ptrdiff_t half_length = window_length / 2;
+            search_base = less_than(key_value, search_base[half_length]) ? search_base : search_base + half_length;
+            window_length -= half_length;
+        }
+        RandomIt insertion_position = search_base + !less_than(key_value, *search_base);
+
+        // Equal keys stay in front of the inserted one, so the sort is stable
+        move_backward(insertion_position, current_element, current_element + 1);
+        *insertion_position = move(key_value);
+    }
+}
+
+// Function: execute_branchless_insertion_sort_algorithm
+// Purpose: Implements insertion sort with a branchless search for the insertion point
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_branchless_insertion_sort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    branchless_insertion_sort_range(first, last, make_element_comparator(comparator, projection));
+}
+
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_branchless_insertion_sort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_branchless_insertion_sort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
+/*
+The SIMD kernels sort int32 keys. Every sorting network below is the same bitonic
+network: for each stage (k, j) lane i is replaced by min or max of itself and lane
+i ^ j, taking the max when exactly one of (i & j) and (i & k) is non-zero. Partners
+closer than the vector width are fetched with a lane permutation, farther partners
+live in another register. Arrays shorter than a power of two are padded with
+INT32_MAX, which sorts to the end and is dropped on the way out.
+*/
+
+// Function: branchless_partition_int32
+// Purpose: Portable partition kernel - Lomuto with an unconditional swap and a
+//          conditional advance, so no branch depends on the data
+// Parameters: range_begin/range_end - keys to partition, pivot_value - split key,
+//             strict_less - move keys < pivot left (otherwise keys <= pivot)
+// Returns: first position of the right-hand part
+int32_t* branchless_partition_int32(int32_t* range_begin, int32_t* range_end, int32_t pivot_value, bool strict_less) {
+    int32_t* store_position = range_begin;
+    for (int32_t* scan_position = range_begin; scan_position < range_end; ++scan_position) {
+        int32_t scanned_key = *scan_position;
+        bool moves_left = strict_less ? scanned_key < pivot_value : scanned_key <= pivot_value;
+        *scan_position = *store_position;
+        *store_position = scanned_key;
+        store_position += moves_left;
+    }
+    return store_position;
+}
+
+// Function: scalar_small_sort_int32
+// Purpose: Base-case kernel used when no vector unit is available
+void scalar_small_sort_int32(int32_t* data_begin, size_t element_count) {
+    insertion_sort_range(data_begin, data_begin + element_count, ranges::less{});
+}
+
+// Function: scalar_key_range_int32
+// Purpose: Portable min/max reduction; two independent accumulator pairs let the
+//          compiler vectorize it at the baseline ISA
+// Parameters: key_values/element_count - keys to scan (element_count >= 1),
+//             minimum_key/maximum_key - receive the range
+void scalar_key_range_int32(const int32_t* key_values, size_t element_count, int32_t& minimum_key, int32_t& maximum_key) {
+    int32_t even_minimum = key_values[0], odd_minimum = key_values[0];
+    int32_t even_maximum = key_values[0], odd_maximum = key_values[0];
+    size_t key_index = 0;
+    for (; key_index + 2 <= element_count; key_index += 2) {
+        even_minimum = min(even_minimum, key_values[key_index]);
+        even_maximum = max(even_maximum, key_values[key_index]);
+        odd_minimum = min(odd_minimum, key_values[key_index + 1]);
+        odd_maximum = max(odd_maximum, key_values[key_index + 1]);
+    }
+    if (key_index < element_count) {
+        even_minimum = min(even_minimum, key_values[key_index]);
+        even_maximum = max(even_maximum, key_values[key_index]);
+    }
+    minimum_key = min(even_minimum, odd_minimum);
+    maximum_key = max(even_maximum, odd_maximum);
+}
+
+// Function: scalar_vertical_network_int32
+// Purpose: Applies a comparator schedule to 4 segments laid out one per lane -
+//          row r holds element r of every segment, each pair leaves the minimum
+//          in its first row and the maximum in its second
+// Parameters: lane_rows - row-major keys, 4 per row, row_pairs/pair_count - flattened
+//             (minimum row, maximum row) pairs
+void scalar_vertical_network_int32(int32_t* lane_rows, const uint16_t* row_pairs, size_t pair_count) {
+    constexpr size_t VECTOR_LANES = 4;
+    for (size_t pair_index = 0; pair_index < pair_count; pair_index++) {
+        int32_t* minimum_row = lane_rows + row_pairs[2 * pair_index] * VECTOR_LANES;
+        int32_t* maximum_row = lane_rows + row_pairs[2 * pair_index + 1] * VECTOR_LANES;
+        for (size_t lane_index = 0; lane_index < VECTOR_LANES; lane_index++) {
+            int32_t first_key = minimum_row[lane_index];
+            int32_t second_key = maximum_row[lane_index];
+            minimum_row[lane_index] = min(first_key, second_key);
+            maximum_row[lane_index] = max(first_key, second_key);
+        }
+    }
+}
+
+// Function: next_network_size
+// Purpose: Smallest power-of-two network of at least minimum_size covering element_count
+size_t next_network_size(size_t element_count, size_t minimum_size) {
+    size_t network_size = minimum_size;
+    while (network_size < element_count) {
+        network_size *= 2;
+    }
+    return network_size;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// Function: avx2_bitonic_network
+// Purpose: Sorts NetworkSize (8..64) int32 keys held in NetworkSize / 8 AVX2 registers
+template <int NetworkSize>
+__attribute__((target("avx2"))) void avx2_bitonic_network(int32_t* network_data) {
+    constexpr int VECTOR_LANES = 8;
+    constexpr int VECTOR_COUNT = NetworkSize / VECTOR_LANES;
+    const __m256i lane_indices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i zero_vector = _mm256_setzero_si256();
+
+    __m256i network_registers[VECTOR_COUNT];
+    for (int vector_index = 0; vector_index < VECTOR_COUNT; vector_index++) {
+        network_registers[vector_index] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(network_data + vector_index * VECTOR_LANES));
+    }
+
+    for (int merge_width = 2; merge_width <= NetworkSize; merge_width *= 2) {
+        for (int partner_distance = merge_width / 2; partner_distance > 0; partner_distance /= 2) {
+            const __m256i distance_bits = _mm256_set1_epi32(partner_distance);
+            const __m256i width_bits = _mm256_set1_epi32(merge_width);
+            __m256i stage_registers[VECTOR_COUNT];
+            for (int vector_index = 0; vector_index < VECTOR_COUNT; vector_index++) {
+                __m256i partner_vector = partner_distance < VECTOR_LANES
+                    ? _mm256_permutevar8x32_epi32(network_registers[vector_index], _mm256_xor_si256(lane_indices, distance_bits))
+                    : network_registers[vector_index ^ (partner_distance / VECTOR_LANES)];
+                __m256i global_indices = _mm256_add_epi32(lane_indices, _mm256_set1_epi32(vector_index * VECTOR_LANES));
+                __m256i take_maximum = _mm256_xor_si256(
+                    _mm256_cmpeq_epi32(_mm256_and_si256(global_indices, distance_bits), zero_vector),
+                    _mm256_cmpeq_epi32(_mm256_and_si256(global_indices, width_bits), zero_vector));
+                stage_registers[vector_index] = _mm256_blendv_epi8(
+                    _mm256_min_epi32(network_registers[vector_index], partner_vector),
+                    _mm256_max_epi32(network_registers[vector_index], partner_vector), take_maximum);
+            }
+            for (int vector_index = 0; vector_index < VECTOR_COUNT; vector_index++) {
+                network_registers[vector_index] = stage_registers[vector_index];
+            }
+        }
+    }
+
+    for (int vector_index = 0; vector_index < VECTOR_COUNT; vector_index++) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(network_data + vector_index * VECTOR_LANES), network_registers[vector_index]);
+    }
+}
+
+// Function: avx2_small_sort_int32
+// Purpose: Pads up to 64 keys to the next network size and runs the AVX2 network
+__attribute__((target("avx2"))) void avx2_small_sort_int32(int32_t* data_begin, size_t element_count) {
+    if (element_count < 2) {
+        return;
+    }
+    alignas(64) int32_t padded_keys[SIMD_NETWORK_MAXIMUM_SIZE];
+    size_t network_size = next_network_size(element_count, 8);
+    copy(data_begin, data_begin + element_count, padded_keys);
+    fill(padded_keys + element_count, padded_keys + network_size, numeric_limits<int32_t>::max());
+    switch (network_size) {
+        case 8: avx2_bitonic_network<8>(padded_keys); break;
+        case 16: avx2_bitonic_network<16>(padded_keys); break;
+        case 32: avx2_bitonic_network<32>(padded_keys); break;
+        default: avx2_bitonic_network<64>(padded_keys); break;
+    }
+    copy(padded_keys, padded_keys + element_count, data_begin);
+}
+
+// Function: build_avx2_compress_table
+// Purpose: For each 8-bit "goes right" mask, the lane permutation that packs the
+//          left-going lanes first and the right-going lanes after them
+constexpr array<array<int32_t, 8>, 256> build_avx2_compress_table() {
+    array<array<int32_t, 8>, 256> compress_table{};
+    for (int lane_mask = 0; lane_mask < 256; lane_mask++) {
+        int output_lane = 0;
+        for (int lane_index = 0; lane_index < 8; lane_index++) {
+            if (!(lane_mask & (1 << lane_index))) {
+                compress_table[lane_mask][output_lane++] = lane_index;
+            }
+        }
+        for (int lane_index = 0; lane_index < 8; lane_index++) {
+            if (lane_mask & (1 << lane_index)) {
+                compress_table[lane_mask][output_lane++] = lane_index;
+            }
+        }
+    }
+    return compress_table;
+}
+
+constexpr array<array<int32_t, 8>, 256> AVX2_COMPRESS_TABLE = build_avx2_compress_table();
+
+// Function: finish_vector_partition
+// Purpose: Distributes the keys still in flight (saved edge vectors and the unread
+//          tail, copied out beforehand) into the remaining gap
+// Returns: first position of the right-hand part
+int32_t* finish_vector_partition(const int32_t* pending_keys, size_t pending_count, int32_t* write_left,
+                                 int32_t* write_right, int32_t pivot_value, bool strict_less) {
+    for (size_t pending_index = 0; pending_index < pending_count; pending_index++) {
+        int32_t pending_key = pending_keys[pending_index];
+        if (strict_less ? pending_key < pivot_value : pending_key <= pivot_value) {
+            *write_left++ = pending_key;
+        } else {
+            *--write_right = pending_key;
+        }
+    }
+    return write_left;
+}
+
+// Function: avx2_partition_int32
+// Purpose: In-place vectorized partition. One vector is saved from each end to open
+//          a gap; each step reads the side with less free space, so both full-width
+//          stores (left part at the left cursor, right part ending at the right
+//          cursor) only overwrite keys that were already read.
+// Parameters: range_begin/range_end - keys to partition, pivot_value - split key,
+//             strict_less - move keys < pivot left (otherwise keys <= pivot)
+// Returns: first position of the right-hand part
+__attribute__((target("avx2")))
+int32_t* avx2_partition_int32(int32_t* range_begin, int32_t* range_end, int32_t pivot_value, bool strict_less) {
+    constexpr ptrdiff_t VECTOR_LANES = 8;
+    if (range_end - range_begin < 2 * VECTOR_LANES) {
+        return branchless_partition_int32(range_begin, range_end, pivot_value, strict_less);
+    }
+
+    const __m256i pivot_vector = _mm256_set1_epi32(pivot_value);
+    alignas(32) int32_t pending_keys[3 * VECTOR_LANES];
+    copy(range_begin, range_begin + VECTOR_LANES, pending_keys);
+    copy(range_end - VECTOR_LANES, range_end, pending_keys + VECTOR_LANES);
+
+    int32_t* read_left = range_begin + VECTOR_LANES;
+    int32_t* read_right = range_end - VECTOR_LANES;
+    int32_t* write_left = range_begin;
+    int32_t* write_right = range_end;
+
+    while (read_right - read_left >= VECTOR_LANES) {
+        __m256i loaded_keys;
+        if (read_left - write_left <= write_right - read_right) {
+            loaded_keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(read_left));
+            read_left += VECTOR_LANES;
+        } else {
+            read_right -= VECTOR_LANES;
+            loaded_keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(read_right));
+        }
+
+        // Lanes going right: key > pivot, or key >= pivot in strict mode
+        __m256i goes_right = strict_less
+            ? _mm256_xor_si256(_mm256_cmpgt_epi32(pivot_vector, loaded_keys), _mm256_set1_epi32(-1))
+            : _mm256_cmpgt_epi32(loaded_keys, pivot_vector);
+        int right_mask = _mm256_movemask_ps(_mm256_castsi256_ps(goes_right));
+        int right_count = __builtin_popcount(right_mask);
+        __m256i packed_keys = _mm256_permutevar8x32_epi32(
+            loaded_keys, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(AVX2_COMPRESS_TABLE[right_mask].data())));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(write_left), packed_keys);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(write_right - VECTOR_LANES), packed_keys);
+        write_left += VECTOR_LANES - right_count;
+        write_right -= right_count;
+    }
+
+    size_t tail_count = read_right - read_left;
+    copy(read_left, read_right, pending_keys + 2 * VECTOR_LANES);
+    return finish_vector_partition(pending_keys, 2 * VECTOR_LANES + tail_count, write_left, write_right,
+                                   pivot_value, strict_less);
+}
+
+// Function: avx2_key_range_int32
+// Purpose: Min/max reduction over 8-lane vectors, two vectors per iteration
+__attribute__((target("avx2")))
+void avx2_key_range_int32(const int32_t* key_values, size_t element_count, int32_t& minimum_key, int32_t& maximum_key) {
+    constexpr size_t VECTOR_LANES = 8;
+    if (element_count < 2 * VECTOR_LANES) {
+        scalar_key_range_int32(key_values, element_count, minimum_key, maximum_key);
+        return;
+    }
+    __m256i first_vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key_values));
+    __m256i minimum_vectors[2] = {first_vector, first_vector};
+    __m256i maximum_vectors[2] = {first_vector, first_vector};
+    size_t key_index = 0;
+    for (; key_index + 2 * VECTOR_LANES <= element_count; key_index += 2 * VECTOR_LANES) {
+        for (int vector_index = 0; vector_index < 2; vector_index++) {
+            __m256i loaded_keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key_values + key_index + vector_index * VECTOR_LANES));
+            minimum_vectors[vector_index] = _mm256_min_epi32(minimum_vectors[vector_index], loaded_keys);
+            maximum_vectors[vector_index] = _mm256_max_epi32(maximum_vectors[vector_index], loaded_keys);
+        }
+    }
+    alignas(32) int32_t minimum_lanes[VECTOR_LANES];
+    alignas(32) int32_t maximum_lanes[VECTOR_LANES];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(minimum_lanes), _mm256_min_epi32(minimum_vectors[0], minimum_vectors[1]));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(maximum_lanes), _mm256_max_epi32(maximum_vectors[0], maximum_vectors[1]));
+    minimum_key = *min_element(minimum_lanes, minimum_lanes + VECTOR_LANES);
+    maximum_key = *max_element(maximum_lanes, maximum_lanes + VECTOR_LANES);
+    for (; key_index < element_count; key_index++) {
+        minimum_key = min(minimum_key, key_values[key_index]);
+        maximum_key = max(maximum_key, key_values[key_index]);
+    }
+}
+
+// Function: avx2_vertical_network_int32
+// Purpose: Comparator schedule over 8 segments, one 8-lane row per element
+__attribute__((target("avx2")))
+void avx2_vertical_network_int32(int32_t* lane_rows, const uint16_t* row_pairs, size_t pair_count) {
+    constexpr size_t VECTOR_LANES = 8;
+    for (size_t pair_index = 0; pair_index < pair_count; pair_index++) {
+        __m256i* minimum_row = reinterpret_cast<__m256i*>(lane_rows + row_pairs[2 * pair_index] * VECTOR_LANES);
+        __m256i* maximum_row = reinterpret_cast<__m256i*>(lane_rows + row_pairs[2 * pair_index + 1] * VECTOR_LANES);
+        __m256i first_keys = _mm256_loadu_si256(minimum_row);
+        __m256i second_keys = _mm256_loadu_si256(maximum_row);
+        _mm256_storeu_si256(minimum_row, _mm256_min_epi32(first_keys, second_keys));
+        _mm256_storeu_si256(maximum_row, _mm256_max_epi32(first_keys, second_keys));
+    }
+}
+
+// GCC 12 reports the deliberately undefined pass-through operand inside the unmasked
+// AVX-512 min/max/permute intrinsics as uninitialized. The warning is spurious, so it
+// is silenced for the functions that use those intrinsics and nowhere else.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+// Function: avx512_bitonic_network
+// Purpose: Sorts NetworkSize (16..64) int32 keys held in NetworkSize / 16 AVX-512 registers
+template <int NetworkSize>
+__attribute__((target("avx512f"))) void avx512_bitonic_network(int32_t* network_data) {
+    constexpr int VECTOR_LANES = 16;
+    constexpr int VECTOR_COUNT = NetworkSize / VECTOR_LANES;
+    const __m512i lane_indices = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    __m512i network_registers[VECTOR_COUNT];
+    for (int vector_index = 0; vector_index < VECTOR_COUNT; vector_index++) {
+        network_registers[vector_index] = _mm512_loadu_si512(network_data + vector_index * VECTOR_LANES);
+    }
+
+    for (int merge_width = 2; merge_width <= NetworkSize; merge_width *= 2) {
+        for (int partner_distance = merge_width / 2; partner_distance > 0; partner_distance /= 2) {
+            const __m512i distance_bits = _mm512_set1_epi32(partner_distance);
+            const __m512i width_bits = _mm512_set1_epi32(merge_width);
+            __m512i stage_registers[VECTOR_COUNT];
+            for (int vector_index = 0; vector_index < VECTOR_COUNT; vector_index++) {
+                __m512i partner_vector = partner_distance < VECTOR_LANES
+                    ? _mm512_permutexvar_epi32(_mm512_xor_si512(lane_indices, distance_bits), network_registers[vector_index])
+                    : network_registers[vector_index ^ (partner_distance / VECTOR_LANES)];
+                __m512i global_indices = _mm512_add_epi32(lane_indices, _mm512_set1_epi32(vector_index * VECTOR_LANES));
+                __mmask16 take_maximum = _mm512_test_epi32_mask(global_indices, distance_bits) ^
+                                         _mm512_test_epi32_mask(global_indices, width_bits);
+                stage_registers[vector_index] = _mm512_mask_blend_epi32(
+                    take_maximum, _mm512_min_epi32(network_registers[vector_index], partner_vector),
+                    _mm512_max_epi32(network_registers[vector_index], partner_vector));
+            }
+            for (int vector_index = 0; vector_index < VECTOR_COUNT; vector_index++) {
+                network_registers[vector_index] = stage_registers[vector_index];
+            }
+        }
+    }
+
+    for (int vector_index = 0; vector_index < VECTOR_COUNT; vector_index++) {
+        _mm512_storeu_si512(network_data + vector_index * VECTOR_LANES, network_registers[vector_index]);
+    }
+}
+
+// Function: avx512_small_sort_int32
+// Purpose: Pads up to 64 keys to the next network size; 8 or fewer use the AVX2 network
+__attribute__((target("avx512f,avx2"))) void avx512_small_sort_int32(int32_t* data_begin, size_t element_count) {
+    if (element_count <= 8) {
+        avx2_small_sort_int32(data_begin, element_count);
+        return;
+    }
+    alignas(64) int32_t padded_keys[SIMD_NETWORK_MAXIMUM_SIZE];
+    size_t network_size = next_network_size(element_count, 16);
+    copy(data_begin, data_begin + element_count, padded_keys);
+    fill(padded_keys + element_count, padded_keys + network_size, numeric_limits<int32_t>::max());
+    switch (network_size) {
+        case 16: avx512_bitonic_network<16>(padded_keys); break;
+        case 32: avx512_bitonic_network<32>(padded_keys); break;
+        default: avx512_bitonic_network<64>(padded_keys); break;
+    }
+    copy(padded_keys, padded_keys + element_count, data_begin);
+}
+
+#pragma GCC diagnostic pop
+
+// Function: avx512_partition_int32
+// Purpose: Same gap discipline as avx2_partition_int32, with compress stores writing
+//          exactly the lanes of each side
+__attribute__((target("avx512f")))
+int32_t* avx512_partition_int32(int32_t* range_begin, int32_t* range_end, int32_t pivot_value, bool strict_less) {
+    constexpr ptrdiff_t VECTOR_LANES = 16;
+    if (range_end - range_begin < 2 * VECTOR_LANES) {
+        return branchless_partition_int32(range_begin, range_end, pivot_value, strict_less);
+    }
+
+    const __m512i pivot_vector = _mm512_set1_epi32(pivot_value);
+    alignas(64) int32_t pending_keys[3 * VECTOR_LANES];
+    copy(range_begin, range_begin + VECTOR_LANES, pending_keys);
+    copy(range_end - VECTOR_LANES, range_end, pending_keys + VECTOR_LANES);
+
+    int32_t* read_left = range_begin + VECTOR_LANES;
+    int32_t* read_right = range_end - VECTOR_LANES;
+    int32_t* write_left = range_begin;
+    int32_t* write_right = range_end;
+
+    while (read_right - read_left >= VECTOR_LANES) {
+        __m512i loaded_keys;
+        if (read_left - write_left <= write_right - read_right) {
+            loaded_keys = _mm512_loadu_si512(read_left);
+            read_left += VECTOR_LANES;
+        } else {
+            read_right -= VECTOR_LANES;
+            loaded_keys = _mm512_loadu_si512(read_right);
+        }
+
+        __mmask16 goes_right = strict_less ? _mm512_cmpge_epi32_mask(loaded_keys, pivot_vector)
+                                           : _mm512_cmpgt_epi32_mask(loaded_keys, pivot_vector);
+        int right_count = __builtin_popcount(goes_right);
+        _mm512_mask_compressstoreu_epi32(write_left, static_cast<__mmask16>(~goes_right), loaded_keys);
+        _mm512_mask_compressstoreu_epi32(write_right - right_count, goes_right, loaded_keys);
+        write_left += VECTOR_LANES - right_count;
+        write_right -= right_count;
+    }
+
+    size_t tail_count = read_right - read_left;
+    copy(read_left, read_right, pending_keys + 2 * VECTOR_LANES);
+    return finish_vector_partition(pending_keys, 2 * VECTOR_LANES + tail_count, write_left, write_right,
+                                   pivot_value, strict_less);
+}
+
+// Same spurious pass-through warning as the bitonic network, plus the reduce intrinsics
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+// Function: avx512_vertical_network_int32
+// Purpose: Comparator schedule over 16 segments, one 16-lane row per element
+__attribute__((target("avx512f")))
+void avx512_vertical_network_int32(int32_t* lane_rows, const uint16_t* row_pairs, size_t pair_count) {
+    constexpr size_t VECTOR_LANES = 16;
+    for (size_t pair_index = 0; pair_index < pair_count; pair_index++) {
+        int32_t* minimum_row = lane_rows + row_pairs[2 * pair_index] * VECTOR_LANES;
+        int32_t* maximum_row = lane_rows + row_pairs[2 * pair_index + 1] * VECTOR_LANES;
+        __m512i first_keys = _mm512_loadu_si512(minimum_row);
+        __m512i second_keys = _mm512_loadu_si512(maximum_row);
+        _mm512_storeu_si512(minimum_row, _mm512_min_epi32(first_keys, second_keys));
+        _mm512_storeu_si512(maximum_row, _mm512_max_epi32(first_keys, second_keys));
+    }
+}
+
+// Function: avx512_key_range_int32
+// Purpose: Min/max reduction over 16-lane vectors with horizontal reduce intrinsics
+__attribute__((target("avx512f")))
+void avx512_key_range_int32(const int32_t* key_values, size_t element_count, int32_t& minimum_key, int32_t& maximum_key) {
+    constexpr size_t VECTOR_LANES = 16;
+    if (element_count < VECTOR_LANES) {
+        scalar_key_range_int32(key_values, element_count, minimum_key, maximum_key);
+        return;
+    }
+    __m512i minimum_vector = _mm512_loadu_si512(key_values);
+    __m512i maximum_vector = minimum_vector;
+    size_t key_index = VECTOR_LANES;
+    for (; key_index + VECTOR_LANES <= element_count; key_index += VECTOR_LANES) {
+        __m512i loaded_keys = _mm512_loadu_si512(key_values + key_index);
+        minimum_vector = _mm512_min_epi32(minimum_vector, loaded_keys);
+        maximum_vector = _mm512_max_epi32(maximum_vector, loaded_keys);
+    }
+    minimum_key = _mm512_reduce_min_epi32(minimum_vector);
+    maximum_key = _mm512_reduce_max_epi32(maximum_vector);
+    for (; key_index < element_count; key_index++) {
+        minimum_key = min(minimum_key, key_values[key_index]);
+        maximum_key = max(maximum_key, key_values[key_index]);
+    }
+}
+
+#pragma GCC diagnostic pop
+
+#endif  // x86
+
+#if defined(__ARM_NEON)
+
+// Function: neon_bitonic_network
+// Purpose: Sorts NetworkSize (8..64) int32 keys held in NetworkSize / 4 NEON registers
+template <int NetworkSize>
+void neon_bitonic_network(int32_t* network_data) {
+    constexpr int VECTOR_LANES = 4;
+    constexpr int VECTOR_COUNT = NetworkSize / VECTOR_LANES;
+    const uint32_t lane_index_values[VECTOR_LANES] = {0, 1, 2, 3};
+    const uint32x4_t lane_indices = vld1q_u32(lane_index_values);
+
+    int32x4_t network_registers[VECTOR_COUNT];
+    for (int vector_index = 0; vector_index < VECTOR_COUNT; vector_index++) {
+        network_registers[vector_index] = vld1q_s32(network_data + vector_index * VECTOR_LANES);
+    }
+
+    for (int merge_width = 2; merge_width <= NetworkSize; merge_width *= 2) {
+        for (int partner_distance = merge_width / 2; partner_distance > 0; partner_distance /= 2) {
+            int32x4_t stage_registers[VECTOR_COUNT];
+            for (int vector_index = 0; vector_index < VECTOR_COUNT; vector_index++) {
+                int32x4_t current_vector = network_registers[vector_index];
+                int32x4_t partner_vector = partner_distance == 1 ? vrev64q_s32(current_vector)
+                    : partner_distance == 2 ? vextq_s32(current_vector, current_vector, 2)
+                    : network_registers[vector_index ^ (partner_distance / VECTOR_LANES)];
+                uint32x4_t global_indices = vaddq_u32(lane_indices, vdupq_n_u32(vector_index * VECTOR_LANES));
+                uint32x4_t take_maximum = veorq_u32(vtstq_u32(global_indices, vdupq_n_u32(partner_distance)),
+                                                    vtstq_u32(global_indices, vdupq_n_u32(merge_width)));
+                stage_registers[vector_index] = vbslq_s32(take_maximum, vmaxq_s32(current_vector, partner_vector),
+                                                          vminq_s32(current_vector, partner_vector));
+            }
+            for (int vector_index = 0; vector_index < VECTOR_COUNT; vector_index++) {
+                network_registers[vector_index] = stage_registers[vector_index];
+            }
+        }
+    }
+
+    for (int vector_index = 0; vector_index < VECTOR_COUNT; vector_index++) {
+        vst1q_s32(network_data + vector_index * VECTOR_LANES, network_registers[vector_index]);
+    }
+}
+
+// Function: neon_small_sort_int32
+// Purpose: Pads up to 64 keys to the next network size and runs the NEON network
+void neon_small_sort_int32(int32_t* data_begin, size_t element_count) {
+    if (element_count < 2) {
+        return;
+    }
+    alignas(64) int32_t padded_keys[SIMD_NETWORK_MAXIMUM_SIZE];
+    size_t network_size = next_network_size(element_count, 8);
+    copy(data_begin, data_begin + element_count, padded_keys);
+    fill(padded_keys + element_count, padded_keys + network_size, numeric_limits<int32_t>::max());
+    switch (network_size) {
+        case 8: neon_bitonic_network<8>(padded_keys); break;
+        case 16: neon_bitonic_network<16>(padded_keys); break;
+        case 32: neon_bitonic_network<32>(padded_keys); break;
+        default: neon_bitonic_network<64>(padded_keys); break;
+    }
+    copy(padded_keys, padded_keys + element_count, data_begin);
+}
+
+// Function: neon_vertical_network_int32
+// Purpose: Comparator schedule over 4 segments, one 4-lane row per element
+void neon_vertical_network_int32(int32_t* lane_rows, const uint16_t* row_pairs, size_t pair_count) {
+    constexpr size_t VECTOR_LANES = 4;
+    for (size_t pair_index = 0; pair_index < pair_count; pair_index++) {
+        int32_t* minimum_row = lane_rows + row_pairs[2 * pair_index] * VECTOR_LANES;
+        int32_t* maximum_row = lane_rows + row_pairs[2 * pair_index + 1] * VECTOR_LANES;
+        int32x4_t first_keys = vld1q_s32(minimum_row);
+        int32x4_t second_keys = vld1q_s32(maximum_row);
+        vst1q_s32(minimum_row, vminq_s32(first_keys, second_keys));
+        vst1q_s32(maximum_row, vmaxq_s32(first_keys, second_keys));
+    }
+}
+
+// Function: neon_key_range_int32
+// Purpose: Min/max reduction over 4-lane NEON vectors
+void neon_key_range_int32(const int32_t* key_values, size_t element_count, int32_t& minimum_key, int32_t& maximum_key) {
+    constexpr size_t VECTOR_LANES = 4;
+    if (element_count < VECTOR_LANES) {
+        scalar_key_range_int32(key_values, element_count, minimum_key, maximum_key);
+        return;
+    }
+    int32x4_t minimum_vector = vld1q_s32(key_values);
+    int32x4_t maximum_vector = minimum_vector;
+    size_t key_index = VECTOR_LANES;
+    for (; key_index + VECTOR_LANES <= element_count; key_index += VECTOR_LANES) {
+        int32x4_t loaded_keys = vld1q_s32(key_values + key_index);
+        minimum_vector = vminq_s32(minimum_vector, loaded_keys);
+        maximum_vector = vmaxq_s32(maximum_vector, loaded_keys);
+    }
+    minimum_key = vminvq_s32(minimum_vector);
+    maximum_key = vmaxvq_s32(maximum_vector);
+    for (; key_index < element_count; key_index++) {
+        minimum_key = min(minimum_key, key_values[key_index]);
+        maximum_key = max(maximum_key, key_values[key_index]);
+    }
+}
+
+#endif  // __ARM_NEON
+
+// Structure: simd_kernel_table
+// Purpose: Kernels chosen once for the executing CPU
+struct simd_kernel_table {
+    const char* kernel_label;                                  // ISA used by the kernels
+    void (*sort_small)(int32_t* data_begin, size_t element_count);  // Up to SIMD_NETWORK_MAXIMUM_SIZE keys
+    int32_t* (*partition)(int32_t* range_begin, int32_t* range_end, int32_t pivot_value, bool strict_less);
+    void (*key_range)(const int32_t* key_values, size_t element_count, int32_t& minimum_key, int32_t& maximum_key);
+    size_t vertical_lanes;                                     // Segments per vertical network pass
+    void (*vertical_network)(int32_t* lane_rows, const uint16_t* row_pairs, size_t pair_count);
+};
+
+// Function: detect_simd_kernels
+// Purpose: Runtime CPU feature detection - the binary stays baseline x86-64/ARMv8
+// Returns: best kernel table supported by the executing CPU
+simd_kernel_table detect_simd_kernels() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2")) {
+        return {"AVX-512", avx512_small_sort_int32, avx512_partition_int32, avx512_key_range_int32,
+                16, avx512_vertical_network_int32};
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return {"AVX2", avx2_small_sort_int32, avx2_partition_int32, avx2_key_range_int32,
+                8, avx2_vertical_network_int32};
+    }
+#elif defined(__ARM_NEON)
+    return {"NEON", neon_small_sort_int32, branchless_partition_int32, neon_key_range_int32,  // Scalar partition
+            4, neon_vertical_network_int32};
+#endif
+    return {"scalar", scalar_small_sort_int32, branchless_partition_int32, scalar_key_range_int32,
+            4, scalar_vertical_network_int32};
+}
+
+// Function: active_simd_kernels
+// Returns: kernel table detected on first use
+const simd_kernel_table& active_simd_kernels() {
+    static const simd_kernel_table detected_kernels = detect_simd_kernels();
+    return detected_kernels;
+}
+
+// Function: simd_introsort_loop
+// Purpose: Introsort on int32 keys with the vectorized partition and a sorting
+//          network base case. Keys equal to the pivot are peeled off when nothing
+//          lies above it, so runs of duplicates cannot stall the recursion.
+// Parameters: range_begin/range_end - keys to sort, depth_budget - remaining partition
+//             levels, simd_kernels - dispatched kernels
+void simd_introsort_loop(int32_t* range_begin, int32_t* range_end, int depth_budget, const simd_kernel_table& simd_kernels) {
+    while (range_end - range_begin > SIMD_NETWORK_MAXIMUM_SIZE) {
+        if (depth_budget == 0) {
+            introsort_heap_fallback_counter().fetch_add(1, memory_order_relaxed);
+            heap_sort_range(range_begin, range_end, ranges::less{});
+            return;
+        }
+        depth_budget--;
+
+        int32_t pivot_value = select_median_of_three_pivot(range_begin, range_end, ranges::less{});
+        int32_t* split_position = simd_kernels.partition(range_begin, range_end, pivot_value, false);
+        if (split_position == range_end) {
+            // Nothing above the pivot - [keys < pivot | keys == pivot], the right part is final
+            range_end = simd_kernels.partition(range_begin, range_end, pivot_value, true);
+            continue;
+        }
+
+        if (split_position - range_begin < range_end - split_position) {
+            simd_introsort_loop(range_begin, split_position, depth_budget, simd_kernels);
+            range_begin = split_position;
+        } else {
+            simd_introsort_loop(split_position, range_end, depth_budget, simd_kernels);
+            range_end = split_position;
+        }
+    }
+
+    simd_kernels.sort_small(range_begin, range_end - range_begin);
+}
+
+// Function: execute_simd_introsort_algorithm
+// Purpose: Implements vectorized introsort for int32 keys (AVX-512, AVX2 or NEON
+//          kernels picked at runtime, scalar branchless kernels otherwise)
+// Parameters: data_span - int32 keys requiring sorting operation
+void execute_simd_introsort_algorithm(span<int32_t> data_span) {
+    simd_introsort_loop(data_span.data(), data_span.data() + data_span.size(),
+                        compute_introsort_depth_budget(static_cast<ptrdiff_t>(data_span.size())), active_simd_kernels());
+}
+
+// Function: execute_simd_introsort_algorithm (float keys)
+// Purpose: Sorts floats in IEEE totalOrder with the int32 kernels: the ordered key
+//          transform with its top bit flipped is an order-preserving signed int32,
+//          so keys are mapped into scratch, sorted and mapped back
+// Parameters: data_span - float keys requiring sorting operation (NaN and -0.0 allowed)
+void execute_simd_introsort_algorithm(span<float> data_span) {
+    using float_transform = ordered_key_transform<float>;
+    scratch_buffer_lease<int32_t> signed_keys(data_span.size());
+    for (size_t key_index = 0; key_index < data_span.size(); key_index++) {
+        signed_keys[key_index] = static_cast<int32_t>(float_transform::apply(data_span[key_index]) ^ float_transform::sign_bit);
+    }
+    execute_simd_introsort_algorithm(span<int32_t>(signed_keys.data(), signed_keys.size()));
+    for (size_t key_index = 0; key_index < data_span.size(); key_index++) {
+        data_span[key_index] = float_transform::restore(static_cast<uint32_t>(signed_keys[key_index]) ^ float_transform::sign_bit);
+    }
+}
+
+/*
+================================================================================
+RADIX SORT IMPLEMENTATIONS - Distribution sorting for integer keys
+================================================================================
+*/
+
+// Concept: radix_sortable_range
+// Purpose: Radix engines need a random-access range whose projected key is integral
+template <typename RandomIt, typename Projection>
+concept radix_sortable_range = random_access_iterator<RandomIt> &&
+    integral<remove_cvref_t<invoke_result_t<Projection&, iter_reference_t<RandomIt>>>>;
+
+// Concept: key_transform_sortable_range
+// Purpose: LSD/MSD radix engines need a random-access range whose projected key has an
+//          ordered_key_transform - integers, IEEE floats or string prefixes
+template <typename RandomIt, typename Projection>
+concept key_transform_sortable_range = random_access_iterator<RandomIt> &&
+    ordered_key_transformable<remove_cvref_t<invoke_result_t<Projection&, iter_reference_t<RandomIt>>>>;
+
+// Function: radix_key_of
+// Purpose: Maps a key to an unsigned key with identical ordering
+// Parameters: key_value - integral, floating-point or string key
+// Returns: the key's ordered_key_transform (sign bit flipped for signed integers)
+template <typename Key>
+    requires ordered_key_transformable<remove_cvref_t<Key>>
+constexpr auto radix_key_of(const Key& key_value) {
+    return ordered_key_transform<remove_cvref_t<Key>>::apply(key_value);
+}
+
+// Function: refine_inexact_key_ties
+// Purpose: Inexact transforms order ranges only by the packed prefix - sorts every run
+//          of equal transformed keys by the full key. No-op for exact transforms.
+// Parameters: first/last - range in transformed-key order, projection - key extraction,
+//             keep_stable - order the runs with the stable merge sort
+template <typename RandomIt, typename Projection>
+void refine_inexact_key_ties(RandomIt first, RandomIt last, Projection& projection, bool keep_stable) {
+    using key_type = remove_cvref_t<invoke_result_t<Projection&, iter_reference_t<RandomIt>>>;
+    if constexpr (!ordered_key_transform<key_type>::is_exact) {
+        RandomIt run_begin = first;
+        while (run_begin != last) {
+            auto run_key = radix_key_of(invoke(projection, *run_begin));
+            RandomIt run_end = run_begin + 1;
+            while (run_end != last && radix_key_of(invoke(projection, *run_end)) == run_key) {
+                ++run_end;
+            }
+            if (run_end - run_begin > 1) {
+                if (keep_stable) {
+                    execute_merge_sort_algorithm(run_begin, run_end, ranges::less{}, projection);
+                } else {
+                    execute_introsort_algorithm(run_begin, run_end, ranges::less{}, projection);
+                }
+            }
+            run_begin = run_end;
+        }
+    }
+}
+
+// Function: execute_lsd_radix_sort_algorithm
+// Purpose: Implements least-significant-digit radix sort with 8-bit digits,
+//          a single histogram pre-pass and one ping-pong scratch buffer.
+//          Stable; orders ascending by the projected key's ordered transform, with
+//          equal string prefixes finished by a stable comparison sort.
+// Parameters: first/last - random-access range requiring sorting operation,
+//             projection - integral, floating-point or string key extraction
+template <typename RandomIt, typename Projection = identity>
+    requires key_transform_sortable_range<RandomIt, Projection>
+void execute_lsd_radix_sort_algorithm(RandomIt first, RandomIt last, Projection projection = {}) {
+    using element_type = iter_value_t<RandomIt>;
+    using key_type = remove_cvref_t<invoke_result_t<Projection&, iter_reference_t<RandomIt>>>;
+    constexpr int digit_passes = sizeof(typename ordered_key_transform<key_type>::ordered_type) * 8 / RADIX_DIGIT_BITS;
+
+    size_t array_length = last - first;  // Cache range size for optimization
+    if (array_length < 2) {
+        return;  // Nothing to distribute
+    }
+    auto digit_of = [&projection](const element_type& element, int digit_shift) {
+        return (radix_key_of(invoke(projection, element)) >> digit_shift) & RADIX_DIGIT_MASK;
+    };
+
+    // Pre-pass: build the histograms of every digit position in one sweep
+    size_t digit_histograms[digit_passes][RADIX_BUCKET_COUNT] = {};
+    for (RandomIt element_position = first; element_position != last; ++element_position) {
+        auto radix_key = radix_key_of(invoke(projection, *element_position));
+        for (int digit_position = 0; digit_position < digit_passes; digit_position++) {
+            digit_histograms[digit_position][(radix_key >> (digit_position * RADIX_DIGIT_BITS)) & RADIX_DIGIT_MASK]++;
+        }
+    }
+
+    scratch_buffer_lease<element_type> scratch_buffer(array_length);  // Single scratch borrow for all passes
+    bool result_in_scratch = false;
+    // Probe key for the skip test, read before any pass leaves *first moved-from
+    auto probe_key = radix_key_of(invoke(projection, *first));
+
+    // Stable scatter of one digit from a source buffer into a target buffer
+    auto scatter_digit = [&](auto source_begin, auto target_begin, size_t* digit_offsets, int digit_shift) {
+        for (size_t element_index = 0; element_index < array_length; element_index++) {
+            auto& element = source_begin[element_index];
+            target_begin[digit_offsets[digit_of(element, digit_shift)]++] = move(element);
+        }
+    };
+
+    // Scatter pass per digit, least significant first
+    for (int digit_position = 0; digit_position < digit_passes; digit_position++) {
+        size_t* digit_histogram = digit_histograms[digit_position];
+        int digit_shift = digit_position * RADIX_DIGIT_BITS;
+
+        // Skip passes where every key shares the same digit - ordering is unchanged
+        if (digit_histogram[(probe_key >> digit_shift) & RADIX_DIGIT_MASK] == array_length) {
+            continue;
+        }
+
+        // Convert bucket counts into exclusive prefix offsets
+        size_t running_offset = 0;
+        for (int bucket_index = 0; bucket_index < RADIX_BUCKET_COUNT; bucket_index++) {
+            size_t bucket_count = digit_histogram[bucket_index];
+            digit_histogram[bucket_index] = running_offset;
+            running_offset += bucket_count;
+        }
+
+        if (result_in_scratch) {
+            scatter_digit(scratch_buffer.begin(), first, digit_histogram, digit_shift);
+        } else {
+            scatter_digit(first, scratch_buffer.begin(), digit_histogram, digit_shift);
+        }
+        result_in_scratch = !result_in_scratch;  // Scattered output feeds the next pass
+    }
+
+    // Odd number of executed passes - move the result back into the caller's range
+    if (result_in_scratch) {
+        move(scratch_buffer.begin(), scratch_buffer.end(), first);
+    }
+    refine_inexact_key_ties(first, last, projection, true);
+}
+
+template <typename Element, typename Projection = identity>
+    requires key_transform_sortable_range<typename span<Element>::iterator, Projection>
+void execute_lsd_radix_sort_algorithm(span<Element> data_span, Projection projection = {}) {
+    execute_lsd_radix_sort_algorithm(data_span.begin(), data_span.end(), projection);
+}
+
+// Function: msd_radix_sort_range
+// Purpose: In-place MSD radix (American flag) sort of one range at one digit position
+// Parameters: range_begin/range_end - range bounds, digit_shift - bit offset of the digit
+//             currently distributed, projection - transformable key extraction
+template <typename RandomIt, typename Projection>
+void msd_radix_sort_range(RandomIt range_begin, RandomIt range_end, int digit_shift, Projection& projection) {
+    // Small buckets are cheaper to finish with insertion sort
+    ptrdiff_t range_length = range_end - range_begin;
+    if (range_length <= MSD_RADIX_INSERTION_THRESHOLD) {
+        insertion_sort_range(range_begin, range_end, make_element_comparator(ordered_key_less{}, projection));
+        return;
+    }
+    auto digit_of = [&projection](const iter_value_t<RandomIt>& element, int current_shift) {
+        return static_cast<int>((radix_key_of(invoke(projection, element)) >> current_shift) & RADIX_DIGIT_MASK);
+    };
+
+    // Descend past digits that are constant across the whole range
+    ptrdiff_t bucket_counts[RADIX_BUCKET_COUNT];
+    while (true) {
+        fill(begin(bucket_counts), end(bucket_counts), 0);
+        for (RandomIt element_position = range_begin; element_position != range_end; ++element_position) {
+            bucket_counts[digit_of(*element_position, digit_shift)]++;
+        }
+        if (bucket_counts[digit_of(*range_begin, digit_shift)] != range_length) {
+            break;  // Digit actually splits the range
+        }
+        if (digit_shift == 0) {
+            refine_inexact_key_ties(range_begin, range_end, projection, false);
+            return;  // All transformed keys identical - range already sorted
+        }
+        digit_shift -= RADIX_DIGIT_BITS;
+    }
+
+    // Compute bucket boundaries within the range
+    ptrdiff_t bucket_begin[RADIX_BUCKET_COUNT];
+    ptrdiff_t bucket_next[RADIX_BUCKET_COUNT];
+    ptrdiff_t running_offset = 0;
+    for (int bucket_index = 0; bucket_index < RADIX_BUCKET_COUNT; bucket_index++) {
+        bucket_begin[bucket_index] = running_offset;
+        bucket_next[bucket_index] = running_offset;
+        running_offset += bucket_counts[bucket_index];
+    }
+
+    // Cycle-leader permutation: move every element straight into its bucket
+    for (int bucket_index = 0; bucket_index < RADIX_BUCKET_COUNT; bucket_index++) {
+        ptrdiff_t bucket_end = bucket_begin[bucket_index] + bucket_counts[bucket_index];
+        while (bucket_next[bucket_index] < bucket_end) {
+            auto travelling_value = move(range_begin[bucket_next[bucket_index]]);
+            int target_bucket = digit_of(travelling_value, digit_shift);
+
+            // Keep swapping until an element belonging to this bucket arrives
+            while (target_bucket != bucket_index) {
+                swap(travelling_value, range_begin[bucket_next[target_bucket]++]);
+                target_bucket = digit_of(travelling_value, digit_shift);
+            }
+            range_begin[bucket_next[bucket_index]++] = move(travelling_value);
+        }
+    }
+
+    // Recurse into every bucket on the next lower digit
+    if (digit_shift == 0) {
+        refine_inexact_key_ties(range_begin, range_end, projection, false);
+        return;  // Last digit distributed - buckets hold identical transformed keys
+    }
+    for (int bucket_index = 0; bucket_index < RADIX_BUCKET_COUNT; bucket_index++) {
+        if (bucket_counts[bucket_index] > 1) {
+            msd_radix_sort_range(range_begin + bucket_begin[bucket_index],
+                                 range_begin + bucket_begin[bucket_index] + bucket_counts[bucket_index],
+                                 digit_shift - RADIX_DIGIT_BITS, projection);
+        }
+    }
+}
+
+// Function: execute_msd_radix_sort_algorithm
+// Purpose: Implements most-significant-digit radix sort with insertion sort for small buckets
+// Parameters: first/last - random-access range requiring sorting operation,
+//             projection - integral, floating-point or string key extraction
+template <typename RandomIt, typename Projection = identity>
+    requires key_transform_sortable_range<RandomIt, Projection>
+void execute_msd_radix_sort_algorithm(RandomIt first, RandomIt last, Projection projection = {}) {
+    using key_type = remove_cvref_t<invoke_result_t<Projection&, iter_reference_t<RandomIt>>>;
+    using ordered_type = typename ordered_key_transform<key_type>::ordered_type;
+    msd_radix_sort_range(first, last, static_cast<int>(sizeof(ordered_type) * 8) - RADIX_DIGIT_BITS, projection);
+}
+
+template <typename Element, typename Projection = identity>
+    requires key_transform_sortable_range<typename span<Element>::iterator, Projection>
+void execute_msd_radix_sort_algorithm(span<Element> data_span, Projection projection = {}) {
+    execute_msd_radix_sort_algorithm(data_span.begin(), data_span.end(), projection);
+}
+
+/*
+================================================================================
+INDIRECT SORTING - Argsort, packed key/index radix sort and permutation gather
+================================================================================
+*/
+
+// Function: execute_argsort_algorithm
+// Purpose: Comparison-based argsort - merge-sorts 32-bit indices by the projected
+//          key, leaving the records untouched. Stable.
+// Parameters: data_span - records to rank (at most 2^32 - 1),
+//             comparator - key ordering, projection - key extraction
+// Returns: permutation p with data_span[p[0]] <= data_span[p[1]] <= ...
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+vector<uint32_t> execute_argsort_algorithm(span<const Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    vector<uint32_t> sorted_permutation(data_span.size());
+    iota(sorted_permutation.begin(), sorted_permutation.end(), uint32_t{0});
+    execute_merge_sort_algorithm(span<uint32_t>(sorted_permutation), comparator,
+                                 [&](uint32_t record_index) -> decltype(auto) { return invoke(projection, data_span[record_index]); });
+    return sorted_permutation;
+}
+
+// Concept: packed_index_sortable
+// Purpose: Packed key/index sorting needs an integral key of at most 32 bits
+template <typename Element, typename Projection>
+concept packed_index_sortable = integral<remove_cvref_t<invoke_result_t<Projection&, const Element&>>> &&
+    sizeof(remove_cvref_t<invoke_result_t<Projection&, const Element&>>) <= sizeof(uint32_t);
+
+// Function: execute_packed_key_index_argsort
+// Purpose: Argsort by packing (order-preserving key << 32 | index) into one uint64_t
+//          and radix-sorting only the key half - four 8-bit passes over 8-byte
+//          values instead of moving whole records. Stable, since indices start ascending.
+// Parameters: data_span - records to rank (at most 2^32 - 1), projection - key extraction
+// Returns: permutation p with data_span[p[0]] <= data_span[p[1]] <= ...
+template <typename Element, typename Projection = identity>
+    requires packed_index_sortable<Element, Projection>
+vector<uint32_t> execute_packed_key_index_argsort(span<const Element> data_span, Projection projection = {}) {
+    vector<uint64_t> packed_pairs(data_span.size());
+    for (size_t record_index = 0; record_index < data_span.size(); record_index++) {
+        uint32_t ordered_key = radix_key_of(invoke(projection, data_span[record_index]));
+        packed_pairs[record_index] = (uint64_t(ordered_key) << 32) | record_index;
+    }
+    execute_lsd_radix_sort_algorithm(span<uint64_t>(packed_pairs),
+                                     [](uint64_t packed_pair) { return static_cast<uint32_t>(packed_pair >> 32); });
+
+    vector<uint32_t> sorted_permutation(packed_pairs.size());
+    for (size_t pair_index = 0; pair_index < packed_pairs.size(); pair_index++) {
+        sorted_permutation[pair_index] = static_cast<uint32_t>(packed_pairs[pair_index]);
+    }
+    return sorted_permutation;
+}
+
+// Function: prefetch_record_lines
+// Purpose: Requests every cache line of one record ahead of its copy
+template <typename Element>
+inline void prefetch_record_lines(const Element* record_address) {
+    const char* record_bytes = reinterpret_cast<const char*>(record_address);
+    for (size_t line_offset = 0; line_offset < sizeof(Element); line_offset += 64) {
+        __builtin_prefetch(record_bytes + line_offset, 0, 0);
+    }
+}
+
+// Function: gather_by_permutation
+// Purpose: Cache-blocked gather target[i] = source[permutation[i]]. The output is cut
+//          into blocks of INDIRECT_GATHER_BLOCK_BYTES; the scattered source records of
+//          block b + 1 are prefetched while block b is copied, so the random reads
+//          overlap the sequential writes instead of stalling on each record.
+// Parameters: source_span - unsorted records, sorted_permutation - argsort result,
+//             target_span - destination (distinct from source_span)
+template <typename Element>
+void gather_by_permutation(span<const Element> source_span, span<const uint32_t> sorted_permutation, span<Element> target_span) {
+    const size_t block_length = max<size_t>(1, INDIRECT_GATHER_BLOCK_BYTES / sizeof(Element));
+    size_t total_length = sorted_permutation.size();
+    auto prefetch_block = [&](size_t block_begin) {
+        for (size_t element_index = block_begin; element_index < min(block_begin + block_length, total_length); element_index++) {
+            prefetch_record_lines(&source_span[sorted_permutation[element_index]]);
+        }
+    };
+
+    prefetch_block(0);
+    for (size_t block_begin = 0; block_begin < total_length; block_begin += block_length) {
+        prefetch_block(block_begin + block_length);
+        size_t block_end = min(block_begin + block_length, total_length);
+        for (size_t element_index = block_begin; element_index < block_end; element_index++) {
+            target_span[element_index] = source_span[sorted_permutation[element_index]];
+        }
+    }
+}
+
+// Function: execute_indirect_radix_sort_algorithm
+// Purpose: Sorts large records by packed key/index radix sort, one gather into
+//          scratch and one sequential copy back - each record moves twice in total
+// Parameters: data_span - records requiring sorting operation, projection - key extraction
+template <typename Element, typename Projection = identity>
+    requires packed_index_sortable<Element, Projection>
+void execute_indirect_radix_sort_algorithm(span<Element> data_span, Projection projection = {}) {
+    vector<uint32_t> sorted_permutation = execute_packed_key_index_argsort(span<const Element>(data_span), projection);
+    scratch_buffer_lease<Element> gathered_records(data_span.size());
+    gather_by_permutation(span<const Element>(data_span), span<const uint32_t>(sorted_permutation),
+                          span<Element>(gathered_records.data(), gathered_records.size()));
+    copy(gathered_records.begin(), gathered_records.end(), data_span.begin());
+}
+
+// Function: execute_indirect_argsort_algorithm
+// Purpose: Comparison-based counterpart - argsort, gather, copy back
+// Parameters: data_span - records requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_indirect_argsort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    vector<uint32_t> sorted_permutation = execute_argsort_algorithm(span<const Element>(data_span), comparator, projection);
+    scratch_buffer_lease<Element> gathered_records(data_span.size());
+    gather_by_permutation(span<const Element>(data_span), span<const uint32_t>(sorted_permutation),
+                          span<Element>(gathered_records.data(), gathered_records.size()));
+    copy(gathered_records.begin(), gathered_records.end(), data_span.begin());
+}
+
+/*
+================================================================================
+PARALLEL EXECUTION INFRASTRUCTURE - Work-stealing scheduler and parallel engines
+================================================================================
+*/
+
+// Class: work_stealing_thread_pool
+// Purpose: Fixed set of worker threads, each owning a task deque. Owners push and
+//          pop at the back (LIFO, cache-warm), idle workers steal from the front.
+class work_stealing_thread_pool {
+public:
+    // Constructor: spawns worker_count threads (at least one), each pinned to its own
+    //              CPU slot when pin_workers is set
+    explicit work_stealing_thread_pool(unsigned worker_count, bool pin_workers = false) {
+        worker_count = max(1u, worker_count);
+        for (unsigned worker_index = 0; worker_index < worker_count; worker_index++) {
+            worker_queues.push_back(make_unique<worker_task_queue>());
+        }
+        for (unsigned worker_index = 0; worker_index < worker_count; worker_index++) {
+            worker_threads.emplace_back([this, worker_index, pin_workers] {
+                if (pin_workers) {
+                    pin_calling_thread(worker_index);
+                }
+                run_worker_loop(worker_index);
+            });
+        }
+    }
+
+    // Destructor: signals shutdown and joins every worker
+    ~work_stealing_thread_pool() {
+        {
+            lock_guard<mutex> idle_lock(idle_mutex);
+            shutdown_requested = true;
+        }
+        idle_condition.notify_all();
+        for (auto& worker_thread : worker_threads) {
+            worker_thread.join();
+        }
+    }
+
+    work_stealing_thread_pool(const work_stealing_thread_pool&) = delete;
+    work_stealing_thread_pool& operator=(const work_stealing_thread_pool&) = delete;
+
+    // Function: worker_count
+    // Returns: number of worker threads owned by the pool
+    unsigned worker_count() const {
+        return static_cast<unsigned>(worker_threads.size());
+    }
+
+    // Function: submit
+    // Purpose: Queues a task on the calling worker's deque, or round-robin for external threads
+    // Parameters: task - callable executed exactly once on some worker
+    void submit(function<void()> task) {
+        unsigned queue_index = (current_pool == this)
+            ? current_worker_index
+            : injection_cursor.fetch_add(1, memory_order_relaxed) % worker_queues.size();
+        {
+            lock_guard<mutex> queue_lock(worker_queues[queue_index]->queue_mutex);
+            worker_queues[queue_index]->pending_tasks.push_back(move(task));
+        }
+        queued_task_count.fetch_add(1, memory_order_release);
+        {
+            lock_guard<mutex> idle_lock(idle_mutex);  // Pairs with predicate check in idle wait
+        }
+        idle_condition.notify_one();
+    }
+
+    // Function: try_execute_one_task
+    // Purpose: Runs one task from the local deque or, failing that, steals one
+    // Returns: true when a task was executed
+    bool try_execute_one_task() {
+        function<void()> task;
+        if (!try_acquire_task(task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+    // Function: is_worker_thread
+    // Returns: true when called from one of this pool's workers
+    bool is_worker_thread() const {
+        return current_pool == this;
+    }
+
+private:
+    // Structure: worker_task_queue
+    // Purpose: Mutex-protected deque owned by one worker
+    struct worker_task_queue {
+        mutex queue_mutex;
+        deque<function<void()>> pending_tasks;
+    };
+
+    // Function: try_acquire_task
+    // Purpose: Pops from own deque back, otherwise steals from the front of a victim
+    bool try_acquire_task(function<void()>& task) {
+        if (queued_task_count.load(memory_order_acquire) == 0) {
+            return false;  // Cheap exit when the whole pool is idle
+        }
+
+        size_t queue_total = worker_queues.size();
+        size_t home_index = (current_pool == this) ? current_worker_index : 0;
+
+        // Owner end of the local deque first
+        if (current_pool == this) {
+            worker_task_queue& home_queue = *worker_queues[home_index];
+            lock_guard<mutex> queue_lock(home_queue.queue_mutex);
+            if (!home_queue.pending_tasks.empty()) {
+                task = move(home_queue.pending_tasks.back());
+                home_queue.pending_tasks.pop_back();
+                queued_task_count.fetch_sub(1, memory_order_relaxed);
+                return true;
+            }
+        }
+
+        // Steal the oldest (typically largest) task from another deque
+        for (size_t probe_offset = 1; probe_offset <= queue_total; probe_offset++) {
+            worker_task_queue& victim_queue = *worker_queues[(home_index + probe_offset) % queue_total];
+            lock_guard<mutex> queue_lock(victim_queue.queue_mutex);
+            if (!victim_queue.pending_tasks.empty()) {
+                task = move(victim_queue.pending_tasks.front());
+                victim_queue.pending_tasks.pop_front();
+                queued_task_count.fetch_sub(1, memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Function: run_worker_loop
+    // Purpose: Worker main loop - execute or steal tasks, sleep when the pool is empty
+    void run_worker_loop(unsigned worker_index) {
+        current_pool = this;
+        current_worker_index = worker_index;
+
+        while (true) {
+            if (try_execute_one_task()) {
+                continue;
+            }
+            unique_lock<mutex> idle_lock(idle_mutex);
+            idle_condition.wait(idle_lock, [this] {
+                return shutdown_requested || queued_task_count.load(memory_order_acquire) > 0;
+            });
+            if (shutdown_requested && queued_task_count.load(memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+
+    vector<unique_ptr<worker_task_queue>> worker_queues;  // One deque per worker
+    vector<thread> worker_threads;                        // Worker thread handles
+    atomic<size_t> queued_task_count{0};                  // Tasks waiting in any deque
+    atomic<unsigned> injection_cursor{0};                 // Round-robin target for external submits
+    mutex idle_mutex;                                     // Guards sleeping workers
+    condition_variable idle_condition;                    // Wakes sleeping workers
+    bool shutdown_requested = false;                      // Set once by the destructor
+
+    static thread_local work_stealing_thread_pool* current_pool;  // Pool owning this thread
+    static thread_local unsigned current_worker_index;            // Worker slot of this thread
+};
+
+thread_local work_stealing_thread_pool* work_stealing_thread_pool::current_pool = nullptr;
+thread_local unsigned work_stealing_thread_pool::current_worker_index = 0;
+
+// Class: parallel_task_group
+// Purpose: Fork-join scope - tracks spawned tasks and waits for all of them.
+//          Workers keep executing tasks while they wait, external threads block.
+class parallel_task_group {
+public:
+    explicit parallel_task_group(work_stealing_thread_pool& owning_pool) : thread_pool(owning_pool) {}
+
+    parallel_task_group(const parallel_task_group&) = delete;
+    parallel_task_group& operator=(const parallel_task_group&) = delete;
+
+    // Function: run
+    // Purpose: Spawns a task belonging to this group
+    // Parameters: task - callable executed asynchronously on the pool
+    void run(function<void()> task) {
+        outstanding_task_count.fetch_add(1, memory_order_relaxed);
+        thread_pool.submit([this, task = move(task)] {
+            task();
+            lock_guard<mutex> completion_lock(completion_mutex);
+            if (outstanding_task_count.fetch_sub(1, memory_order_acq_rel) == 1) {
+                completion_condition.notify_all();
+            }
+        });
+    }
+
+    // Function: wait
+    // Purpose: Blocks until every task spawned through this group has finished
+    void wait() {
+        if (thread_pool.is_worker_thread()) {
+            // Help the pool instead of blocking a worker slot
+            while (outstanding_task_count.load(memory_order_acquire) != 0) {
+                if (!thread_pool.try_execute_one_task()) {
+                    this_thread::yield();
+                }
+            }
+        }
+        unique_lock<mutex> completion_lock(completion_mutex);
+        completion_condition.wait(completion_lock, [this] {
+            return outstanding_task_count.load(memory_order_acquire) == 0;
+        });
+    }
+
+private:
+    work_stealing_thread_pool& thread_pool;     // Pool executing the tasks
+    atomic<size_t> outstanding_task_count{0};   // Spawned but unfinished tasks
+    mutex completion_mutex;                     // Guards completion signalling
+    condition_variable completion_condition;    // Signals the last completion
+};
+
+// Function: shared_thread_pool
+// Purpose: Returns the process-wide pool used by the parallel engines
+// Returns: pool sized by the run configuration (hardware concurrency by default)
+work_stealing_thread_pool& shared_thread_pool() {
+    static work_stealing_thread_pool process_pool(active_run_configuration().resolved_thread_count(),
+                                                  active_run_configuration().pin_threads);
+    return process_pool;
+}
+
+// Function: parallel_quicksort_task
+// Purpose: Partitions in the calling task and spawns the smaller side until the
+//          range drops below the sequential cutoff
+// Parameters: range_begin/range_end - range bounds, depth_budget - remaining partition
+//             levels, less_than - element comparator, task_group - fork-join scope
+template <typename RandomIt, typename LessThan>
+void parallel_quicksort_task(RandomIt range_begin, RandomIt range_end, int depth_budget,
+                             LessThan less_than, parallel_task_group& task_group) {
+    while (range_end - range_begin > PARALLEL_SEQUENTIAL_CUTOFF) {
+        if (depth_budget == 0) {
+            introsort_heap_fallback_counter().fetch_add(1, memory_order_relaxed);
+            heap_sort_range(range_begin, range_end, less_than);
+            return;
+        }
+        depth_budget--;
+
+        auto pivot_value = select_median_of_three_pivot(range_begin, range_end, less_than);
+        RandomIt split_position = hoare_partition_range(range_begin, range_end, pivot_value, less_than);
+
+        // Spawn the smaller side, keep the larger side on this task
+        RandomIt spawn_begin = range_begin;
+        RandomIt spawn_end = split_position;
+        if (split_position - range_begin < range_end - split_position) {
+            range_begin = split_position;
+        } else {
+            spawn_begin = split_position;
+            spawn_end = range_end;
+            range_end = split_position;
+        }
+        task_group.run([spawn_begin, spawn_end, depth_budget, less_than, &task_group] {
+            parallel_quicksort_task(spawn_begin, spawn_end, depth_budget, less_than, task_group);
+        });
+    }
+
+    introsort_partition_loop(range_begin, range_end, depth_budget, less_than);
+}
+
+// Function: parallel_quicksort_with_pool
+// Purpose: Parallel quicksort on an explicit pool
+// Parameters: first/last - range to sort, thread_pool - pool executing the tasks,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void parallel_quicksort_with_pool(RandomIt first, RandomIt last, work_stealing_thread_pool& thread_pool,
+                                  Compare comparator = {}, Projection projection = {}) {
+    auto less_than = make_element_comparator(comparator, projection);
+    parallel_task_group task_group(thread_pool);
+    task_group.run([first, last, less_than, &task_group] {
+        parallel_quicksort_task(first, last, compute_introsort_depth_budget(last - first), less_than, task_group);
+    });
+    task_group.wait();
+}
+
+// Function: execute_parallel_quicksort_algorithm
+// Purpose: Implements work-stealing parallel quicksort on the shared pool
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_parallel_quicksort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    parallel_quicksort_with_pool(first, last, shared_thread_pool(), comparator, projection);
+}
+
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_parallel_quicksort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_parallel_quicksort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
+// Function: find_merge_path_split
+// Purpose: Locates where an output diagonal crosses the merge path of two sorted runs
+// Parameters: left_run/right_run - run starts, left_length/right_length - run sizes,
+//             diagonal - output position, less_than - element comparator
+// Returns: number of left-run elements that precede the diagonal (ties favour left)
+template <typename RandomIt, typename LessThan>
+ptrdiff_t find_merge_path_split(RandomIt left_run, ptrdiff_t left_length, RandomIt right_run,
+                                ptrdiff_t right_length, ptrdiff_t diagonal, LessThan less_than) {
+    ptrdiff_t lower_bound_index = max<ptrdiff_t>(0, diagonal - right_length);
+    ptrdiff_t upper_bound_index = min(diagonal, left_length);
+
+    // Binary search along the diagonal for the first left element that must wait
+    while (lower_bound_index < upper_bound_index) {
+        ptrdiff_t probe_index = lower_bound_index + (upper_bound_index - lower_bound_index) / 2;
+        if (!less_than(right_run[diagonal - probe_index - 1], left_run[probe_index])) {
+            lower_bound_index = probe_index + 1;
+        } else {
+            upper_bound_index = probe_index;
+        }
+    }
+    return lower_bound_index;
+}
+
+// Function: parallel_merge_path_merge
+// Purpose: Merges two adjacent sorted runs by cutting the output into equal slices,
+//          each located via merge path and merged as an independent task
+// Parameters: source_begin - buffer holding [left_begin, left_end) and [left_end, right_end),
+//             target_begin - destination buffer, less_than - element comparator,
+//             task_group - fork-join scope
+template <typename SourceIt, typename TargetIt, typename LessThan>
+void parallel_merge_path_merge(SourceIt source_begin, TargetIt target_begin, ptrdiff_t left_begin,
+                               ptrdiff_t left_end, ptrdiff_t right_end, LessThan less_than,
+                               parallel_task_group& task_group) {
+    ptrdiff_t output_length = right_end - left_begin;
+    ptrdiff_t slice_count = max<ptrdiff_t>(1, output_length / PARALLEL_MERGE_GRAIN);
+
+    for (ptrdiff_t slice_index = 0; slice_index < slice_count; slice_index++) {
+        ptrdiff_t diagonal_begin = output_length * slice_index / slice_count;
+        ptrdiff_t diagonal_end = output_length * (slice_index + 1) / slice_count;
+
+        task_group.run([=] {
+            // Each slice finds its own boundaries so split searches also run in parallel
+            SourceIt left_run = source_begin + left_begin;
+            SourceIt right_run = source_begin + left_end;
+            ptrdiff_t left_length = left_end - left_begin;
+            ptrdiff_t right_length = right_end - left_end;
+            ptrdiff_t left_taken_begin = find_merge_path_split(left_run, left_length, right_run, right_length,
+                                                               diagonal_begin, less_than);
+            ptrdiff_t left_taken_end = find_merge_path_split(left_run, left_length, right_run, right_length,
+                                                             diagonal_end, less_than);
+
+            merge(make_move_iterator(left_run + left_taken_begin),
+                  make_move_iterator(left_run + left_taken_end),
+                  make_move_iterator(right_run + (diagonal_begin - left_taken_begin)),
+                  make_move_iterator(right_run + (diagonal_end - left_taken_end)),
+                  target_begin + left_begin + diagonal_begin, less_than);
+        });
+    }
+}
+
+// Function: parallel_merge_sort_with_pool
+// Purpose: Sorts worker-sized chunks in parallel, then merges them pairwise with
+//          parallel merge-path merges through one scratch buffer
+// Parameters: first/last - range to sort, thread_pool - pool executing the tasks,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void parallel_merge_sort_with_pool(RandomIt first, RandomIt last, work_stealing_thread_pool& thread_pool,
+                                   Compare comparator = {}, Projection projection = {}) {
+    auto less_than = make_element_comparator(comparator, projection);
+    ptrdiff_t array_length = last - first;
+    if (array_length <= PARALLEL_SEQUENTIAL_CUTOFF) {
+        execute_introsort_algorithm(first, last, comparator, projection);
+        return;
+    }
+
+    // Several chunks per worker give the stealing scheduler room to balance load
+    ptrdiff_t chunk_target = static_cast<ptrdiff_t>(thread_pool.worker_count()) * 4;
+    ptrdiff_t chunk_length = max<ptrdiff_t>(PARALLEL_SEQUENTIAL_CUTOFF, (array_length + chunk_target - 1) / chunk_target);
+
+    parallel_task_group task_group(thread_pool);
+    for (ptrdiff_t chunk_begin = 0; chunk_begin < array_length; chunk_begin += chunk_length) {
+        ptrdiff_t chunk_end = min(chunk_begin + chunk_length, array_length);
+        task_group.run([first, chunk_begin, chunk_end, less_than] {
+            introsort_partition_loop(first + chunk_begin, first + chunk_end,
+                                     compute_introsort_depth_budget(chunk_end - chunk_begin), less_than);
+        });
+    }
+    task_group.wait();
+
+    scratch_buffer_lease<iter_value_t<RandomIt>> scratch_buffer(array_length);  // Single scratch borrow for all rounds
+    bool result_in_scratch = false;
+
+    // Merge rounds double the run width until one run remains
+    for (ptrdiff_t run_width = chunk_length; run_width < array_length; run_width *= 2) {
+        for (ptrdiff_t left_begin = 0; left_begin < array_length; left_begin += 2 * run_width) {
+            ptrdiff_t left_end = min(left_begin + run_width, array_length);
+            ptrdiff_t right_end = min(left_begin + 2 * run_width, array_length);
+            if (result_in_scratch) {
+                parallel_merge_path_merge(scratch_buffer.begin(), first, left_begin, left_end, right_end,
+                                          less_than, task_group);
+            } else {
+                parallel_merge_path_merge(first, scratch_buffer.begin(), left_begin, left_end, right_end,
+                                          less_than, task_group);
+            }
+        }
+        task_group.wait();
+        result_in_scratch = !result_in_scratch;
+    }
+
+    // Odd round count - move the result back in parallel slices
+    if (result_in_scratch) {
+        for (ptrdiff_t slice_begin = 0; slice_begin < array_length; slice_begin += PARALLEL_MERGE_GRAIN) {
+            ptrdiff_t slice_end = min<ptrdiff_t>(slice_begin + PARALLEL_MERGE_GRAIN, array_length);
+            task_group.run([&scratch_buffer, first, slice_begin, slice_end] {
+                move(scratch_buffer.begin() + slice_begin, scratch_buffer.begin() + slice_end, first + slice_begin);
+            });
+        }
+        task_group.wait();
+    }
+}
+
+// Function: execute_parallel_merge_sort_algorithm
+// Purpose: Implements parallel merge sort with merge-path merging on the shared pool
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_parallel_merge_sort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    parallel_merge_sort_with_pool(first, last, shared_thread_pool(), comparator, projection);
+}
+
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_parallel_merge_sort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_parallel_merge_sort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
+// Function: find_projected_key_range
+// Purpose: Single min/max pass over the projected keys; contiguous int32 ranges with
+//          the identity projection run the active SIMD kernel
+// Parameters: first/last - non-empty range, projection - integral key extraction
+// Returns: smallest and largest key
+template <typename RandomIt, typename Projection>
+    requires radix_sortable_range<RandomIt, Projection>
+auto find_projected_key_range(RandomIt first, RandomIt last, Projection projection) {
+    using key_type = remove_cvref_t<invoke_result_t<Projection&, iter_reference_t<RandomIt>>>;
+    if constexpr (contiguous_iterator<RandomIt> && is_same_v<iter_value_t<RandomIt>, int32_t> &&
+                  is_same_v<Projection, identity>) {
+        int32_t minimum_key = 0, maximum_key = 0;
+        active_simd_kernels().key_range(to_address(first), last - first, minimum_key, maximum_key);
+        return pair<key_type, key_type>{minimum_key, maximum_key};
+    } else {
+        key_type minimum_key = invoke(projection, *first);
+        key_type maximum_key = minimum_key;
+        for (RandomIt element_position = first + 1; element_position != last; ++element_position) {
+            key_type key_value = invoke(projection, *element_position);
+            minimum_key = min(minimum_key, key_value);
+            maximum_key = max(maximum_key, key_value);
+        }
+        return pair<key_type, key_type>{minimum_key, maximum_key};
+    }
+}
+
+// Function: execute_counting_sort_algorithm
+// Purpose: Implements counting sort for bounded key ranges - a vectorized min/max
+//          pass sizes the histogram, worker chunks count into private histograms in
+//          parallel, then scalar keys are rewritten as runs and records are scattered
+//          stably through one scratch buffer. Falls back to LSD radix sort only when
+//          the range would not keep the histogram in cache; whether the range is small
+//          enough next to N to pay off is the adaptive dispatcher's decision.
+// Parameters: first/last - random-access range requiring sorting operation,
+//             projection - integral key extraction
+template <typename RandomIt, typename Projection = identity>
+    requires radix_sortable_range<RandomIt, Projection>
+void execute_counting_sort_algorithm(RandomIt first, RandomIt last, Projection projection = {}) {
+    using element_type = iter_value_t<RandomIt>;
+    using key_type = remove_cvref_t<invoke_result_t<Projection&, iter_reference_t<RandomIt>>>;
+    using unsigned_key = make_unsigned_t<key_type>;
+
+    size_t array_length = last - first;  // Cache range size for optimization
+    if (array_length < 2) {
+        return;
+    }
+    auto [minimum_key, maximum_key] = find_projected_key_range(first, last, projection);
+    uint64_t key_span = static_cast<uint64_t>(radix_key_of(maximum_key) - radix_key_of(minimum_key));
+    if (key_span >= COUNTING_SORT_HISTOGRAM_BYTES / sizeof(uint32_t) ||
+        array_length > numeric_limits<uint32_t>::max()) {
+        execute_lsd_radix_sort_algorithm(first, last, projection);
+        return;
+    }
+    size_t bucket_count = key_span + 1;
+    auto bucket_of = [&projection, minimum_key](const element_type& element) {
+        return static_cast<size_t>(radix_key_of(invoke(projection, element)) - radix_key_of(minimum_key));
+    };
+
+    // One private histogram per chunk - no shared counters, no false sharing of hot buckets
+    size_t chunk_count = clamp<size_t>(array_length / PARALLEL_SEQUENTIAL_CUTOFF, 1, shared_thread_pool().worker_count());
+    size_t chunk_length = (array_length + chunk_count - 1) / chunk_count;
+    scratch_buffer_lease<uint32_t> chunk_histograms(chunk_count * bucket_count);
+    fill(chunk_histograms.begin(), chunk_histograms.end(), 0u);
+    auto for_each_chunk = [&](auto chunk_action) {
+        if (chunk_count == 1) {
+            chunk_action(size_t{0});
+            return;
+        }
+        parallel_task_group task_group(shared_thread_pool());
+        for (size_t chunk_index = 0; chunk_index < chunk_count; chunk_index++) {
+            task_group.run([&chunk_action, chunk_index] { chunk_action(chunk_index); });
+        }
+        task_group.wait();
+    };
+    for_each_chunk([&](size_t chunk_index) {
+        uint32_t* chunk_histogram = chunk_histograms.data() + chunk_index * bucket_count;
+        RandomIt chunk_end = first + min(array_length, (chunk_index + 1) * chunk_length);
+        for (RandomIt element_position = first + chunk_index * chunk_length; element_position < chunk_end; ++element_position) {
+            chunk_histogram[bucket_of(*element_position)]++;
+        }
+    });
+
+    if constexpr (is_same_v<element_type, key_type> && is_same_v<Projection, identity>) {
+        // Scalar keys carry no payload - rewrite the range as one run per bucket
+        RandomIt output_position = first;
+        for (size_t bucket_index = 0; bucket_index < bucket_count; bucket_index++) {
+            size_t bucket_total = 0;
+            for (size_t chunk_index = 0; chunk_index < chunk_count; chunk_index++) {
+                bucket_total += chunk_histograms[chunk_index * bucket_count + bucket_index];
+            }
+            output_position = fill_n(output_position, bucket_total,
+                                     static_cast<key_type>(static_cast<unsigned_key>(minimum_key) + static_cast<unsigned_key>(bucket_index)));
+        }
+    } else {
+        // Bucket-major, chunk-minor exclusive offsets keep equal keys in input order
+        uint32_t running_offset = 0;
+        for (size_t bucket_index = 0; bucket_index < bucket_count; bucket_index++) {
+            for (size_t chunk_index = 0; chunk_index < chunk_count; chunk_index++) {
+                uint32_t& bucket_slot = chunk_histograms[chunk_index * bucket_count + bucket_index];
+                uint32_t bucket_size = bucket_slot;
+                bucket_slot = running_offset;
+                running_offset += bucket_size;
+            }
+        }
+        scratch_buffer_lease<element_type> scratch_buffer(array_length);
+        for_each_chunk([&](size_t chunk_index) {
+            uint32_t* chunk_offsets = chunk_histograms.data() + chunk_index * bucket_count;
+            RandomIt chunk_end = first + min(array_length, (chunk_index + 1) * chunk_length);
+            for (RandomIt element_position = first + chunk_index * chunk_length; element_position < chunk_end; ++element_position) {
+                scratch_buffer[chunk_offsets[bucket_of(*element_position)]++] = move(*element_position);
+            }
+        });
+        for_each_chunk([&](size_t chunk_index) {
+            size_t slice_begin = chunk_index * chunk_length;
+            size_t slice_end = min(array_length, slice_begin + chunk_length);
+            move(scratch_buffer.begin() + slice_begin, scratch_buffer.begin() + slice_end, first + slice_begin);
+        });
+    }
+}
+
+template <typename Element, typename Projection = identity>
+    requires radix_sortable_range<typename span<Element>::iterator, Projection>
+void execute_counting_sort_algorithm(span<Element> data_span, Projection projection = {}) {
+    execute_counting_sort_algorithm(data_span.begin(), data_span.end(), projection);
+}
+
+/*
+================================================================================
+SEGMENTED BATCH SORTING - Many small int32 arrays in one CSR buffer
+================================================================================
+*/
+
+// Function: bitonic_row_schedule
+// Purpose: Comparator pairs of the bitonic network over network_size rows. Pairs of
+//          descending stages are stored swapped, so every pair is (minimum row,
+//          maximum row) and the vertical kernels need no direction mask.
+// Parameters: network_size - power of two in [2, CSR_BATCH_MAXIMUM_NETWORK_SIZE]
+// Returns: flattened row pairs, built once per network size
+const vector<uint16_t>& bitonic_row_schedule(size_t network_size) {
+    constexpr size_t SCHEDULE_COUNT = bit_width(CSR_BATCH_MAXIMUM_NETWORK_SIZE);
+    static const array<vector<uint16_t>, SCHEDULE_COUNT> row_schedules = [] {
+        array<vector<uint16_t>, SCHEDULE_COUNT> built_schedules;
+        for (size_t schedule_index = 1; schedule_index < SCHEDULE_COUNT; schedule_index++) {
+            size_t row_count = size_t{1} << schedule_index;
+            vector<uint16_t>& row_pairs = built_schedules[schedule_index];
+            for (size_t merge_width = 2; merge_width <= row_count; merge_width *= 2) {
+                for (size_t partner_distance = merge_width / 2; partner_distance > 0; partner_distance /= 2) {
+                    for (size_t row_index = 0; row_index < row_count; row_index++) {
+                        size_t partner_row = row_index ^ partner_distance;
+                        if (partner_row < row_index) {
+                            continue;
+                        }
+                        bool ascending_block = (row_index & merge_width) == 0;
+                        row_pairs.push_back(static_cast<uint16_t>(ascending_block ? row_index : partner_row));
+                        row_pairs.push_back(static_cast<uint16_t>(ascending_block ? partner_row : row_index));
+                    }
+                }
+            }
+        }
+        return built_schedules;
+    }();
+    return row_schedules[bit_width(network_size) - 1];
+}
+
+// Structure: vertical_segment_group
+// Purpose: Segments of one network size waiting to fill the lanes of a vertical pass
+struct vertical_segment_group {
+    size_t segment_count = 0;                                     // Occupied lanes
+    int32_t* segment_begins[SIMD_VERTICAL_MAXIMUM_LANES];         // First key of each segment
+    size_t segment_lengths[SIMD_VERTICAL_MAXIMUM_LANES];          // Keys in each segment
+};
+
+// Function: sort_vertical_segment_group
+// Purpose: Transposes up to one register width of segments into lane-per-segment rows,
+//          runs the network across all lanes at once and transposes the result back.
+//          Rows past a segment's end and lanes without a segment hold INT32_MAX, which
+//          the network moves behind the real keys.
+// Parameters: segment_group - segments to sort (emptied on return), network_size - padded
+//             row count, lane_rows - network_size * lanes scratch keys, simd_kernels - dispatched kernels
+void sort_vertical_segment_group(vertical_segment_group& segment_group, size_t network_size, int32_t* lane_rows,
+                                 const simd_kernel_table& simd_kernels) {
+    const size_t lane_count = simd_kernels.vertical_lanes;
+    for (size_t lane_index = 0; lane_index < lane_count; lane_index++) {
+        size_t segment_length = lane_index < segment_group.segment_count ? segment_group.segment_lengths[lane_index] : 0;
+        const int32_t* segment_keys = segment_group.segment_begins[lane_index];
+        for (size_t row_index = 0; row_index < segment_length; row_index++) {
+            lane_rows[row_index * lane_count + lane_index] = segment_keys[row_index];
+        }
+        for (size_t row_index = segment_length; row_index < network_size; row_index++) {
+            lane_rows[row_index * lane_count + lane_index] = numeric_limits<int32_t>::max();
+        }
+    }
+
+    const vector<uint16_t>& row_pairs = bitonic_row_schedule(network_size);
+    simd_kernels.vertical_network(lane_rows, row_pairs.data(), row_pairs.size() / 2);
+
+    for (size_t lane_index = 0; lane_index < segment_group.segment_count; lane_index++) {
+        int32_t* segment_keys = segment_group.segment_begins[lane_index];
+        for (size_t row_index = 0; row_index < segment_group.segment_lengths[lane_index]; row_index++) {
+            segment_keys[row_index] = lane_rows[row_index * lane_count + lane_index];
+        }
+    }
+    segment_group.segment_count = 0;
+}
+
+// Function: sort_segment_list
+// Purpose: Sorts independent int32 segments on the calling thread. Segments are binned
+//          by padded network size so each vertical pass wastes at most half its rows;
+//          longer segments go to the SIMD introsort. Segments may live in unrelated buffers.
+// Parameters: segment_count - segments to sort, segment_at - callable returning segment
+//             i as span<int32_t>, simd_kernels - dispatched kernels
+template <typename SegmentAccessor>
+void sort_segment_list(size_t segment_count, SegmentAccessor segment_at, const simd_kernel_table& simd_kernels) {
+    constexpr size_t SIZE_CLASS_COUNT = bit_width(CSR_BATCH_MAXIMUM_NETWORK_SIZE);
+    array<vertical_segment_group, SIZE_CLASS_COUNT> pending_groups;
+    scratch_buffer_lease<int32_t> lane_rows(CSR_BATCH_MAXIMUM_NETWORK_SIZE * SIMD_VERTICAL_MAXIMUM_LANES);
+
+    for (size_t segment_index = 0; segment_index < segment_count; segment_index++) {
+        span<int32_t> segment_keys = segment_at(segment_index);
+        int32_t* segment_begin = segment_keys.data();
+        size_t segment_length = segment_keys.size();
+        if (segment_length <= 1) {
+            continue;
+        }
+        if (segment_length > CSR_BATCH_MAXIMUM_NETWORK_SIZE) {
+            simd_introsort_loop(segment_begin, segment_begin + segment_length,
+                                compute_introsort_depth_budget(static_cast<ptrdiff_t>(segment_length)), simd_kernels);
+            continue;
+        }
+
+        size_t size_class = bit_width(segment_length - 1);
+        vertical_segment_group& segment_group = pending_groups[size_class];
+        segment_group.segment_begins[segment_group.segment_count] = segment_begin;
+        segment_group.segment_lengths[segment_group.segment_count] = segment_length;
+        if (++segment_group.segment_count == simd_kernels.vertical_lanes) {
+            sort_vertical_segment_group(segment_group, size_t{1} << size_class, lane_rows.data(), simd_kernels);
+        }
+    }
+
+    // Partially filled groups run with idle lanes
+    for (size_t size_class = 1; size_class < SIZE_CLASS_COUNT; size_class++) {
+        if (pending_groups[size_class].segment_count != 0) {
+            sort_vertical_segment_group(pending_groups[size_class], size_t{1} << size_class, lane_rows.data(), simd_kernels);
+        }
+    }
+}
+
+// Function: sort_segment_range
+// Purpose: Sorts segments [first_segment, last_segment) of a CSR batch on the calling thread
+// Parameters: flat_keys - concatenated segments, segment_offsets - CSR offsets,
+//             first_segment/last_segment - segment index range, simd_kernels - dispatched kernels
+void sort_segment_range(int32_t* flat_keys, const size_t* segment_offsets, size_t first_segment, size_t last_segment,
+                        const simd_kernel_table& simd_kernels) {
+    sort_segment_list(last_segment - first_segment, [=](size_t segment_index) {
+        size_t segment_begin = segment_offsets[first_segment + segment_index];
+        return span<int32_t>(flat_keys + segment_begin, segment_offsets[first_segment + segment_index + 1] - segment_begin);
+    }, simd_kernels);
+}
+
+// Function: execute_segmented_batch_sort
+// Purpose: Sorts every segment of a CSR batch - segment i is
+//          flat_keys[segment_offsets[i], segment_offsets[i + 1]). Tasks are cut at
+//          segment boundaries by element count, not segment count, so a few long
+//          segments cannot leave the other workers idle.
+// Parameters: flat_keys - concatenated segments, segment_offsets - segment_count + 1
+//             non-decreasing offsets ending at most at flat_keys.size(),
+//             thread_pool - pool executing the tasks
+// Returns: false (with a message) when the offsets do not describe flat_keys
+bool execute_segmented_batch_sort(span<int32_t> flat_keys, span<const size_t> segment_offsets,
+                                  work_stealing_thread_pool& thread_pool = shared_thread_pool()) {
+    if (segment_offsets.empty()) {
+        cerr << "Batch sort: the offset array needs at least one entry" << endl;
+        return false;
+    }
+    if (!is_sorted(segment_offsets.begin(), segment_offsets.end())) {
+        cerr << "Batch sort: segment offsets must be non-decreasing" << endl;
+        return false;
+    }
+    if (segment_offsets.back() > flat_keys.size()) {
+        cerr << "Batch sort: last offset " << segment_offsets.back() << " exceeds the " << flat_keys.size()
+             << "-key buffer" << endl;
+        return false;
+    }
+
+    const simd_kernel_table& simd_kernels = active_simd_kernels();
+    size_t segment_count = segment_offsets.size() - 1;
+    size_t batch_elements = segment_offsets.back() - segment_offsets.front();
+    size_t task_elements = max(CSR_BATCH_TASK_ELEMENTS, batch_elements / (thread_pool.worker_count() * 4 + 1));
+    if (thread_pool.worker_count() <= 1 || batch_elements <= task_elements) {
+        sort_segment_range(flat_keys.data(), segment_offsets.data(), 0, segment_count, simd_kernels);
+        return true;
+    }
+
+    parallel_task_group task_group(thread_pool);
+    size_t task_first_segment = 0;
+    while (task_first_segment < segment_count) {
+        // First segment starting at or beyond the element target ends this task
+        size_t element_target = segment_offsets[task_first_segment] + task_elements;
+        size_t task_last_segment = static_cast<size_t>(
+            lower_bound(segment_offsets.begin() + task_first_segment + 1, segment_offsets.end() - 1, element_target) -
+            segment_offsets.begin());
+        task_group.run([&flat_keys, &segment_offsets, &simd_kernels, task_first_segment, task_last_segment] {
+            sort_segment_range(flat_keys.data(), segment_offsets.data(), task_first_segment, task_last_segment, simd_kernels);
+        });
+        task_first_segment = task_last_segment;
+    }
+    task_group.wait();
+    return true;
+}
+
+/*
+================================================================================
+ASYNC SORT SERVICE - Coroutine front end with request batching and deadline scheduling
+================================================================================
+*/
+
+// Structure: detached_sort_task
+// Purpose: Fire-and-forget coroutine type for callers of the sort service - the body
+//          starts eagerly and its frame frees itself when the body finishes
+struct detached_sort_task {
+    struct promise_type {
+        detached_sort_task get_return_object() noexcept { return {}; }
+        suspend_never initial_suspend() noexcept { return {}; }
+        suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { terminate(); }
+    };
+};
+
+// Structure: async_sort_request
+// Purpose: One queued sort. It lives in the awaiting coroutine's frame, so queuing a
+//          request allocates nothing.
+struct async_sort_request {
+    span<int32_t> request_keys;          // Keys sorted in place
+    steady_clock::time_point deadline;   // Dispatch order - earliest deadline first
+    coroutine_handle<> continuation;     // Awaiting coroutine, resumed on completion
+    bool deadline_met = false;           // Completed no later than the deadline
+};
+
+// Structure: async_sort_service_statistics
+// Purpose: Dispatch counters of one service instance
+struct async_sort_service_statistics {
+    size_t completed_requests = 0;  // Requests sorted and resumed
+    size_t batch_tasks = 0;         // Tasks that sorted several coalesced small requests
+    size_t batched_requests = 0;    // Requests sorted inside those tasks
+    size_t split_requests = 0;      // Requests sorted across the pool
+    size_t missed_deadlines = 0;    // Requests completed after their deadline
+};
+
+// Class: async_sort_service
+// Purpose: Asynchronous int32 sort front end on a work-stealing pool.
+//          `co_await service.sort(keys, deadline)` suspends the caller until the keys
+//          are sorted, and the caller resumes on the worker that finished them.
+//          A dispatcher thread releases queued requests earliest-deadline-first and
+//          keeps only ASYNC_SORT_TASKS_PER_WORKER tasks per worker in flight, so an
+//          urgent request never queues behind a deep pool backlog. Handling by size:
+//          - up to ASYNC_SORT_BATCH_REQUEST_ELEMENTS keys: coalesced, so one task runs
+//            the vertical networks across many requests;
+//          - above ASYNC_SORT_SPLIT_ELEMENTS keys: split across the pool;
+//          - otherwise: one SIMD introsort task.
+class async_sort_service {
+public:
+    // Class: sort_awaitable
+    // Purpose: Awaitable returned by sort(); co_await yields whether the deadline was met
+    class sort_awaitable {
+    public:
+        sort_awaitable(async_sort_service& owning_service, span<int32_t> request_keys, steady_clock::time_point deadline)
+            : owning_service(owning_service), queued_request{request_keys, deadline, {}, false} {}
+
+        bool await_ready() const noexcept { return queued_request.request_keys.size() <= 1; }  // Already sorted
+        void await_suspend(coroutine_handle<> continuation) {
+            queued_request.continuation = continuation;
+            owning_service.enqueue_request(queued_request);
+        }
+        bool await_resume() const noexcept { return queued_request.request_keys.size() <= 1 || queued_request.deadline_met; }
+
+    private:
+        async_sort_service& owning_service;  // Service the request is queued on
+        async_sort_request queued_request;   // Request state, stable while suspended
+    };
+
+    // Constructor: starts the dispatcher for thread_pool
+    explicit async_sort_service(work_stealing_thread_pool& thread_pool = shared_thread_pool())
+        : thread_pool(thread_pool),
+          in_flight_limit(static_cast<size_t>(max(thread_pool.worker_count(), 1u)) * ASYNC_SORT_TASKS_PER_WORKER),
+          dispatcher_thread([this] { dispatch_requests(); }) {}
+
+    // Destructor: finishes every queued request, then stops the dispatcher
+    ~async_sort_service() {
+        drain();
+        {
+            lock_guard<mutex> queue_lock(queue_mutex);
+            stopping = true;
+            queue_condition.notify_all();
+        }
+        dispatcher_thread.join();
+    }
+
+    async_sort_service(const async_sort_service&) = delete;
+    async_sort_service& operator=(const async_sort_service&) = delete;
+
+    // Function: sort
+    // Purpose: Queues keys for sorting; the returned awaitable suspends until done
+    // Parameters: request_keys - keys sorted in place (must outlive the await),
+    //             deadline - completion target that orders dispatch
+    sort_awaitable sort(span<int32_t> request_keys, steady_clock::time_point deadline) {
+        return sort_awaitable(*this, request_keys, deadline);
+    }
+
+    sort_awaitable sort(span<int32_t> request_keys) {
+        return sort(request_keys, steady_clock::now() + microseconds(ASYNC_SORT_DEFAULT_DEADLINE_MICROSECONDS));
+    }
+
+    // Function: drain
+    // Purpose: Blocks until no request is queued or running and every resumed caller
+    //          has returned control to the service
+    void drain() {
+        unique_lock<mutex> queue_lock(queue_mutex);
+        idle_condition.wait(queue_lock, [this] {
+            return small_requests.empty() && bulk_requests.empty() && in_flight_tasks == 0;
+        });
+    }
+
+    // Function: statistics
+    // Returns: dispatch counters so far
+    async_sort_service_statistics statistics() const {
+        lock_guard<mutex> queue_lock(queue_mutex);
+        return service_statistics;
+    }
+
+private:
+    // Structure: deadline_later
+    // Purpose: Heap order putting the earliest deadline on top
+    struct deadline_later {
+        bool operator()(const async_sort_request* left_request, const async_sort_request* right_request) const {
+            return left_request->deadline > right_request->deadline;
+        }
+    };
+    using request_queue = priority_queue<async_sort_request*, vector<async_sort_request*>, deadline_later>;
+
+    // Function: enqueue_request
+    // Purpose: Files a suspended request under its size class
+    void enqueue_request(async_sort_request& request) {
+        lock_guard<mutex> queue_lock(queue_mutex);
+        (request.request_keys.size() <= ASYNC_SORT_BATCH_REQUEST_ELEMENTS ? small_requests : bulk_requests).push(&request);
+        queue_condition.notify_one();
+    }
+
+    // Function: dispatch_requests
+    // Purpose: Dispatcher loop - whenever a task slot is free, submits the request
+    //          with the earliest deadline, taking every other queued small request
+    //          along (earliest first) when it is small
+    void dispatch_requests() {
+        unique_lock<mutex> queue_lock(queue_mutex);
+        while (true) {
+            queue_condition.wait(queue_lock, [this] {
+                return stopping || ((!small_requests.empty() || !bulk_requests.empty()) && in_flight_tasks < in_flight_limit);
+            });
+            if (small_requests.empty() && bulk_requests.empty()) {
+                return;  // Stopping with nothing left
+            }
+
+            vector<async_sort_request*> task_requests;
+            bool small_first = !small_requests.empty() &&
+                (bulk_requests.empty() || small_requests.top()->deadline <= bulk_requests.top()->deadline);
+            if (small_first) {
+                while (!small_requests.empty() && task_requests.size() < ASYNC_SORT_BATCH_MAXIMUM_REQUESTS) {
+                    task_requests.push_back(small_requests.top());
+                    small_requests.pop();
+                }
+            } else {
+                task_requests.push_back(bulk_requests.top());
+                bulk_requests.pop();
+            }
+            in_flight_tasks++;
+
+            queue_lock.unlock();
+            thread_pool.submit([this, task_requests = move(task_requests)] { execute_requests(task_requests); });
+            queue_lock.lock();
+        }
+    }
+
+    // Function: execute_requests
+    // Purpose: Pool task - sorts its requests, then resumes their callers
+    void execute_requests(const vector<async_sort_request*>& task_requests) {
+        bool split_across_pool = false;
+        if (task_requests.size() > 1) {
+            sort_segment_list(task_requests.size(), [&task_requests](size_t request_index) {
+                return task_requests[request_index]->request_keys;
+            }, active_simd_kernels());
+        } else if (task_requests.front()->request_keys.size() > ASYNC_SORT_SPLIT_ELEMENTS && thread_pool.worker_count() > 1) {
+            span<int32_t> request_keys = task_requests.front()->request_keys;
+            parallel_quicksort_with_pool(request_keys.begin(), request_keys.end(), thread_pool);
+            split_across_pool = true;
+        } else {
+            execute_simd_introsort_algorithm(task_requests.front()->request_keys);
+        }
+
+        // Requests belong to the callers' frames - read everything before resuming them
+        steady_clock::time_point completion_time = steady_clock::now();
+        vector<coroutine_handle<>> continuations;
+        continuations.reserve(task_requests.size());
+        size_t missed_deadlines = 0;
+        for (async_sort_request* request : task_requests) {
+            request->deadline_met = completion_time <= request->deadline;
+            missed_deadlines += request->deadline_met ? 0 : 1;
+            continuations.push_back(request->continuation);
+        }
+        {
+            lock_guard<mutex> queue_lock(queue_mutex);
+            service_statistics.completed_requests += task_requests.size();
+            service_statistics.missed_deadlines += missed_deadlines;
+            service_statistics.split_requests += split_across_pool ? 1 : 0;
+            if (task_requests.size() > 1) {
+                service_statistics.batch_tasks++;
+                service_statistics.batched_requests += task_requests.size();
+            }
+        }
+
+        for (coroutine_handle<> continuation : continuations) {
+            continuation.resume();
+        }
+
+        // The slot stays taken until the callers are done, so drain() covers them
+        lock_guard<mutex> queue_lock(queue_mutex);
+        in_flight_tasks--;
+        queue_condition.notify_one();
+        idle_condition.notify_all();
+    }
+
+    work_stealing_thread_pool& thread_pool;           // Pool executing the sorts
+    const size_t in_flight_limit;                     // Tasks submitted but unfinished, at most
+    mutable mutex queue_mutex;                        // Guards queues, counters and statistics
+    condition_variable queue_condition;               // Wakes the dispatcher
+    condition_variable idle_condition;                // Wakes drain()
+    request_queue small_requests;                     // Coalescable requests
+    request_queue bulk_requests;                      // Requests sorted one per task
+    size_t in_flight_tasks = 0;                       // Submitted and unfinished tasks
+    bool stopping = false;                            // Destructor reached
+    async_sort_service_statistics service_statistics; // Dispatch counters
+    thread dispatcher_thread;                         // Started last, after every member it uses
+};
+
+/*
+================================================================================
+NUMA-AWARE PARALLEL SORT - Node-local first touch, sample-sort exchange, local sorts
+================================================================================
+*/
+
+// Structure: numa_node_info
+// Purpose: One memory node and the CPUs of the process affinity mask it contains
+struct numa_node_info {
+    int node_identifier;           // Kernel node number
+    vector<int> cpu_identifiers;   // Allowed CPUs local to the node
+};
+
+// Function: parse_cpu_list
+// Purpose: Parses a sysfs CPU list such as "0-3,8,10-11"
+// Returns: CPU numbers in list order
+vector<int> parse_cpu_list(const string& cpu_list_text) {
+    vector<int> cpu_identifiers;
+    stringstream list_stream(cpu_list_text);
+    string list_item;
+    while (getline(list_stream, list_item, ',')) {
+        if (list_item.empty()) {
+            continue;
+        }
+        size_t range_separator = list_item.find('-');
+        int range_first = stoi(list_item.substr(0, range_separator));
+        int range_last = range_separator == string::npos ? range_first : stoi(list_item.substr(range_separator + 1));
+        for (int cpu_identifier = range_first; cpu_identifier <= range_last; cpu_identifier++) {
+            cpu_identifiers.push_back(cpu_identifier);
+        }
+    }
+    return cpu_identifiers;
+}
+
+// Function: detect_numa_topology
+// Purpose: Reads the memory nodes from sysfs, keeping only CPUs the process may run on
+// Returns: nodes with at least one allowed CPU; one pseudo-node 0 holding every CPU
+//          when the platform exposes no topology
+vector<numa_node_info> detect_numa_topology() {
+    vector<numa_node_info> node_list;
+#ifdef __linux__
+    cpu_set_t allowed_cpus;
+    bool affinity_known = sched_getaffinity(0, sizeof(allowed_cpus), &allowed_cpus) == 0;
+    for (int node_identifier = 0; node_identifier < NUMA_MAXIMUM_NODES; node_identifier++) {
+        ifstream cpu_list_file("/sys/devices/system/node/node" + to_string(node_identifier) + "/cpulist");
+        string cpu_list_text;
+        if (!cpu_list_file || !getline(cpu_list_file, cpu_list_text)) {
+            continue;  // Node numbers may be sparse
+        }
+        numa_node_info node_info{node_identifier, {}};
+        for (int cpu_identifier : parse_cpu_list(cpu_list_text)) {
+            if (!affinity_known || (cpu_identifier < CPU_SETSIZE && CPU_ISSET(cpu_identifier, &allowed_cpus))) {
+                node_info.cpu_identifiers.push_back(cpu_identifier);
+            }
+        }
+        if (!node_info.cpu_identifiers.empty()) {
+            node_list.push_back(move(node_info));
+        }
+    }
+#endif
+    if (node_list.empty()) {
+        numa_node_info single_node{0, {}};
+        for (unsigned cpu_identifier = 0; cpu_identifier < max(1u, thread::hardware_concurrency()); cpu_identifier++) {
+            single_node.cpu_identifiers.push_back(static_cast<int>(cpu_identifier));
+        }
+        node_list.push_back(move(single_node));
+    }
+    return node_list;
+}
+
+// Function: active_numa_topology
+// Purpose: Topology detected once at first use
+// Returns: reference to the process-wide node list
+const vector<numa_node_info>& active_numa_topology() {
+    static const vector<numa_node_info> detected_topology = detect_numa_topology();
+    return detected_topology;
+}
+
+// Function: bind_calling_thread_to_node
+// Purpose: Restricts the calling thread to the CPUs of one node, so the pages it
+//          first-touches are allocated there by the default local policy
+// Parameters: node_index - position in active_numa_topology()
+// Returns: false when binding is unsupported or refused
+bool bind_calling_thread_to_node(size_t node_index) {
+#if defined(__linux__)
+    cpu_set_t node_cpus;
+    CPU_ZERO(&node_cpus);
+    for (int cpu_identifier : active_numa_topology()[node_index].cpu_identifiers) {
+        CPU_SET(cpu_identifier, &node_cpus);
+    }
+    return sched_setaffinity(0, sizeof(node_cpus), &node_cpus) == 0;
+#else
+    (void)node_index;
+    return false;
+#endif
+}
+
+// Structure: numa_sort_layout
+// Purpose: Assignment of sort partitions to nodes; the partitions of one node are
+//          adjacent, so each node owns one contiguous stretch of the sorted output
+struct numa_sort_layout {
+    vector<size_t> partition_nodes;  // Topology index of every partition
+
+    size_t partition_count() const { return partition_nodes.size(); }
+};
+
+// Function: plan_numa_layout
+// Purpose: Spreads thread_count partitions evenly over the nodes, at most one per CPU
+//          and at least one per node
+// Parameters: thread_count - requested worker threads
+// Returns: layout with node-major partition order
+numa_sort_layout plan_numa_layout(unsigned thread_count) {
+    const vector<numa_node_info>& node_list = active_numa_topology();
+    numa_sort_layout sort_layout;
+    for (size_t node_index = 0; node_index < node_list.size(); node_index++) {
+        size_t node_share = thread_count / node_list.size() + (node_index < thread_count % node_list.size() ? 1 : 0);
+        size_t node_partitions = clamp<size_t>(node_share, 1, node_list[node_index].cpu_identifiers.size());
+        sort_layout.partition_nodes.insert(sort_layout.partition_nodes.end(), node_partitions, node_index);
+    }
+    return sort_layout;
+}
+
+// Class: numa_partition_team
+// Purpose: One persistent worker per partition, bound to the partition's node when it
+//          starts. Phases of every sort reuse the same workers, so thread start-up and
+//          binding happen once, outside the timed region.
+class numa_partition_team {
+public:
+    // Constructor: starts and binds one worker per partition of the layout
+    explicit numa_partition_team(numa_sort_layout sort_layout) : team_layout(move(sort_layout)) {
+        partition_threads.reserve(team_layout.partition_count());
+        for (size_t partition_index = 0; partition_index < team_layout.partition_count(); partition_index++) {
+            partition_threads.emplace_back([this, partition_index] { run_worker_loop(partition_index); });
+        }
+    }
+
+    numa_partition_team(const numa_partition_team&) = delete;
+    numa_partition_team& operator=(const numa_partition_team&) = delete;
+
+    // Destructor: signals shutdown and joins every worker
+    ~numa_partition_team() {
+        {
+            lock_guard<mutex> team_lock(team_mutex);
+            stopping = true;
+        }
+        phase_condition.notify_all();
+        for (thread& partition_thread : partition_threads) {
+            partition_thread.join();
+        }
+    }
+
+    // Function: layout
+    // Returns: partition placement the workers are bound to
+    const numa_sort_layout& layout() const { return team_layout; }
+
+    // Function: run_phase
+    // Purpose: Runs phase(partition_index) on every partition's worker and waits for all of them
+    template <typename Phase>
+    void run_phase(Phase phase) {
+        unique_lock<mutex> team_lock(team_mutex);
+        current_phase = [&phase](size_t partition_index) { phase(partition_index); };
+        pending_partitions = team_layout.partition_count();
+        phase_generation++;
+        phase_condition.notify_all();
+        completion_condition.wait(team_lock, [this] { return pending_partitions == 0; });
+        current_phase = nullptr;
+    }
+
+private:
+    // Function: run_worker_loop
+    // Purpose: Binds to the partition's node, then runs each published phase once
+    void run_worker_loop(size_t partition_index) {
+        bind_calling_thread_to_node(team_layout.partition_nodes[partition_index]);
+        uint64_t completed_generation = 0;
+        while (true) {
+            {
+                unique_lock<mutex> team_lock(team_mutex);
+                phase_condition.wait(team_lock, [&] { return stopping || phase_generation != completed_generation; });
+                if (stopping) {
+                    return;
+                }
+                completed_generation = phase_generation;
+            }
+            current_phase(partition_index);  // Unchanged until every worker has reported back
+            lock_guard<mutex> team_lock(team_mutex);
+            if (--pending_partitions == 0) {
+                completion_condition.notify_one();
+            }
+        }
+    }
+
+    const numa_sort_layout team_layout;          // Partition placement
+    mutex team_mutex;                            // Guards the phase hand-off below
+    condition_variable phase_condition;          // Wakes workers for a new phase or shutdown
+    condition_variable completion_condition;     // Wakes run_phase when the last worker finishes
+    function<void(size_t)> current_phase;        // Phase being run, empty between phases
+    uint64_t phase_generation = 0;               // Incremented for every published phase
+    size_t pending_partitions = 0;               // Workers still running the current phase
+    bool stopping = false;                       // Destructor reached
+    vector<thread> partition_threads;            // Started last, after every member they use
+};
+
+// Structure: numa_distributed_array
+// Purpose: Element array cut into one contiguous range per partition. Storage is
+//          allocated untouched; each range is first written by a thread bound to its
+//          partition's node, so its pages live on that node.
+template <typename Element>
+struct numa_distributed_array {
+    unique_ptr<Element[]> element_storage;  // Untouched until the owning partitions write it
+    vector<size_t> partition_offsets;       // partition_count + 1 range boundaries
+
+    size_t size() const { return partition_offsets.empty() ? 0 : partition_offsets.back(); }
+    span<Element> whole_array() { return span<Element>(element_storage.get(), size()); }
+    span<Element> partition(size_t partition_index) {
+        return span<Element>(element_storage.get() + partition_offsets[partition_index],
+                             partition_offsets[partition_index + 1] - partition_offsets[partition_index]);
+    }
+};
+
+// Function: allocate_numa_array
+// Purpose: Reserves storage for the given partition lengths without touching it
+template <typename Element>
+numa_distributed_array<Element> allocate_numa_array(const vector<size_t>& partition_lengths) {
+    static_assert(is_trivially_copyable_v<Element>, "first touch relies on uninitialised storage");
+    numa_distributed_array<Element> distributed_array;
+    distributed_array.partition_offsets.assign(1, 0);
+    for (size_t partition_length : partition_lengths) {
+        distributed_array.partition_offsets.push_back(distributed_array.partition_offsets.back() + partition_length);
+    }
+    distributed_array.element_storage = make_unique_for_overwrite<Element[]>(distributed_array.size());
+    return distributed_array;
+}
+
+// Function: first_touch_numa_array
+// Purpose: Copies source into a distributed array in equal partitions, each copied by
+//          the partition's worker on its node - the parallel first touch
+// Parameters: source_elements - input, partition_team - node-bound partition workers
+// Returns: node-local copy of the input
+template <typename Element>
+numa_distributed_array<Element> first_touch_numa_array(span<const Element> source_elements,
+                                                       numa_partition_team& partition_team) {
+    size_t partition_count = partition_team.layout().partition_count();
+    vector<size_t> partition_lengths(partition_count);
+    for (size_t partition_index = 0; partition_index < partition_count; partition_index++) {
+        partition_lengths[partition_index] = source_elements.size() * (partition_index + 1) / partition_count -
+                                             source_elements.size() * partition_index / partition_count;
+    }
+    numa_distributed_array<Element> distributed_array = allocate_numa_array<Element>(partition_lengths);
+    partition_team.run_phase([&](size_t partition_index) {
+        span<Element> local_partition = distributed_array.partition(partition_index);
+        copy_n(source_elements.begin() + distributed_array.partition_offsets[partition_index],
+               local_partition.size(), local_partition.begin());
+    });
+    return distributed_array;
+}
+
+// Function: measure_home_node_fraction
+// Purpose: Samples pages of a range and asks the kernel which node backs each one
+// Parameters: range_begin/range_bytes - memory to inspect, node_index - expected node
+// Returns: share of sampled resident pages on the node, NaN when the query is unsupported
+double measure_home_node_fraction(const void* range_begin, size_t range_bytes, size_t node_index) {
+#if defined(__linux__) && defined(SYS_move_pages)
+    size_t page_bytes = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t first_page = reinterpret_cast<uintptr_t>(range_begin) / page_bytes * page_bytes;
+    size_t range_pages = (reinterpret_cast<uintptr_t>(range_begin) + range_bytes - first_page + page_bytes - 1) / page_bytes;
+    if (range_bytes == 0 || range_pages == 0) {
+        return numeric_limits<double>::quiet_NaN();
+    }
+    size_t sampled_pages = min(range_pages, NUMA_PAGE_SAMPLE_COUNT);
+    vector<void*> page_addresses(sampled_pages);
+    vector<int> page_nodes(sampled_pages, -1);
+    for (size_t sample_index = 0; sample_index < sampled_pages; sample_index++) {
+        page_addresses[sample_index] = reinterpret_cast<void*>(first_page + range_pages * sample_index / sampled_pages * page_bytes);
+    }
+    // With a null node list move_pages only reports where each page lives
+    if (syscall(SYS_move_pages, 0, sampled_pages, page_addresses.data(), nullptr, page_nodes.data(), 0) != 0) {
+        return numeric_limits<double>::quiet_NaN();
+    }
+    int home_node = active_numa_topology()[node_index].node_identifier;
+    size_t resident_pages = 0;
+    size_t home_pages = 0;
+    for (int page_node : page_nodes) {
+        resident_pages += page_node >= 0 ? 1 : 0;
+        home_pages += page_node == home_node ? 1 : 0;
+    }
+    return resident_pages > 0 ? static_cast<double>(home_pages) / resident_pages : numeric_limits<double>::quiet_NaN();
+#else
+    (void)range_begin;
+    (void)range_bytes;
+    (void)node_index;
+    return numeric_limits<double>::quiet_NaN();
+#endif
+}
+
+// Structure: numa_sort_statistics
+// Purpose: Phase timings and data movement of one NUMA sample sort
+struct numa_sort_statistics {
+    double splitter_seconds = 0.0;       // Sampling and splitter selection
+    double exchange_seconds = 0.0;       // Classification, output first touch and all-to-all scatter
+    double local_sort_seconds = 0.0;     // Slowest partition's local sort
+    vector<double> partition_exchange_seconds;  // Classification plus scatter, per sending partition
+    vector<double> partition_sort_seconds;      // Local sort, per receiving partition
+    vector<size_t> partition_sent_elements;     // Elements each partition scattered
+    vector<size_t> partition_remote_elements;   // Of those, elements written to another node
+    vector<size_t> partition_received_elements; // Elements each partition sorted
+};
+
+// Function: execute_numa_sample_sort
+// Purpose: Sorts a distributed array across nodes in one exchange:
+//          1. each partition samples its own range; the sorted samples give
+//             partition_count - 1 splitters
+//          2. each partition classifies its elements against the splitters
+//          3. each receiving partition first-touches its output range on its node
+//          4. all-to-all scatter: every partition writes its elements straight
+//             into the owning output ranges (local reads, possibly remote writes)
+//          5. every partition sorts its received range locally with introsort
+//          The array is replaced by the output, whose partitions follow the splitters.
+// Parameters: distributed_array - node-local input, replaced by the sorted output,
+//             partition_team - node-bound partition workers, comparator/projection - key ordering
+// Returns: phase timings and movement counts
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+numa_sort_statistics execute_numa_sample_sort(numa_distributed_array<Element>& distributed_array,
+                                              numa_partition_team& partition_team,
+                                              Compare comparator = {}, Projection projection = {}) {
+    const numa_sort_layout& sort_layout = partition_team.layout();
+    using key_type = remove_cvref_t<invoke_result_t<Projection&, const Element&>>;
+    auto less_than = make_element_comparator(comparator, projection);
+    size_t partition_count = sort_layout.partition_count();
+    numa_sort_statistics statistics;
+    statistics.partition_exchange_seconds.assign(partition_count, 0.0);
+    statistics.partition_sort_seconds.assign(partition_count, 0.0);
+    statistics.partition_sent_elements.assign(partition_count, 0);
+    statistics.partition_remote_elements.assign(partition_count, 0);
+    statistics.partition_received_elements.assign(partition_count, 0);
+
+    // 1. Splitter round - evenly strided samples of every partition
+    auto phase_start = steady_clock::now();
+    vector<key_type> sample_keys(partition_count * NUMA_SPLITTER_OVERSAMPLING);
+    size_t valid_samples = 0;
+    for (size_t partition_index = 0; partition_index < partition_count; partition_index++) {
+        span<Element> local_partition = distributed_array.partition(partition_index);
+        for (size_t sample_index = 0; sample_index < NUMA_SPLITTER_OVERSAMPLING && !local_partition.empty(); sample_index++) {
+            sample_keys[valid_samples++] = invoke(projection,
+                local_partition[local_partition.size() * sample_index / NUMA_SPLITTER_OVERSAMPLING]);
+        }
+    }
+    sample_keys.resize(valid_samples);
+    sort(sample_keys.begin(), sample_keys.end(), comparator);
+    vector<key_type> splitter_keys;
+    for (size_t splitter_index = 1; splitter_index < partition_count && !sample_keys.empty(); splitter_index++) {
+        splitter_keys.push_back(sample_keys[sample_keys.size() * splitter_index / partition_count]);
+    }
+    size_t bucket_count = splitter_keys.size() + 1;
+    statistics.splitter_seconds = duration<double>(steady_clock::now() - phase_start).count();
+
+    // 2. Classification - bucket of every element, kept in partition-local memory
+    phase_start = steady_clock::now();
+    vector<vector<uint32_t>> element_buckets(partition_count);
+    vector<vector<size_t>> bucket_counts(partition_count);
+    partition_team.run_phase([&](size_t partition_index) {
+        auto classify_start = steady_clock::now();
+        span<Element> local_partition = distributed_array.partition(partition_index);
+        vector<uint32_t>& local_buckets = element_buckets[partition_index];
+        local_buckets.resize(local_partition.size());
+        vector<size_t> local_counts(bucket_count, 0);  // Thread-private - no false sharing between senders
+        for (size_t element_index = 0; element_index < local_partition.size(); element_index++) {
+            uint32_t bucket_index = static_cast<uint32_t>(
+                upper_bound(splitter_keys.begin(), splitter_keys.end(), invoke(projection, local_partition[element_index]),
+                            comparator) - splitter_keys.begin());
+            local_buckets[element_index] = bucket_index;
+            local_counts[bucket_index]++;
+        }
+        bucket_counts[partition_index] = move(local_counts);
+        statistics.partition_exchange_seconds[partition_index] = duration<double>(steady_clock::now() - classify_start).count();
+    });
+
+    // 3. Output ranges: bucket b goes to partition b; sender p writes after senders q < p
+    vector<size_t> received_lengths(partition_count, 0);
+    for (size_t bucket_index = 0; bucket_index < bucket_count; bucket_index++) {
+        for (size_t partition_index = 0; partition_index < partition_count; partition_index++) {
+            received_lengths[bucket_index] += bucket_counts[partition_index][bucket_index];
+        }
+    }
+    numa_distributed_array<Element> output_array = allocate_numa_array<Element>(received_lengths);
+    vector<vector<size_t>> write_positions(partition_count, vector<size_t>(bucket_count));
+    for (size_t bucket_index = 0; bucket_index < bucket_count; bucket_index++) {
+        size_t write_position = output_array.partition_offsets[bucket_index];
+        for (size_t partition_index = 0; partition_index < partition_count; partition_index++) {
+            write_positions[partition_index][bucket_index] = write_position;
+            write_position += bucket_counts[partition_index][bucket_index];
+        }
+    }
+    partition_team.run_phase([&](size_t partition_index) {
+        span<Element> local_output = output_array.partition(partition_index);
+        uninitialized_value_construct(local_output.begin(), local_output.end());  // First touch on the owner's node
+    });
+
+    // 4. All-to-all exchange
+    partition_team.run_phase([&](size_t partition_index) {
+        auto scatter_start = steady_clock::now();
+        span<Element> local_partition = distributed_array.partition(partition_index);
+        const vector<uint32_t>& local_buckets = element_buckets[partition_index];
+        vector<size_t>& local_positions = write_positions[partition_index];
+        Element* output_elements = output_array.element_storage.get();
+        for (size_t element_index = 0; element_index < local_partition.size(); element_index++) {
+            output_elements[local_positions[local_buckets[element_index]]++] = local_partition[element_index];
+        }
+        size_t remote_elements = 0;
+        for (size_t bucket_index = 0; bucket_index < bucket_count; bucket_index++) {
+            if (sort_layout.partition_nodes[bucket_index] != sort_layout.partition_nodes[partition_index]) {
+                remote_elements += bucket_counts[partition_index][bucket_index];
+            }
+        }
+        statistics.partition_exchange_seconds[partition_index] += duration<double>(steady_clock::now() - scatter_start).count();
+        statistics.partition_sent_elements[partition_index] = local_partition.size();
+        statistics.partition_remote_elements[partition_index] = remote_elements;
+    });
+    statistics.exchange_seconds = duration<double>(steady_clock::now() - phase_start).count();
+
+    // 5. Local sorts on the owning nodes
+    phase_start = steady_clock::now();
+    partition_team.run_phase([&](size_t partition_index) {
+        auto sort_start = steady_clock::now();
+        span<Element> local_output = output_array.partition(partition_index);
+        introsort_partition_loop(local_output.begin(), local_output.end(),
+                                 compute_introsort_depth_budget(static_cast<ptrdiff_t>(local_output.size())), less_than);
+        statistics.partition_sort_seconds[partition_index] = duration<double>(steady_clock::now() - sort_start).count();
+        statistics.partition_received_elements[partition_index] = local_output.size();
+    });
+    statistics.local_sort_seconds = duration<double>(steady_clock::now() - phase_start).count();
+
+    distributed_array = move(output_array);
+    return statistics;
+}
+
+/*
+================================================================================
+OUTPUT VALIDATION - Vectorized, parallel sortedness and permutation checks
+================================================================================
+*/
+
+// Function: portable_is_sorted_keys
+// Purpose: Sortedness check that tests whole blocks without data-dependent branches,
+//          so compilers can vectorize it on any target; exits after the first bad block
+// Parameters: key_values - contiguous keys
+// Returns: true when the keys are in non-descending order
+template <typename Key>
+bool portable_is_sorted_keys(span<const Key> key_values) {
+    constexpr size_t BLOCK_LENGTH = 64;
+    size_t element_count = key_values.size();
+    size_t block_begin = 0;
+    for (; block_begin + BLOCK_LENGTH < element_count; block_begin += BLOCK_LENGTH) {
+        bool order_violated = false;
+        for (size_t element_index = block_begin; element_index < block_begin + BLOCK_LENGTH; element_index++) {
+            order_violated |= key_values[element_index + 1] < key_values[element_index];
+        }
+        if (order_violated) {
+            return false;
+        }
+    }
+    for (size_t element_index = block_begin; element_index + 1 < element_count; element_index++) {
+        if (key_values[element_index + 1] < key_values[element_index]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// Function: avx2_descending_lanes
+// Returns: mask of the lanes where key[i] > key[i + 1], for one vector of keys
+template <typename Key>
+__attribute__((target("avx2"))) __m256i avx2_descending_lanes(const Key* current_keys) {
+    if constexpr (is_same_v<Key, double>) {
+        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_loadu_pd(current_keys), _mm256_loadu_pd(current_keys + 1), _CMP_GT_OQ));
+    } else if constexpr (sizeof(Key) == 8) {
+        return _mm256_cmpgt_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(current_keys)),
+                                  _mm256_loadu_si256(reinterpret_cast<const __m256i*>(current_keys + 1)));
+    } else {
+        return _mm256_cmpgt_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(current_keys)),
+                                  _mm256_loadu_si256(reinterpret_cast<const __m256i*>(current_keys + 1)));
+    }
+}
+
+// Function: avx2_is_sorted_keys
+// Purpose: AVX2 sortedness check - compares each vector with the vector one element
+//          further on, four vectors per early-exit test
+// Parameters: key_values - contiguous int32, int64 or double keys
+// Returns: true when the keys are in non-descending order
+template <typename Key>
+__attribute__((target("avx2"))) bool avx2_is_sorted_keys(span<const Key> key_values) {
+    constexpr size_t VECTOR_LANES = 32 / sizeof(Key);
+    constexpr size_t UNROLLED_LENGTH = 4 * VECTOR_LANES;
+    const Key* key_data = key_values.data();
+    size_t element_count = key_values.size();
+
+    size_t block_begin = 0;
+    for (; block_begin + UNROLLED_LENGTH < element_count; block_begin += UNROLLED_LENGTH) {
+        __m256i violation_lanes = _mm256_or_si256(
+            _mm256_or_si256(avx2_descending_lanes(key_data + block_begin), avx2_descending_lanes(key_data + block_begin + VECTOR_LANES)),
+            _mm256_or_si256(avx2_descending_lanes(key_data + block_begin + 2 * VECTOR_LANES),
+                            avx2_descending_lanes(key_data + block_begin + 3 * VECTOR_LANES)));
+        if (!_mm256_testz_si256(violation_lanes, violation_lanes)) {
+            return false;
+        }
+    }
+    return portable_is_sorted_keys(key_values.subspan(block_begin));
+}
+
+#endif  // x86
+
+// Function: simd_is_sorted_keys
+// Purpose: Picks the AVX2 check when the CPU has it, the portable one otherwise
+template <typename Key>
+bool simd_is_sorted_keys(span<const Key> key_values) {
+#if defined(__x86_64__) || defined(__i386__)
+    static const bool avx2_available = __builtin_cpu_supports("avx2");
+    if (avx2_available) {
+        return avx2_is_sorted_keys(key_values);
+    }
+#endif
+    return portable_is_sorted_keys(key_values);
+}
+
+// Function: is_sorted_sequential
+// Purpose: Sortedness of one contiguous range - vectorized for plain int32/int64/double
+//          keys, scalar early-exit walk for projected keys
+template <typename Element, typename Projection>
+bool is_sorted_sequential(span<const Element> data_span, Projection projection) {
+    constexpr bool vectorizable_keys = (is_same_v<Element, int32_t> || is_same_v<Element, int64_t> ||
+                                        is_same_v<Element, double>) && is_same_v<Projection, identity>;
+    if constexpr (vectorizable_keys) {
+        return simd_is_sorted_keys(data_span);
+    } else {
+        return validate_sorting_correctness(data_span.begin(), data_span.end(), ranges::less{}, projection);
+    }
+}
+
+// Function: parallel_is_sorted
+// Purpose: Chunked sortedness check on the shared pool; each chunk also checks the
+//          boundary with its successor, and a shared flag stops chunks not yet started
+// Parameters: data_span - sorted output, projection - key extraction
+// Returns: true when the whole range is in non-descending key order
+template <typename Element, typename Projection>
+bool parallel_is_sorted(span<const Element> data_span, Projection projection) {
+    if (data_span.size() < PARALLEL_VALIDATION_THRESHOLD) {
+        return is_sorted_sequential(data_span, projection);
+    }
+
+    atomic<bool> order_violated{false};
+    parallel_task_group task_group(shared_thread_pool());
+    for (size_t chunk_begin = 0; chunk_begin < data_span.size(); chunk_begin += PARALLEL_VALIDATION_GRAIN) {
+        // Overlap one element so the chunk boundary is checked too
+        size_t chunk_length = min<size_t>(PARALLEL_VALIDATION_GRAIN + 1, data_span.size() - chunk_begin);
+        task_group.run([data_span, chunk_begin, chunk_length, projection, &order_violated] {
+            if (!order_violated.load(memory_order_relaxed) &&
+                !is_sorted_sequential(data_span.subspan(chunk_begin, chunk_length), projection)) {
+                order_violated.store(true, memory_order_relaxed);
+            }
+        });
+    }
+    task_group.wait();
+    return !order_violated.load();
+}
+
+// Function: mix_fingerprint_bits
+// Purpose: SplitMix64 finaliser - spreads every input bit over the whole word
+constexpr uint64_t mix_fingerprint_bits(uint64_t input_bits) {
+    input_bits = (input_bits ^ (input_bits >> 30)) * 0xBF58476D1CE4E5B9ull;
+    input_bits = (input_bits ^ (input_bits >> 27)) * 0x94D049BB133111EBull;
+    return input_bits ^ (input_bits >> 31);
+}
+
+// Function: element_fingerprint
+// Purpose: Hash of one element's full contents (key and, for records, payload)
+template <typename Element>
+uint64_t element_fingerprint(const Element& element_value) {
+    if constexpr (is_same_v<Element, benchmark_record>) {
+        return mix_fingerprint_bits(mix_fingerprint_bits(static_cast<uint64_t>(element_value.sort_key)) ^
+                                    static_cast<uint64_t>(element_value.payload));
+    } else if constexpr (is_same_v<Element, short_string_record>) {
+        uint64_t text_hash = element_value.text_length;
+        for (size_t byte_offset = 0; byte_offset < element_value.text_length; byte_offset += STRING_PREFIX_BYTES) {
+            text_hash = mix_fingerprint_bits(text_hash ^ radix_key_of(element_value.text_view().substr(byte_offset)));
+        }
+        return text_hash;
+    } else if constexpr (is_floating_point_v<Element>) {
+        return mix_fingerprint_bits(bit_cast<uint64_t>(static_cast<double>(element_value)));
+    } else {
+        return mix_fingerprint_bits(static_cast<uint64_t>(static_cast<int64_t>(element_value)));
+    }
+}
+
+// Function: compute_multiset_fingerprint
+// Purpose: Order-independent multiset hash (sum of element hashes mod 2^64). Input
+//          and output of a correct sort must match; overwriting, dropping or
+//          duplicating elements changes it. Large ranges are hashed in parallel chunks.
+// Parameters: data_span - elements to fingerprint
+// Returns: multiset fingerprint
+template <typename Element>
+uint64_t compute_multiset_fingerprint(span<const Element> data_span) {
+    auto fingerprint_chunk = [](span<const Element> chunk_span) {
+        uint64_t fingerprint_sum = 0;
+        for (const Element& element_value : chunk_span) {
+            fingerprint_sum += element_fingerprint(element_value);
+        }
+        return fingerprint_sum;
+    };
+    if (data_span.size() < PARALLEL_VALIDATION_THRESHOLD) {
+        return fingerprint_chunk(data_span);
+    }
+
+    size_t chunk_count = (data_span.size() + PARALLEL_VALIDATION_GRAIN - 1) / PARALLEL_VALIDATION_GRAIN;
+    vector<uint64_t> chunk_fingerprints(chunk_count);
+    parallel_task_group task_group(shared_thread_pool());
+    for (size_t chunk_index = 0; chunk_index < chunk_count; chunk_index++) {
+        task_group.run([&, chunk_index] {
+            size_t chunk_begin = chunk_index * PARALLEL_VALIDATION_GRAIN;
+            chunk_fingerprints[chunk_index] = fingerprint_chunk(
+                data_span.subspan(chunk_begin, min<size_t>(PARALLEL_VALIDATION_GRAIN, data_span.size() - chunk_begin)));
+        });
+    }
+    task_group.wait();
+    return accumulate(chunk_fingerprints.begin(), chunk_fingerprints.end(), uint64_t{0});
+}
+
+// Structure: sort_validation_result
+// Purpose: Outcome of validating one sorted output
+struct sort_validation_result {
+    bool keys_sorted = false;        // Non-descending key order
+    bool permutation_intact = false; // Same multiset of elements as the input
+
+    bool passed() const {
+        return keys_sorted && permutation_intact;
+    }
+};
+
+// Function: validate_sorted_permutation
+// Purpose: Full correctness check of a sort output - order and permutation
+// Parameters: sorted_output - engine output, projection - key extraction,
+//             input_fingerprint - multiset fingerprint of the unsorted input
+// Returns: validation outcome
+template <typename Element, typename Projection>
+sort_validation_result validate_sorted_permutation(span<const Element> sorted_output, Projection projection,
+                                                   uint64_t input_fingerprint) {
+    sort_validation_result validation_result;
+    validation_result.keys_sorted = parallel_is_sorted(sorted_output, projection);
+    validation_result.permutation_intact = compute_multiset_fingerprint(sorted_output) == input_fingerprint;
+    return validation_result;
+}
+
+// Enumeration: stability_verdict
+// Purpose: Outcome of sorting an index-tagged copy of the input
+enum class stability_verdict {
+    not_checked,      // The engine cannot sort tagged records
+    ties_preserved,   // Every run of equal keys kept its original index order
+    ties_reordered    // Some equal keys swapped relative order
+};
+
+// Function: stability_verdict_label
+// Purpose: Report and export label of a stability verdict
+const char* stability_verdict_label(stability_verdict verdict) {
+    switch (verdict) {
+        case stability_verdict::ties_preserved: return "verified";
+        case stability_verdict::ties_reordered: return "reordered";
+        default: return "not checked";
+    }
+}
+
+// Function: validate_stable_tie_order
+// Purpose: Checks that records with equal keys still carry ascending index tags
+// Parameters: sorted_records - key-ordered output whose payloads are original indices
+// Returns: true when no run of equal keys was reordered
+bool validate_stable_tie_order(span<const benchmark_record> sorted_records) {
+    for (size_t record_index = 1; record_index < sorted_records.size(); record_index++) {
+        const benchmark_record& previous_record = sorted_records[record_index - 1];
+        const benchmark_record& current_record = sorted_records[record_index];
+        if (previous_record.sort_key == current_record.sort_key && current_record.payload < previous_record.payload) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Function: verify_descriptor_stability
+// Purpose: Observes whether an engine keeps ties in order. Scalars cannot show it -
+//          equal ints are indistinguishable - so keys of the input, folded onto
+//          STABILITY_CHECK_KEY_CARDINALITY values to force ties, become records tagged
+//          with their original index and the engine sorts those. Untimed.
+// Parameters: input_elements - unsorted input of the measured pool
+// Returns: verdict, not_checked when the engine does not accept records
+template <typename Descriptor, typename Element>
+stability_verdict verify_descriptor_stability(span<const Element> input_elements) {
+    if constexpr (!Descriptor::template supports_element<benchmark_record>) {
+        return stability_verdict::not_checked;
+    } else {
+        vector<benchmark_record> tagged_records;
+        tagged_records.reserve(input_elements.size());
+        for (size_t element_index = 0; element_index < input_elements.size(); element_index++) {
+            // Order-preserving transform - defined for every key, including huge or infinite doubles
+            auto projected_key = invoke(benchmark_element_traits<Element>::key_projection, input_elements[element_index]);
+            int64_t element_key = static_cast<int64_t>(radix_key_of(projected_key) >> 1);
+            tagged_records.push_back(benchmark_element_traits<benchmark_record>::make_element(
+                element_key % STABILITY_CHECK_KEY_CARDINALITY, static_cast<int64_t>(element_index)));
+        }
+        Descriptor::sort(span<benchmark_record>(tagged_records), benchmark_element_traits<benchmark_record>::key_projection);
+        return validate_stable_tie_order(tagged_records) ? stability_verdict::ties_preserved
+                                                         : stability_verdict::ties_reordered;
+    }
+}
+
+/*
+================================================================================
+STREAMING SORT ENGINE - Incremental LSM runs with top-k, partial sort and rank queries
+================================================================================
+*/
+
+// Class: loser_tree
+// Purpose: Tournament tree for k-way merging. Internal nodes remember the loser of
+//          their match, so replacing the winner replays a single leaf-to-root path
+//          (log2 k comparisons). Exhausted leaves lose every match; ties go to the
+//          lower leaf index, which keeps merges stable.
+template <typename Key, typename LessThan = ranges::less>
+class loser_tree {
+public:
+    // Constructor: builds the tree over the initial head key of every leaf
+    // Parameters: initial_keys - head key per leaf, initial_exhausted - leaves with no keys
+    loser_tree(vector<Key> initial_keys, vector<bool> initial_exhausted, LessThan less_than = {})
+        : leaf_keys(move(initial_keys)), leaf_exhausted(initial_exhausted.begin(), initial_exhausted.end()),
+          key_less(less_than) {
+        size_t leaf_count = leaf_keys.size();
+        loser_nodes.assign(max<size_t>(leaf_count, 1), 0);
+
+        // Bottom-up tournament: leaves sit at positions k..2k-1 of an implicit heap
+        vector<size_t> subtree_winners(2 * leaf_count);
+        for (size_t leaf_index = 0; leaf_index < leaf_count; leaf_index++) {
+            subtree_winners[leaf_count + leaf_index] = leaf_index;
+        }
+        for (size_t node_index = leaf_count - 1; node_index >= 1 && leaf_count > 1; node_index--) {
+            size_t first_winner = subtree_winners[2 * node_index];
+            size_t second_winner = subtree_winners[2 * node_index + 1];
+            if (leaf_beats(second_winner, first_winner)) {
+                swap(first_winner, second_winner);
+            }
+            subtree_winners[node_index] = first_winner;
+            loser_nodes[node_index] = second_winner;
+        }
+        loser_nodes[0] = leaf_count > 1 ? subtree_winners[1] : 0;
+    }
+
+    // Function: winner_leaf
+    // Returns: leaf holding the smallest head key
+    size_t winner_leaf() const {
+        return loser_nodes[0];
+    }
+
+    // Function: winner_exhausted
+    // Returns: true when every leaf has run out of keys
+    bool winner_exhausted() const {
+        return leaf_keys.empty() || leaf_exhausted[loser_nodes[0]];
+    }
+
+    // Function: winner_key
+    // Returns: smallest head key (valid while not winner_exhausted)
+    const Key& winner_key() const {
+        return leaf_keys[loser_nodes[0]];
+    }
+
+    // Function: replace_winner
+    // Purpose: Gives the winning leaf its next key and replays its path
+    void replace_winner(const Key& next_key) {
+        leaf_keys[loser_nodes[0]] = next_key;
+        replay_from_leaf(loser_nodes[0]);
+    }
+
+    // Function: exhaust_winner
+    // Purpose: Marks the winning leaf as empty and replays its path
+    void exhaust_winner() {
+        leaf_exhausted[loser_nodes[0]] = true;
+        replay_from_leaf(loser_nodes[0]);
+    }
+
+private:
+    // Function: leaf_beats
+    // Returns: true when leaf first_leaf must be output before leaf second_leaf
+    bool leaf_beats(size_t first_leaf, size_t second_leaf) const {
+        if (leaf_exhausted[first_leaf] || leaf_exhausted[second_leaf]) {
+            return !leaf_exhausted[first_leaf] && (leaf_exhausted[second_leaf] || first_leaf < second_leaf);
+        }
+        if (key_less(leaf_keys[first_leaf], leaf_keys[second_leaf])) {
+            return true;
+        }
+        return !key_less(leaf_keys[second_leaf], leaf_keys[first_leaf]) && first_leaf < second_leaf;
+    }
+
+    // Function: replay_from_leaf
+    // Purpose: Re-runs the matches on the path from a leaf to the root
+    void replay_from_leaf(size_t leaf_index) {
+        size_t leaf_count = leaf_keys.size();
+        size_t current_winner = leaf_index;
+        for (size_t node_index = (leaf_count + leaf_index) / 2; node_index >= 1; node_index /= 2) {
+            if (leaf_beats(loser_nodes[node_index], current_winner)) {
+                swap(loser_nodes[node_index], current_winner);
+            }
+        }
+        loser_nodes[0] = current_winner;
+    }
+
+    vector<Key> leaf_keys;          // Current head key of every leaf
+    vector<uint8_t> leaf_exhausted; // Leaves without further keys - bytes, as bit access slows every match
+    vector<size_t> loser_nodes;     // [0] overall winner, [1..k-1] match losers
+    LessThan key_less;              // Key ordering
+};
+
+// Class: streaming_sort_engine
+// Purpose: Accepts elements in batches and keeps them as sorted runs, LSM style:
+//          each batch becomes a run and the newest runs are merged only once they
+//          are within STREAMING_COMPACTION_RATIO of the run before them, so every
+//          element is merged O(log N) times. Top-k, partial-sort and rank queries
+//          are answered from the runs without a full sort. An optional bounded heap
+//          tracks the k smallest elements online for consumers that need nothing else.
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+class streaming_sort_engine {
+public:
+    // Constructor
+    // Parameters: tracked_top_k - size of the online top-k heap (0 disables it),
+    //             retain_elements - keep sorted runs for partial-sort and rank queries,
+    //             comparator - key ordering, projection - key extraction
+    explicit streaming_sort_engine(size_t tracked_top_k = 0, bool retain_elements = true,
+                                   Compare comparator = {}, Projection projection = {})
+        : tracked_capacity(tracked_top_k), runs_retained(retain_elements),
+          less_than(make_element_comparator(comparator, projection)) {
+        tracked_heap.reserve(tracked_capacity);
+    }
+
+    // Function: append_batch
+    // Purpose: Ingests a batch - updates the online top-k heap, then sorts the batch
+    //          into a new run and performs any compactions the size tiers require
+    void append_batch(span<const Element> batch_elements) {
+        ingested_count += batch_elements.size();
+        if (tracked_capacity > 0) {
+            update_tracked_heap(batch_elements);
+        }
+        if (!runs_retained || batch_elements.empty()) {
+            return;
+        }
+
+        vector<Element> new_run(batch_elements.begin(), batch_elements.end());
+        introsort_partition_loop(new_run.begin(), new_run.end(), compute_introsort_depth_budget(new_run.size()), less_than);
+        sorted_runs.push_back(move(new_run));
+
+        // Size-tiered compaction: merge while the newest run has caught up with its predecessor
+        while (sorted_runs.size() >= 2 &&
+               sorted_runs[sorted_runs.size() - 2].size() <= STREAMING_COMPACTION_RATIO * sorted_runs.back().size()) {
+            merge_newest_runs();
+        }
+    }
+
+    // Function: compact
+    // Purpose: Merges every run into one (a full sort of everything ingested so far)
+    void compact() {
+        while (sorted_runs.size() >= 2) {
+            merge_newest_runs();
+        }
+    }
+
+    // Function: element_count
+    // Returns: number of elements ingested so far
+    size_t element_count() const {
+        return ingested_count;
+    }
+
+    // Function: run_count
+    // Returns: number of sorted runs currently held
+    size_t run_count() const {
+        return sorted_runs.size();
+    }
+
+    // Function: tracked_smallest
+    // Purpose: Online top-k answer - no run access, O(k log k)
+    // Returns: the min(k, N) smallest elements seen so far, ascending
+    vector<Element> tracked_smallest() const {
+        vector<Element> smallest_elements = tracked_heap;
+        sort_heap(smallest_elements.begin(), smallest_elements.end(), less_than);
+        return smallest_elements;
+    }
+
+    // Function: smallest_elements
+    // Purpose: Partial sort - locates the rank cut in every run, then merges only the
+    //          run prefixes below the cut through a loser tree
+    // Parameters: requested_count - k
+    // Returns: the min(k, N) smallest retained elements, ascending
+    vector<Element> smallest_elements(size_t requested_count) const {
+        vector<size_t> rank_cuts = locate_rank_cuts(min(requested_count, retained_count()));
+        vector<Element> head_elements(sorted_runs.size());
+        vector<bool> run_exhausted(sorted_runs.size());
+        for (size_t run_index = 0; run_index < sorted_runs.size(); run_index++) {
+            run_exhausted[run_index] = rank_cuts[run_index] == 0;
+            if (!run_exhausted[run_index]) {
+                head_elements[run_index] = sorted_runs[run_index].front();
+            }
+        }
+
+        vector<Element> merged_prefix;
+        merged_prefix.reserve(accumulate(rank_cuts.begin(), rank_cuts.end(), size_t{0}));
+        vector<size_t> run_cursors(sorted_runs.size(), 0);
+        loser_tree<Element, decltype(less_than)> merge_tree(move(head_elements), move(run_exhausted), less_than);
+        while (!merge_tree.winner_exhausted()) {
+            size_t winning_run = merge_tree.winner_leaf();
+            merged_prefix.push_back(merge_tree.winner_key());
+            if (++run_cursors[winning_run] < rank_cuts[winning_run]) {
+                merge_tree.replace_winner(sorted_runs[winning_run][run_cursors[winning_run]]);
+            } else {
+                merge_tree.exhaust_winner();
+            }
+        }
+        return merged_prefix;
+    }
+
+    // Function: element_at_rank
+    // Purpose: nth_element query - the smallest run head above the rank cut
+    // Parameters: element_rank - 0-based rank, must be below the retained count
+    // Returns: the element a full sort would place at element_rank
+    Element element_at_rank(size_t element_rank) const {
+        vector<size_t> rank_cuts = locate_rank_cuts(element_rank);
+        const Element* rank_element = nullptr;
+        for (size_t run_index = 0; run_index < sorted_runs.size(); run_index++) {
+            if (rank_cuts[run_index] < sorted_runs[run_index].size()) {
+                const Element& candidate = sorted_runs[run_index][rank_cuts[run_index]];
+                if (rank_element == nullptr || less_than(candidate, *rank_element)) {
+                    rank_element = &candidate;
+                }
+            }
+        }
+        return *rank_element;
+    }
+
+private:
+    // Function: retained_count
+    // Returns: elements held in runs
+    size_t retained_count() const {
+        size_t element_total = 0;
+        for (const vector<Element>& sorted_run : sorted_runs) {
+            element_total += sorted_run.size();
+        }
+        return element_total;
+    }
+
+    // Function: update_tracked_heap
+    // Purpose: Keeps the k smallest elements in a max-heap; once the heap is full an
+    //          element costs one comparison unless it beats the current k-th smallest
+    void update_tracked_heap(span<const Element> batch_elements) {
+        for (const Element& batch_element : batch_elements) {
+            if (tracked_heap.size() < tracked_capacity) {
+                tracked_heap.push_back(batch_element);
+                push_heap(tracked_heap.begin(), tracked_heap.end(), less_than);
+            } else if (less_than(batch_element, tracked_heap.front())) {
+                pop_heap(tracked_heap.begin(), tracked_heap.end(), less_than);
+                tracked_heap.back() = batch_element;
+                push_heap(tracked_heap.begin(), tracked_heap.end(), less_than);
+            }
+        }
+    }
+
+    // Function: merge_newest_runs
+    // Purpose: Replaces the two newest runs by their merge
+    void merge_newest_runs() {
+        vector<Element> newest_run = move(sorted_runs.back());
+        sorted_runs.pop_back();
+        vector<Element>& older_run = sorted_runs.back();
+        vector<Element> merged_run(older_run.size() + newest_run.size());
+        merge(make_move_iterator(older_run.begin()), make_move_iterator(older_run.end()),
+              make_move_iterator(newest_run.begin()), make_move_iterator(newest_run.end()),
+              merged_run.begin(), less_than);
+        older_run = move(merged_run);
+    }
+
+    // Function: locate_rank_cuts
+    // Purpose: Multi-run selection - finds per-run cut positions whose prefixes hold
+    //          exactly target_rank elements, none greater than any suffix element.
+    //          Each round takes the middle element of the widest remaining window as
+    //          pivot, counts keys below and equal to it in every window by binary
+    //          search, and discards the side that cannot contain the rank
+    // Parameters: target_rank - number of elements the prefixes must contain (<= retained count)
+    // Returns: one cut position per run
+    vector<size_t> locate_rank_cuts(size_t target_rank) const {
+        size_t run_total = sorted_runs.size();
+        vector<size_t> window_begins(run_total, 0);
+        vector<size_t> window_ends(run_total);
+        for (size_t run_index = 0; run_index < run_total; run_index++) {
+            window_ends[run_index] = sorted_runs[run_index].size();
+        }
+        vector<size_t> below_cuts(run_total);
+        vector<size_t> through_cuts(run_total);
+
+        size_t remaining_rank = target_rank;  // Rank still to place inside the windows
+        while (true) {
+            size_t widest_run = run_total;
+            size_t widest_length = 0;
+            for (size_t run_index = 0; run_index < run_total; run_index++) {
+                if (window_ends[run_index] - window_begins[run_index] > widest_length) {
+                    widest_length = window_ends[run_index] - window_begins[run_index];
+                    widest_run = run_index;
+                }
+            }
+            if (widest_run == run_total) {
+                return window_begins;  // All windows empty - remaining_rank is 0
+            }
+
+            const Element& pivot_element = sorted_runs[widest_run][window_begins[widest_run] + widest_length / 2];
+            size_t total_below = 0;
+            size_t total_through = 0;
+            for (size_t run_index = 0; run_index < run_total; run_index++) {
+                auto window_begin = sorted_runs[run_index].begin() + window_begins[run_index];
+                auto window_end = sorted_runs[run_index].begin() + window_ends[run_index];
+                below_cuts[run_index] = lower_bound(window_begin, window_end, pivot_element, less_than) - sorted_runs[run_index].begin();
+                through_cuts[run_index] = upper_bound(window_begin, window_end, pivot_element, less_than) - sorted_runs[run_index].begin();
+                total_below += below_cuts[run_index] - window_begins[run_index];
+                total_through += through_cuts[run_index] - window_begins[run_index];
+            }
+
+            if (remaining_rank < total_below) {
+                window_ends = below_cuts;
+            } else if (remaining_rank > total_through) {
+                remaining_rank -= total_through;
+                window_begins = through_cuts;
+            } else {
+                // The cut falls among pivot-equal keys - hand them out oldest run first
+                size_t equal_quota = remaining_rank - total_below;
+                for (size_t run_index = 0; run_index < run_total; run_index++) {
+                    size_t equal_taken = min(equal_quota, through_cuts[run_index] - below_cuts[run_index]);
+                    below_cuts[run_index] += equal_taken;
+                    equal_quota -= equal_taken;
+                }
+                return below_cuts;
+            }
+        }
+    }
+
+    size_t tracked_capacity;                       // k of the online heap, 0 when disabled
+    bool runs_retained;                            // Whether batches are kept as runs
+    projected_comparator<Compare, Projection> less_than;  // Element ordering
+    vector<Element> tracked_heap;                  // Max-heap of the k smallest elements
+    vector<vector<Element>> sorted_runs;           // Oldest (largest) run first
+    size_t ingested_count = 0;                     // Elements appended so far
+};
+
+/*
+================================================================================
+CACHE-BLOCKED MERGE SORT - L2-sized blocks, L3-sized multiway merges, streaming output
+================================================================================
+*/
+
+// Structure: cache_hierarchy_info
+// Purpose: Data cache capacities the blocked engines are tuned to
+struct cache_hierarchy_info {
+    size_t l1_data_bytes = CACHE_FALLBACK_L1D_BYTES;
+    size_t l2_bytes = CACHE_FALLBACK_L2_BYTES;
+    size_t l3_bytes = CACHE_FALLBACK_L3_BYTES;
+    string detection_source = "defaults";  // sysconf, sysfs or defaults
+};
+
+// Function: read_sysfs_cache_bytes
+// Purpose: Looks up the capacity of a data or unified cache level of CPU 0 in sysfs
+// Parameters: cache_level - 1, 2 or 3
+// Returns: capacity in bytes, 0 when not described
+size_t read_sysfs_cache_bytes(int cache_level) {
+#ifdef __linux__
+    for (int index_number = 0; index_number < 16; index_number++) {
+        string index_path = "/sys/devices/system/cpu/cpu0/cache/index" + to_string(index_number) + "/";
+        ifstream level_file(index_path + "level");
+        ifstream type_file(index_path + "type");
+        ifstream size_file(index_path + "size");
+        int listed_level = 0;
+        string cache_type;
+        string size_text;
+        if (!(level_file >> listed_level) || !(type_file >> cache_type) || !(size_file >> size_text)) {
+            break;  // Indices are contiguous - the first missing one ends the list
+        }
+        if (listed_level != cache_level || cache_type == "Instruction") {
+            continue;
+        }
+        size_t cache_bytes = stoull(size_text);
+        char unit_suffix = size_text.back();
+        if (unit_suffix == 'K') {
+            cache_bytes <<= 10;
+        } else if (unit_suffix == 'M') {
+            cache_bytes <<= 20;
+        }
+        return cache_bytes;
+    }
+#else
+    (void)cache_level;
+#endif
+    return 0;
+}
+
+// Function: detect_cache_hierarchy
+// Purpose: Reads cache sizes from sysconf (glibc answers from CPUID), then sysfs for
+//          levels sysconf leaves unknown; anything still missing keeps its fallback
+// Returns: detected hierarchy
+cache_hierarchy_info detect_cache_hierarchy() {
+    cache_hierarchy_info cache_info;
+    array<size_t*, 3> level_fields = {&cache_info.l1_data_bytes, &cache_info.l2_bytes, &cache_info.l3_bytes};
+    array<bool, 3> level_detected = {false, false, false};
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+    array<long, 3> sysconf_sizes = {sysconf(_SC_LEVEL1_DCACHE_SIZE), sysconf(_SC_LEVEL2_CACHE_SIZE),
+                                    sysconf(_SC_LEVEL3_CACHE_SIZE)};
+    for (size_t level_index = 0; level_index < 3; level_index++) {
+        if (sysconf_sizes[level_index] > 0) {
+            *level_fields[level_index] = static_cast<size_t>(sysconf_sizes[level_index]);
+            level_detected[level_index] = true;
+            cache_info.detection_source = "sysconf";
+        }
+    }
+#endif
+    for (size_t level_index = 0; level_index < 3; level_index++) {
+        if (!level_detected[level_index]) {
+            size_t sysfs_bytes = read_sysfs_cache_bytes(static_cast<int>(level_index) + 1);
+            if (sysfs_bytes > 0) {
+                *level_fields[level_index] = sysfs_bytes;
+                cache_info.detection_source = cache_info.detection_source == "defaults" ? "sysfs" : "sysconf+sysfs";
+            }
+        }
+    }
+    // Parts without an L3 behave as if the L2 were the last level
+    cache_info.l3_bytes = max(cache_info.l3_bytes, cache_info.l2_bytes);
+    return cache_info;
+}
+
+// Function: active_cache_hierarchy
+// Purpose: Cache sizes detected once at first use
+// Returns: reference to the process-wide detection result
+const cache_hierarchy_info& active_cache_hierarchy() {
+    static const cache_hierarchy_info detected_hierarchy = detect_cache_hierarchy();
+    return detected_hierarchy;
+}
+
+// Structure: blocked_merge_geometry
+// Purpose: Block and fan-in sizes of one blocked merge sort call
+struct blocked_merge_geometry {
+    size_t block_elements;  // Elements sorted together inside L2
+    size_t fan_in;          // Runs combined by one multiway merge
+};
+
+// Function: plan_blocked_merge
+// Purpose: Derives the geometry from the cache sizes unless the run configuration
+//          fixes it. A block takes half of L2 so the block sort's scratch fits beside
+//          it; the fan-in keeps one level-0 group of blocks and its output within L3.
+// Parameters: element_bytes - size of one element
+// Returns: geometry for the call
+blocked_merge_geometry plan_blocked_merge(size_t element_bytes) {
+    const cache_hierarchy_info& cache_info = active_cache_hierarchy();
+    const benchmark_run_configuration& run_configuration = active_run_configuration();
+    size_t block_bytes = run_configuration.merge_block_bytes != 0 ? run_configuration.merge_block_bytes
+                                                                  : cache_info.l2_bytes / 2;
+    blocked_merge_geometry geometry;
+    geometry.block_elements = max<size_t>(POWERSORT_MINIMUM_RUN, block_bytes / element_bytes);
+    geometry.fan_in = run_configuration.merge_fan_in != 0
+        ? run_configuration.merge_fan_in
+        : cache_info.l3_bytes / 2 / (geometry.block_elements * element_bytes);
+    geometry.fan_in = clamp<size_t>(geometry.fan_in, 2, BLOCKED_MERGE_MAXIMUM_FAN_IN);
+    return geometry;
+}
+
+// Function: stream_store_elements
+// Purpose: Copies elements with non-temporal stores, so output that will not be read
+//          again soon bypasses the cache instead of evicting the merge inputs. Falls
+//          back to a plain copy for non-trivial types or targets without SSE2.
+// Parameters: target - destination, source - staged elements, element_count - elements
+template <typename Element>
+void stream_store_elements(Element* target, const Element* source, size_t element_count) {
+#if defined(__SSE2__)
+    if constexpr (is_trivially_copyable_v<Element>) {
+        char* target_bytes = reinterpret_cast<char*>(target);
+        const char* source_bytes = reinterpret_cast<const char*>(source);
+        size_t byte_count = element_count * sizeof(Element);
+        size_t byte_offset = min(byte_count, (16 - reinterpret_cast<uintptr_t>(target_bytes) % 16) % 16);
+        memcpy(target_bytes, source_bytes, byte_offset);  // Unaligned head
+        for (; byte_offset + 16 <= byte_count; byte_offset += 16) {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(target_bytes + byte_offset),
+                             _mm_loadu_si128(reinterpret_cast<const __m128i*>(source_bytes + byte_offset)));
+        }
+        memcpy(target_bytes + byte_offset, source_bytes + byte_offset, byte_count - byte_offset);  // Tail
+        return;
+    }
+#endif
+    copy(source, source + element_count, target);
+}
+
+// Function: stream_store_fence
+// Purpose: Orders earlier non-temporal stores before any later access to the output
+inline void stream_store_fence() {
+#if defined(__SSE2__)
+    _mm_sfence();
+#endif
+}
+
+// Function: multiway_merge_group
+// Purpose: Merges consecutive sorted runs of run_length in [group_begin, group_end)
+//          of the source into the same positions of the target through a loser tree;
+//          ties go to the earlier run, so the merge is stable. With streaming_stores
+//          the output is staged in L1 and flushed with non-temporal stores.
+// Parameters: source_begin/target_begin - buffers, group_begin/group_end - offsets,
+//             run_length - sorted run size, less_than - element comparator,
+//             streaming_stores - bypass the cache for the output
+template <typename SourceIt, typename TargetIt, typename LessThan>
+void multiway_merge_group(SourceIt source_begin, TargetIt target_begin, size_t group_begin, size_t group_end,
+                          size_t run_length, LessThan less_than, bool streaming_stores) {
+    using element_type = iter_value_t<SourceIt>;
+    constexpr bool can_stream = contiguous_iterator<TargetIt> && is_trivially_copyable_v<element_type>;
+    constexpr size_t staging_capacity = max<size_t>(1, BLOCKED_MERGE_STAGING_BYTES / sizeof(element_type));
+
+    size_t run_count = (group_end - group_begin + run_length - 1) / run_length;
+    vector<size_t> run_cursors(run_count);
+    vector<size_t> run_ends(run_count);
+    vector<element_type> head_elements(run_count);
+    for (size_t run_index = 0; run_index < run_count; run_index++) {
+        run_cursors[run_index] = group_begin + run_index * run_length;
+        run_ends[run_index] = min(run_cursors[run_index] + run_length, group_end);
+        head_elements[run_index] = source_begin[run_cursors[run_index]];
+    }
+    loser_tree<element_type, LessThan> merge_tree(move(head_elements), vector<bool>(run_count, false), less_than);
+
+    size_t output_index = group_begin;
+    array<element_type, can_stream ? staging_capacity : 1> staging_buffer;
+    size_t staged_count = 0;
+    while (!merge_tree.winner_exhausted()) {
+        size_t winner_run = merge_tree.winner_leaf();
+        if constexpr (can_stream) {
+            if (streaming_stores) {
+                staging_buffer[staged_count++] = merge_tree.winner_key();
+                if (staged_count == staging_capacity) {
+                    stream_store_elements(to_address(target_begin + output_index), staging_buffer.data(), staged_count);
+                    output_index += staged_count;
+                    staged_count = 0;
+                }
+            } else {
+                target_begin[output_index++] = merge_tree.winner_key();
+            }
+        } else {
+            target_begin[output_index++] = merge_tree.winner_key();
+        }
+        if (++run_cursors[winner_run] < run_ends[winner_run]) {
+            merge_tree.replace_winner(source_begin[run_cursors[winner_run]]);
+        } else {
+            merge_tree.exhaust_winner();
+        }
+    }
+    if constexpr (can_stream) {
+        if (staged_count > 0) {
+            stream_store_elements(to_address(target_begin + output_index), staging_buffer.data(), staged_count);
+        }
+    }
+}
+
+// Function: execute_blocked_merge_sort_algorithm
+// Purpose: Implements a cache-blocked merge sort. Blocks of half the L2 are sorted
+//          with powersort; each group of fan_in blocks is merged right after its
+//          blocks are sorted, while it is still in L3; the higher levels merge fan_in
+//          runs at a time, and the final level writes with non-temporal stores when
+//          the data exceeds L3. The buffer the blocks are sorted in is chosen so the
+//          final level always lands in the caller's range. Stable.
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_blocked_merge_sort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    using element_type = iter_value_t<RandomIt>;
+    auto less_than = make_element_comparator(comparator, projection);
+    size_t array_length = last - first;
+    blocked_merge_geometry geometry = plan_blocked_merge(sizeof(element_type));
+    if (array_length <= geometry.block_elements) {
+        execute_powersort_algorithm(first, last, comparator, projection);
+        return;
+    }
+
+    int merge_levels = 0;
+    for (size_t run_length = geometry.block_elements; run_length < array_length; run_length *= geometry.fan_in) {
+        merge_levels++;
+    }
+    // Narrowest fan-in that still needs no extra level - avoids a lopsided last level
+    size_t block_count = (array_length + geometry.block_elements - 1) / geometry.block_elements;
+    for (size_t balanced_fan_in = 2; balanced_fan_in < geometry.fan_in; balanced_fan_in++) {
+        size_t reachable_blocks = 1;
+        for (int merge_level = 0; merge_level < merge_levels; merge_level++) {
+            reachable_blocks *= balanced_fan_in;
+        }
+        if (reachable_blocks >= block_count) {
+            geometry.fan_in = balanced_fan_in;
+            break;
+        }
+    }
+    bool stream_final_level = array_length * sizeof(element_type) > active_cache_hierarchy().l3_bytes;
+
+    scratch_buffer_lease<element_type> scratch_buffer(array_length);
+    element_type* scratch_begin = scratch_buffer.data();
+    bool result_in_scratch = merge_levels % 2 == 1;  // Where the sorted blocks live
+
+    // Level 0: sort the blocks of one group, then merge the group while it is cached
+    size_t group_length = geometry.block_elements * geometry.fan_in;
+    for (size_t group_begin = 0; group_begin < array_length; group_begin += group_length) {
+        size_t group_end = min(group_begin + group_length, array_length);
+        for (size_t block_begin = group_begin; block_begin < group_end; block_begin += geometry.block_elements) {
+            size_t block_end = min(block_begin + geometry.block_elements, group_end);
+            if (result_in_scratch) {
+                move(first + block_begin, first + block_end, scratch_begin + block_begin);
+                execute_powersort_algorithm(scratch_begin + block_begin, scratch_begin + block_end, comparator, projection);
+            } else {
+                execute_powersort_algorithm(first + block_begin, first + block_end, comparator, projection);
+            }
+        }
+        bool streaming_stores = merge_levels == 1 && stream_final_level;
+        if (result_in_scratch) {
+            multiway_merge_group(scratch_begin, first, group_begin, group_end, geometry.block_elements, less_than,
+                                 streaming_stores);
+        } else {
+            multiway_merge_group(first, scratch_begin, group_begin, group_end, geometry.block_elements, less_than,
+                                 streaming_stores);
+        }
+    }
+    result_in_scratch = !result_in_scratch;
+
+    // Higher levels: each pass multiplies the run length by the fan-in
+    int merge_level = 1;
+    for (size_t run_length = group_length; run_length < array_length; run_length *= geometry.fan_in, merge_level++) {
+        bool streaming_stores = merge_level == merge_levels - 1 && stream_final_level;
+        size_t level_group_length = run_length * geometry.fan_in;
+        for (size_t group_begin = 0; group_begin < array_length; group_begin += level_group_length) {
+            size_t group_end = min(group_begin + level_group_length, array_length);
+            if (result_in_scratch) {
+                multiway_merge_group(scratch_begin, first, group_begin, group_end, run_length, less_than, streaming_stores);
+            } else {
+                multiway_merge_group(first, scratch_begin, group_begin, group_end, run_length, less_than, streaming_stores);
+            }
+        }
+        result_in_scratch = !result_in_scratch;
+    }
+    if (stream_final_level) {
+        stream_store_fence();
+    }
+}
+
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_blocked_merge_sort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_blocked_merge_sort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
+// Function: measure_memory_copy_bandwidth
+// Purpose: Memory-bandwidth ceiling for the reports - best of three memcpy passes over
+//          a buffer several times the L3, measured once per process
+// Returns: copied gigabytes per second (bytes read once and written once)
+double measure_memory_copy_bandwidth() {
+    static const double copy_gigabytes_per_second = [] {
+        size_t probe_bytes = max(BANDWIDTH_PROBE_MINIMUM_BYTES, 4 * active_cache_hierarchy().l3_bytes);
+        vector<char> source_buffer(probe_bytes, 1);
+        vector<char> target_buffer(probe_bytes, 0);  // Pre-faulted so page faults stay out of the probe
+        double best_nanoseconds = numeric_limits<double>::infinity();
+        for (int probe_round = 0; probe_round < 3; probe_round++) {
+            auto copy_start = steady_clock::now();
+            memcpy(target_buffer.data(), source_buffer.data(), probe_bytes);
+            best_nanoseconds = min(best_nanoseconds, duration<double, nano>(steady_clock::now() - copy_start).count());
+            source_buffer[probe_round] = target_buffer[probe_bytes - 1 - probe_round];  // Keep the copies observable
+        }
+        return probe_bytes / best_nanoseconds;  // Bytes per ns equals GB/s
+    }();
+    return copy_gigabytes_per_second;
+}
+
+/*
+================================================================================
+ADAPTIVE DISPATCH - Input sampling and per-call strategy selection
+================================================================================
+*/
+
+// Enumeration: adaptive_strategy
+// Purpose: Engines the adaptive dispatcher can route a call to
+enum class adaptive_strategy {
+    insertion_sort,  // Tiny inputs
+    run_merge,       // Run-structured inputs (sorted, reversed, organ pipe) - powersort
+    counting_sort,   // Integral keys whose sampled range is small next to N
+    radix_sort,      // Integral keys large enough to amortise the digit passes
+    introsort,       // Everything else
+};
+constexpr size_t ADAPTIVE_STRATEGY_COUNT = 5;
+
+// Function: adaptive_strategy_label
+// Returns: report name of a strategy
+const char* adaptive_strategy_label(adaptive_strategy chosen_strategy) {
+    switch (chosen_strategy) {
+        case adaptive_strategy::insertion_sort: return "insertion";
+        case adaptive_strategy::run_merge:      return "run-merge";
+        case adaptive_strategy::counting_sort:  return "counting";
+        case adaptive_strategy::radix_sort:     return "radix";
+        case adaptive_strategy::introsort:      return "introsort";
+    }
+    return "unknown";
+}
+
+// Structure: adaptive_dispatch_thresholds
+// Purpose: Decision thresholds - defaults come from the distribution matrix; the sweep
+//          mode can recalibrate the size thresholds and load them via
+//          SORTER_ADAPTIVE_CALIBRATION
+struct adaptive_dispatch_thresholds {
+    size_t insertion_maximum_size = ADAPTIVE_INSERTION_MAXIMUM_SIZE;  // Largest N sent to insertion sort
+    size_t radix_minimum_size = ADAPTIVE_RADIX_MINIMUM_SIZE;          // Smallest N sent to radix sort
+    double run_merge_window_ratio = ADAPTIVE_RUN_MERGE_WINDOW_RATIO;    // Monotone sample windows at or above -> run merge
+    double counting_maximum_range_ratio = COUNTING_SORT_MAXIMUM_RANGE_RATIO;  // Sampled key span per element at or below -> counting
+};
+
+// Function: active_adaptive_thresholds
+// Purpose: Process-wide thresholds used by execute_adaptive_sort_algorithm
+// Returns: mutable reference (calibration writes it once at startup)
+adaptive_dispatch_thresholds& active_adaptive_thresholds() {
+    static adaptive_dispatch_thresholds process_thresholds;
+    return process_thresholds;
+}
+
+// Structure: input_characteristics
+// Purpose: What the sampler learned about one input
+struct input_characteristics {
+    size_t element_count = 0;     // N
+    double descent_ratio = 0.0;   // Sampled adjacent pairs in descending order (0 sorted, ~0.5 random, 1 reversed)
+    double monotone_window_ratio = 0.0;  // Sample windows lying inside one ascending or descending run
+    double duplicate_ratio = 0.0; // Sampled keys equal to another sampled key
+    int key_range_bits = -1;      // Bits spanned by the sampled key range, -1 for non-integral keys
+    uint64_t key_span = 0;        // Sampled largest minus smallest key, integral keys only
+};
+
+// Function: sample_input_characteristics
+// Purpose: Cheap O(sample) probe - up to ADAPTIVE_SAMPLE_WINDOWS evenly spaced windows
+//          of adjacent pairs for presortedness, up to ADAPTIVE_SAMPLE_KEYS evenly spaced
+//          keys (sorted) for duplicates and key range; both shrink with N so small
+//          inputs are not dominated by the probe
+// Parameters: first/last - input range, less_than - element comparator, projection - key extraction
+// Returns: sampled characteristics
+template <typename RandomIt, typename LessThan, typename Projection>
+input_characteristics sample_input_characteristics(RandomIt first, RandomIt last, LessThan less_than, Projection projection) {
+    input_characteristics characteristics;
+    size_t array_length = last - first;
+    characteristics.element_count = array_length;
+    if (array_length < 2) {
+        return characteristics;
+    }
+
+    // Presortedness: descents inside short windows spread over the range
+    size_t window_pairs = min(ADAPTIVE_SAMPLE_WINDOW_PAIRS, array_length - 1);
+    size_t window_count = clamp<size_t>((array_length - 1) / (4 * window_pairs), 1, ADAPTIVE_SAMPLE_WINDOWS);  // At most 1/4 of N
+    size_t window_stride = (array_length - 1 - window_pairs) / max<size_t>(1, window_count - 1);
+    size_t descent_count = 0;
+    size_t monotone_windows = 0;
+    for (size_t window_index = 0; window_index < window_count; window_index++) {
+        RandomIt window_begin = first + window_index * window_stride;
+        size_t window_descents = 0;
+        for (size_t pair_index = 0; pair_index < window_pairs; pair_index++) {
+            window_descents += less_than(window_begin[pair_index + 1], window_begin[pair_index]) ? 1 : 0;
+        }
+        descent_count += window_descents;
+        monotone_windows += (window_descents == 0 || window_descents == window_pairs) ? 1 : 0;
+    }
+    characteristics.descent_ratio = static_cast<double>(descent_count) / (window_count * window_pairs);
+    characteristics.monotone_window_ratio = static_cast<double>(monotone_windows) / window_count;
+
+    // Duplicates and range: sort a strided key sample
+    using key_type = remove_cvref_t<invoke_result_t<Projection&, iter_reference_t<RandomIt>>>;
+    size_t sample_count = clamp<size_t>(array_length / 8, 2, ADAPTIVE_SAMPLE_KEYS);
+    vector<key_type> sampled_keys;
+    sampled_keys.reserve(sample_count);
+    for (size_t sample_index = 0; sample_index < sample_count; sample_index++) {
+        sampled_keys.push_back(invoke(projection, first[sample_index * array_length / sample_count]));
+    }
+    insertion_sort_range(sampled_keys.begin(), sampled_keys.end(), ranges::less{});
+    size_t duplicate_count = 0;
+    for (size_t sample_index = 1; sample_index < sample_count; sample_index++) {
+        duplicate_count += sampled_keys[sample_index] == sampled_keys[sample_index - 1] ? 1 : 0;
+    }
+    characteristics.duplicate_ratio = static_cast<double>(duplicate_count) / (sample_count - 1);
+    if constexpr (integral<key_type>) {
+        characteristics.key_span = static_cast<uint64_t>(radix_key_of(sampled_keys.back()) - radix_key_of(sampled_keys.front()));
+        characteristics.key_range_bits = bit_width(characteristics.key_span);
+    }
+    return characteristics;
+}
+
+// Structure: adaptive_decision_record
+// Purpose: One audited dispatch decision
+struct adaptive_decision_record {
+    input_characteristics sampled_input;  // What the sampler saw
+    adaptive_strategy chosen_strategy;    // Where the call was routed
+    const char* decision_reason;          // Which rule fired
+};
+
+// Class: adaptive_decision_log
+// Purpose: Thread-safe audit trail of dispatch decisions - per-strategy totals over
+//          every call plus the most recent ADAPTIVE_DECISION_LOG_CAPACITY records
+class adaptive_decision_log {
+public:
+    // Function: record_decision
+    // Purpose: Appends one decision, overwriting the oldest once the ring is full
+    void record_decision(const adaptive_decision_record& decision) {
+        lock_guard<mutex> log_lock(log_mutex);
+        strategy_totals[static_cast<size_t>(decision.chosen_strategy)]++;
+        if (recent_decisions.size() < ADAPTIVE_DECISION_LOG_CAPACITY) {
+            recent_decisions.push_back(decision);
+        } else {
+            recent_decisions[total_decisions % ADAPTIVE_DECISION_LOG_CAPACITY] = decision;
+        }
+        total_decisions++;
+    }
+
+    // Function: snapshot
+    // Purpose: Copies the totals and recent records for reporting
+    void snapshot(array<size_t, ADAPTIVE_STRATEGY_COUNT>& totals_out, vector<adaptive_decision_record>& records_out) const {
+        lock_guard<mutex> log_lock(log_mutex);
+        totals_out = strategy_totals;
+        records_out = recent_decisions;
+    }
+
+private:
+    mutable mutex log_mutex;
+    array<size_t, ADAPTIVE_STRATEGY_COUNT> strategy_totals{};  // Calls per strategy
+    vector<adaptive_decision_record> recent_decisions;         // Ring of recent decisions
+    size_t total_decisions = 0;                                // Decisions ever recorded
+};
+
+// Function: adaptive_dispatch_log
+// Returns: process-wide decision log
+adaptive_decision_log& adaptive_dispatch_log() {
+    static adaptive_decision_log process_log;
+    return process_log;
+}
+
+// Function: choose_adaptive_strategy
+// Purpose: Applies the thresholds to the sampled characteristics
+// Parameters: sampled_input - sampler output, radix_eligible - integral keys in ascending order,
+//             thresholds - decision thresholds
+// Returns: decision with the rule that fired
+adaptive_decision_record choose_adaptive_strategy(const input_characteristics& sampled_input, bool radix_eligible,
+                                                  const adaptive_dispatch_thresholds& thresholds) {
+    if (sampled_input.element_count <= thresholds.insertion_maximum_size) {
+        return {sampled_input, adaptive_strategy::insertion_sort, "size at or below insertion threshold"};
+    }
+    if (sampled_input.monotone_window_ratio >= thresholds.run_merge_window_ratio) {
+        return {sampled_input, adaptive_strategy::run_merge, "sample windows mostly inside natural runs"};
+    }
+    if (radix_eligible && sampled_input.key_span <= thresholds.counting_maximum_range_ratio * sampled_input.element_count &&
+        sampled_input.key_span < COUNTING_SORT_HISTOGRAM_BYTES / sizeof(uint32_t)) {
+        return {sampled_input, adaptive_strategy::counting_sort, "sampled key range small next to N"};
+    }
+    if (radix_eligible && sampled_input.element_count >= thresholds.radix_minimum_size) {
+        return {sampled_input, adaptive_strategy::radix_sort, "integral keys above radix threshold"};
+    }
+    return {sampled_input, adaptive_strategy::introsort, "no structure detected"};
+}
+
+// Function: execute_adaptive_sort_algorithm
+// Purpose: Samples the input, routes to the engine the thresholds pick and logs the
+//          decision for auditing
+// Parameters: first/last - random-access range requiring sorting operation,
+//             comparator - key ordering, projection - key extraction
+template <typename RandomIt, typename Compare = ranges::less, typename Projection = identity>
+void execute_adaptive_sort_algorithm(RandomIt first, RandomIt last, Compare comparator = {}, Projection projection = {}) {
+    auto less_than = make_element_comparator(comparator, projection);
+    constexpr bool radix_eligible = is_same_v<Compare, ranges::less> && radix_sortable_range<RandomIt, Projection>;
+
+    // Tiny inputs skip the sampler - it would cost more than the sort itself
+    const adaptive_dispatch_thresholds& thresholds = active_adaptive_thresholds();
+    input_characteristics sampled_input;
+    sampled_input.element_count = last - first;
+    if (sampled_input.element_count > thresholds.insertion_maximum_size) {
+        sampled_input = sample_input_characteristics(first, last, less_than, projection);
+    }
+    adaptive_decision_record decision = choose_adaptive_strategy(sampled_input, radix_eligible, thresholds);
+    adaptive_dispatch_log().record_decision(decision);
+
+    switch (decision.chosen_strategy) {
+        case adaptive_strategy::insertion_sort:
+            insertion_sort_range(first, last, less_than);
+            break;
+        case adaptive_strategy::run_merge:
+            execute_powersort_algorithm(first, last, comparator, projection);
+            break;
+        case adaptive_strategy::counting_sort:
+            if constexpr (radix_eligible) {
+                execute_counting_sort_algorithm(first, last, projection);  // Falls back if the exact range overflows the histogram
+            }
+            break;
+        case adaptive_strategy::radix_sort:
+            if constexpr (radix_eligible) {
+                execute_lsd_radix_sort_algorithm(first, last, projection);
+            }
+            break;
+        case adaptive_strategy::introsort:
+            execute_introsort_algorithm(first, last, comparator, projection);
+            break;
+    }
+}
+
+template <typename Element, typename Compare = ranges::less, typename Projection = identity>
+void execute_adaptive_sort_algorithm(span<Element> data_span, Compare comparator = {}, Projection projection = {}) {
+    execute_adaptive_sort_algorithm(data_span.begin(), data_span.end(), comparator, projection);
+}
+
+// Function: load_adaptive_thresholds
+// Purpose: Reads "name=value" lines written by "sweep --calibration-out"
+// Parameters: calibration_path - file to read, thresholds - updated in place
+// Returns: false (with a message on cerr) when the file is unreadable or malformed
+bool load_adaptive_thresholds(const string& calibration_path, adaptive_dispatch_thresholds& thresholds) {
+    ifstream calibration_file(calibration_path);
+    if (!calibration_file) {
+        cerr << "Cannot read adaptive calibration " << calibration_path << endl;
+        return false;
+    }
+    string calibration_line;
+    while (getline(calibration_file, calibration_line)) {
+        size_t separator_position = calibration_line.find('=');
+        if (calibration_line.empty() || calibration_line[0] == '#') {
+            continue;
+        }
+        if (separator_position == string::npos) {
+            cerr << "Malformed calibration line: " << calibration_line << endl;
+            return false;
+        }
+        string setting_name = calibration_line.substr(0, separator_position);
+        string setting_value = calibration_line.substr(separator_position + 1);
+        try {
+            if (setting_name == "insertion_maximum_size") {
+                thresholds.insertion_maximum_size = stoull(setting_value);
+            } else if (setting_name == "radix_minimum_size") {
+                thresholds.radix_minimum_size = stoull(setting_value);
+            } else if (setting_name == "run_merge_window_ratio") {
+                thresholds.run_merge_window_ratio = stod(setting_value);
+            } else if (setting_name == "counting_maximum_range_ratio") {
+                thresholds.counting_maximum_range_ratio = stod(setting_value);
+            } else {
+                cerr << "Unknown calibration setting: " << setting_name << endl;
+                return false;
+            }
+        } catch (const exception&) {
+            cerr << "Malformed calibration value: " << calibration_line << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+================================================================================
+ALGORITHM REGISTRY - Compile-time descriptors for every benchmarked engine
+================================================================================
+*/
+
+// Enumeration: complexity_class
+// Purpose: Asymptotic time class of an engine on random input
+enum class complexity_class {
+    quadratic_time,     // O(n^2) comparison sorts
+    linearithmic_time,  // O(n log n) comparison sorts
+    linear_time,        // O(w * n) distribution sorts over w-digit keys
+    linear_range_time   // O(n + k) counting sorts over a key range of k values
+};
+
+// Function: complexity_class_label
+// Purpose: Report label for a complexity class
+const char* complexity_class_label(complexity_class time_complexity) {
+    switch (time_complexity) {
+        case complexity_class::quadratic_time:    return "O(n^2)";
+        case complexity_class::linearithmic_time: return "O(n log n)";
+        case complexity_class::linear_time:       return "O(w*n)";
+        case complexity_class::linear_range_time: return "O(n+k)";
+    }
+    return "unknown";
+}
+
+// Template: algorithm_type_list
+// Purpose: Compile-time list of algorithm descriptors
+template <typename... Descriptors>
+struct algorithm_type_list {};
+
+// Template: key_projection_of
+// Purpose: Type of the key projection the benchmark uses for an element type
+template <typename Element>
+using key_projection_of = remove_const_t<decltype(benchmark_element_traits<Element>::key_projection)>;
+
+// Constant: UNBOUNDED_APPLICABLE_SIZE
+// Purpose: Applicable max N of engines that never need to be skipped
+constexpr size_t UNBOUNDED_APPLICABLE_SIZE = numeric_limits<size_t>::max();
+
+// Constant: QUADRATIC_APPLICABLE_SIZE
+// Purpose: Largest dataset a quadratic engine is benchmarked on
+constexpr size_t QUADRATIC_APPLICABLE_SIZE = 1 << 15;
+
+/*
+Every descriptor exposes the same static interface:
+  algorithm_name           - report identifier
+  is_stable                - whether equal keys keep their input order
+  time_complexity          - complexity_class on random input
+  applicable_max_size      - largest N the harness will run it on
+  supports_element<E>      - whether the engine can sort element type E
+  sort(span<E>, projection) - the engine call itself
+*/
+
+// Structure: bubble_sort_descriptor
+struct bubble_sort_descriptor {
+    static constexpr const char* algorithm_name = "Bubble Sort";
+    static constexpr bool is_stable = true;
+    static constexpr complexity_class time_complexity = complexity_class::quadratic_time;
+    static constexpr size_t applicable_max_size = QUADRATIC_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_bubble_sort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: branchless_bubble_sort_descriptor
+struct branchless_bubble_sort_descriptor {
+    static constexpr const char* algorithm_name = "Branchless Bubble Sort";
+    static constexpr bool is_stable = true;
+    static constexpr complexity_class time_complexity = complexity_class::quadratic_time;
+    static constexpr size_t applicable_max_size = QUADRATIC_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_branchless_bubble_sort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: selection_sort_descriptor
+struct selection_sort_descriptor {
+    static constexpr const char* algorithm_name = "Selection Sort";
+    static constexpr bool is_stable = false;
+    static constexpr complexity_class time_complexity = complexity_class::quadratic_time;
+    static constexpr size_t applicable_max_size = QUADRATIC_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_selection_sort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: insertion_sort_descriptor
+struct insertion_sort_descriptor {
+    static constexpr const char* algorithm_name = "Insertion Sort";
+    static constexpr bool is_stable = true;
+    static constexpr complexity_class time_complexity = complexity_class::quadratic_time;
+    static constexpr size_t applicable_max_size = QUADRATIC_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_insertion_sort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: branchless_insertion_sort_descriptor
+struct branchless_insertion_sort_descriptor {
+    static constexpr const char* algorithm_name = "Branchless Insertion Sort";
+    static constexpr bool is_stable = true;
+    static constexpr complexity_class time_complexity = complexity_class::quadratic_time;
+    static constexpr size_t applicable_max_size = QUADRATIC_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_branchless_insertion_sort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: introsort_descriptor
+struct introsort_descriptor {
+    static constexpr const char* algorithm_name = "Introsort";
+    static constexpr bool is_stable = false;
+    static constexpr complexity_class time_complexity = complexity_class::linearithmic_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_introsort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: simd_introsort_descriptor
+struct simd_introsort_descriptor {
+    static constexpr const char* algorithm_name = "SIMD Introsort";
+    static constexpr bool is_stable = false;
+    static constexpr complexity_class time_complexity = complexity_class::linearithmic_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = is_same_v<Element, int32_t>;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection /*projection*/) {
+        execute_simd_introsort_algorithm(data_span);  // Plain int32 keys only
+    }
+};
+
+// Structure: merge_sort_descriptor
+struct merge_sort_descriptor {
+    static constexpr const char* algorithm_name = "Merge Sort";
+    static constexpr bool is_stable = true;
+    static constexpr complexity_class time_complexity = complexity_class::linearithmic_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_merge_sort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: blocked_merge_sort_descriptor
+struct blocked_merge_sort_descriptor {
+    static constexpr const char* algorithm_name = "Blocked Merge Sort";
+    static constexpr bool is_stable = true;
+    static constexpr complexity_class time_complexity = complexity_class::linearithmic_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_blocked_merge_sort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: powersort_descriptor
+struct powersort_descriptor {
+    static constexpr const char* algorithm_name = "Powersort";
+    static constexpr bool is_stable = true;
+    static constexpr complexity_class time_complexity = complexity_class::linearithmic_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_powersort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: heap_sort_descriptor
+struct heap_sort_descriptor {
+    static constexpr const char* algorithm_name = "Heap Sort";
+    static constexpr bool is_stable = false;
+    static constexpr complexity_class time_complexity = complexity_class::linearithmic_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_heap_sort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: lsd_radix_sort_descriptor
+struct lsd_radix_sort_descriptor {
+    static constexpr const char* algorithm_name = "LSD Radix Sort";
+    static constexpr bool is_stable = true;
+    static constexpr complexity_class time_complexity = complexity_class::linear_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element>
+    static constexpr bool supports_element =
+        key_transform_sortable_range<typename span<Element>::iterator, key_projection_of<Element>>;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_lsd_radix_sort_algorithm(data_span, projection);
+    }
+};
+
+// Structure: msd_radix_sort_descriptor
+struct msd_radix_sort_descriptor {
+    static constexpr const char* algorithm_name = "MSD Radix Sort";
+    static constexpr bool is_stable = false;
+    static constexpr complexity_class time_complexity = complexity_class::linear_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element>
+    static constexpr bool supports_element =
+        key_transform_sortable_range<typename span<Element>::iterator, key_projection_of<Element>>;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_msd_radix_sort_algorithm(data_span, projection);
+    }
+};
+
+// Structure: counting_sort_descriptor
+struct counting_sort_descriptor {
+    static constexpr const char* algorithm_name = "Counting Sort";
+    static constexpr bool is_stable = true;
+    static constexpr complexity_class time_complexity = complexity_class::linear_range_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element>
+    static constexpr bool supports_element =
+        radix_sortable_range<typename span<Element>::iterator, key_projection_of<Element>>;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_counting_sort_algorithm(data_span, projection);
+    }
+};
+
+// Structure: parallel_quicksort_descriptor
+struct parallel_quicksort_descriptor {
+    static constexpr const char* algorithm_name = "Parallel Quicksort";
+    static constexpr bool is_stable = false;
+    static constexpr complexity_class time_complexity = complexity_class::linearithmic_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_parallel_quicksort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: parallel_merge_sort_descriptor
+struct parallel_merge_sort_descriptor {
+    static constexpr const char* algorithm_name = "Parallel Merge Sort";
+    static constexpr bool is_stable = false;  // Chunks are pre-sorted with introsort
+    static constexpr complexity_class time_complexity = complexity_class::linearithmic_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_parallel_merge_sort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: adaptive_sort_descriptor
+struct adaptive_sort_descriptor {
+    static constexpr const char* algorithm_name = "Adaptive Hybrid";
+    static constexpr bool is_stable = false;  // The introsort route does not keep ties in order
+    static constexpr complexity_class time_complexity = complexity_class::linearithmic_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_adaptive_sort_algorithm(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: std_sort_descriptor
+struct std_sort_descriptor {
+    static constexpr const char* algorithm_name = STD_SORT_REFERENCE_NAME;
+    static constexpr bool is_stable = false;
+    static constexpr complexity_class time_complexity = complexity_class::linearithmic_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_std_sort_reference(data_span, ranges::less{}, projection);
+    }
+};
+
+// Structure: std_stable_sort_descriptor
+struct std_stable_sort_descriptor {
+    static constexpr const char* algorithm_name = STD_STABLE_SORT_REFERENCE_NAME;
+    static constexpr bool is_stable = true;
+    static constexpr complexity_class time_complexity = complexity_class::linearithmic_time;
+    static constexpr size_t applicable_max_size = UNBOUNDED_APPLICABLE_SIZE;
+    template <typename Element> static constexpr bool supports_element = true;
+
+    template <typename Element, typename Projection>
+    static void sort(span<Element> data_span, Projection projection) {
+        execute_std_stable_sort_reference(data_span, ranges::less{}, projection);
+    }
+};
+
+// Registry: registered_algorithms
+// Purpose: Every engine known to the analyzer, in report order
+using registered_algorithms = algorithm_type_list<
+    bubble_sort_descriptor,
+    branchless_bubble_sort_descriptor,
+    selection_sort_descriptor,
+    insertion_sort_descriptor,
+    branchless_insertion_sort_descriptor,
+    introsort_descriptor,
+    simd_introsort_descriptor,
+    merge_sort_descriptor,
+    blocked_merge_sort_descriptor,
+    powersort_descriptor,
+    heap_sort_descriptor,
+    lsd_radix_sort_descriptor,
+    msd_radix_sort_descriptor,
+    counting_sort_descriptor,
+    parallel_quicksort_descriptor,
+    parallel_merge_sort_descriptor,
+    adaptive_sort_descriptor,
+    std_sort_descriptor,
+    std_stable_sort_descriptor
+>;
+
+/*
+================================================================================
+COUNTER-BASED GENERATION - Reproducible inputs generated in independent chunks
+================================================================================
+*/
+
+// Constant: SPLITMIX_GOLDEN_GAMMA
+// Purpose: SplitMix64 counter increment (2^64 / golden ratio, odd)
+constexpr uint64_t SPLITMIX_GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
+
+// Class: counter_based_engine
+// Purpose: SplitMix64 in counter form - draw c of a stream is
+//          mix(stream_key + (c + 1) * SPLITMIX_GOLDEN_GAMMA), a pure function of the
+//          seed and c. Any position is reached in O(1), so every chunk of a dataset is
+//          generated independently and the output is bit-identical for a seed whatever
+//          the thread count. Satisfies UniformRandomBitGenerator; bounded() and
+//          unit_interval() stand in for <random> distributions, whose output differs
+//          between standard libraries.
+class counter_based_engine {
+public:
+    using result_type = uint64_t;
+
+    explicit counter_based_engine(uint64_t generator_seed, uint64_t first_counter = 0)
+        : stream_key(mix_fingerprint_bits(generator_seed)), draw_counter(first_counter) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return numeric_limits<result_type>::max(); }
+
+    // Function: operator()
+    // Returns: next 64 random bits of the stream
+    result_type operator()() {
+        return mix_fingerprint_bits(stream_key + ++draw_counter * SPLITMIX_GOLDEN_GAMMA);
+    }
+
+    // Function: seek
+    // Purpose: Positions the stream so the next draw is draw number target_counter
+    void seek(uint64_t target_counter) { draw_counter = target_counter; }
+
+    // Function: bounded
+    // Returns: integer in [0, range_size) - multiply-shift of the top 32 bits, no division
+    uint32_t bounded(uint32_t range_size) {
+        return static_cast<uint32_t>(((*this)() >> 32) * range_size >> 32);
+    }
+
+    // Function: unit_interval
+    // Returns: double in [0, 1) built from the top 53 bits
+    double unit_interval() {
+        return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+    }
+
+private:
+    uint64_t stream_key;     // Mixed seed - distinct seeds give unrelated streams
+    uint64_t draw_counter;   // Draws taken so far
+};
+
+// Function: generate_in_parallel_chunks
+// Purpose: Produces elements [0, element_count) in DATASET_GENERATION_GRAIN chunks on
+//          the pool. Element i draws from its own counter range
+//          [i * draws_per_element, (i + 1) * draws_per_element), so chunking and
+//          thread count cannot change the output. The per-element loop is straight-line
+//          integer code the compiler can vectorize.
+// Parameters: element_count - elements to produce, generator_seed - dataset seed,
+//             generate_element - callable(element_index, engine&) writing element i only,
+//             draws_per_element - counter values reserved per element,
+//             thread_pool - pool running the chunks
+template <typename ElementGenerator>
+void generate_in_parallel_chunks(size_t element_count, uint64_t generator_seed, ElementGenerator generate_element,
+                                 uint64_t draws_per_element = COUNTER_DRAWS_PER_ELEMENT,
+                                 work_stealing_thread_pool& thread_pool = shared_thread_pool()) {
+    auto generate_chunk = [&](size_t chunk_begin, size_t chunk_end) {
+        counter_based_engine element_engine(generator_seed);
+        for (size_t element_index = chunk_begin; element_index < chunk_end; element_index++) {
+            element_engine.seek(element_index * draws_per_element);
+            generate_element(element_index, element_engine);
+        }
+    };
+    if (element_count <= DATASET_GENERATION_GRAIN) {
+        generate_chunk(0, element_count);
+        return;
+    }
+
+    parallel_task_group task_group(thread_pool);
+    for (size_t chunk_begin = 0; chunk_begin < element_count; chunk_begin += DATASET_GENERATION_GRAIN) {
+        task_group.run([&, chunk_begin] {
+            generate_chunk(chunk_begin, min(chunk_begin + DATASET_GENERATION_GRAIN, element_count));
+        });
+    }
+    task_group.wait();
+}
+
+// Function: generate_random_dataset
+// Purpose: Creates pseudo-random array for algorithm testing. Signed keys lie in
+//          [1, 10000]; unsigned keys cover the full range so the top bit varies;
+//          floats are signed fractions with NaN, +-0, +-inf and denormals every
+//          FLOAT_SPECIAL_VALUE_PERIOD elements (order them with ordered_key_less);
+//          strings are "key:<n>" for n below SHORT_STRING_KEY_UNIVERSE. Generated in
+//          parallel chunks; identical for a seed on every machine and thread count.
+// Parameters: dataset_size - number of elements to generate,
+//             generator_seed - fixed seed so every run sees identical inputs
+// Returns: vector containing elements with randomly distributed keys
+template <typename Element = int>
+vector<Element> generate_random_dataset(int dataset_size, uint64_t generator_seed = active_run_configuration().dataset_seed) {
+    vector<Element> data_container(dataset_size);  // Every slot is written by exactly one chunk
+
+    generate_in_parallel_chunks(data_container.size(), generator_seed,
+                                [&](size_t element_index, counter_based_engine& element_engine) {
+        if constexpr (is_floating_point_v<Element>) {
+            constexpr Element special_values[] = {
+                numeric_limits<Element>::quiet_NaN(), -numeric_limits<Element>::quiet_NaN(),
+                numeric_limits<Element>::infinity(), -numeric_limits<Element>::infinity(),
+                Element(0.0), -Element(0.0), numeric_limits<Element>::denorm_min(), -numeric_limits<Element>::denorm_min()};
+            if (element_index % FLOAT_SPECIAL_VALUE_PERIOD == 0) {
+                data_container[element_index] = special_values[element_engine() % size(special_values)];
+            } else {
+                data_container[element_index] = static_cast<Element>(-10000.0 + 20000.0 * element_engine.unit_interval());
+            }
+        } else if constexpr (is_unsigned_v<Element>) {
+            data_container[element_index] = static_cast<Element>(element_engine());
+        } else if constexpr (is_same_v<Element, short_string_record>) {
+            data_container[element_index] = benchmark_element_traits<Element>::make_element(
+                element_engine.bounded(SHORT_STRING_KEY_UNIVERSE), static_cast<int64_t>(element_index));
+        } else {
+            data_container[element_index] = benchmark_element_traits<Element>::make_element(
+                1 + element_engine.bounded(10000), static_cast<int64_t>(element_index));
+        }
+    });
+
+    return data_container;  // Return populated dataset
+}
+
+/*
+================================================================================
+RECORDED DATASETS - Binary key files, zero-copy mapping and text conversion
+================================================================================
+*/
+
+// Enumeration: dataset_key_type
+// Purpose: Key encoding of a dataset file; the values are stored in file headers
+enum class dataset_key_type : uint32_t {
+    int32_keys = 1,
+    int64_keys = 2,
+    uint64_keys = 3,
+    float_keys = 4,
+    double_keys = 5
+};
+
+// Function: visit_dataset_key_type
+// Purpose: Calls key_visitor with type_identity of the C++ key type of a file key type
+// Parameters: key_type - file key type (must be a known enumerator), key_visitor - generic callable
+template <typename KeyVisitor>
+decltype(auto) visit_dataset_key_type(dataset_key_type key_type, KeyVisitor&& key_visitor) {
+    switch (key_type) {
+        case dataset_key_type::int32_keys: return key_visitor(type_identity<int32_t>{});
+        case dataset_key_type::int64_keys: return key_visitor(type_identity<int64_t>{});
+        case dataset_key_type::uint64_keys: return key_visitor(type_identity<uint64_t>{});
+        case dataset_key_type::float_keys: return key_visitor(type_identity<float>{});
+        default: return key_visitor(type_identity<double>{});
+    }
+}
+
+// Function: dataset_key_type_of
+// Returns: file key type storing Key unchanged, nullopt when no file type does
+template <typename Key>
+constexpr optional<dataset_key_type> dataset_key_type_of() {
+    if constexpr (is_same_v<Key, int32_t>) {
+        return dataset_key_type::int32_keys;
+    } else if constexpr (is_same_v<Key, int64_t>) {
+        return dataset_key_type::int64_keys;
+    } else if constexpr (is_same_v<Key, uint64_t>) {
+        return dataset_key_type::uint64_keys;
+    } else if constexpr (is_same_v<Key, float>) {
+        return dataset_key_type::float_keys;
+    } else if constexpr (is_same_v<Key, double>) {
+        return dataset_key_type::double_keys;
+    } else {
+        return nullopt;
+    }
+}
+
+// Function: parse_dataset_key_type
+// Purpose: Looks a file key type up by its element label ("int32", "int64", "uint64", "float", "double")
+// Returns: file key type, nullopt for any other label
+optional<dataset_key_type> parse_dataset_key_type(const string& type_label) {
+    for (dataset_key_type key_type : {dataset_key_type::int32_keys, dataset_key_type::int64_keys, dataset_key_type::uint64_keys,
+                                      dataset_key_type::float_keys, dataset_key_type::double_keys}) {
+        if (type_label == visit_dataset_key_type(key_type, [](auto key_tag) {
+                return element_type_label<typename decltype(key_tag)::type>();
+            })) {
+            return key_type;
+        }
+    }
+    return nullopt;
+}
+
+// Function: dataset_key_bytes
+// Returns: the bytes of a key array as stored in a dataset payload
+template <typename Key>
+span<const uint8_t> dataset_key_bytes(span<const Key> dataset_keys) {
+    return span<const uint8_t>(reinterpret_cast<const uint8_t*>(dataset_keys.data()), dataset_keys.size_bytes());
+}
+
+// Structure: dataset_file_header
+// Purpose: First 64 bytes of a dataset file, little-endian. File layout:
+//            header | chunk index (chunk_count entries) | zero padding | payload
+//          The payload starts on a DATASET_PAYLOAD_ALIGNMENT boundary, so a mapping of
+//          the file is a correctly aligned key array for every key type.
+struct dataset_file_header {
+    char magic_bytes[8];          // DATASET_FILE_MAGIC, not NUL-terminated
+    uint32_t format_version;      // DATASET_FORMAT_VERSION
+    uint32_t key_type;            // dataset_key_type
+    uint64_t key_count;           // Keys in the payload (at least one)
+    uint64_t payload_offset;      // Byte offset of the first key
+    uint64_t payload_checksum;    // compute_dataset_checksum of the payload
+    uint64_t chunk_count;         // Chunk index entries, 0 when the file has no index
+    uint64_t chunk_keys;          // Keys per indexed chunk (the last one may be shorter)
+    uint64_t header_checksum;     // compute_dataset_checksum of the 56 bytes above
+};
+static_assert(sizeof(dataset_file_header) == 64, "dataset header layout is part of the file format");
+
+// Structure: dataset_chunk_entry
+// Purpose: Optional chunk index entry - the key range of one chunk as
+//          ordered_key_transform values, plus the chunk's share of the payload checksum
+//          so chunks can be verified (or skipped by range) independently
+struct dataset_chunk_entry {
+    uint64_t minimum_ordered_key;   // Smallest key of the chunk, transformed
+    uint64_t maximum_ordered_key;   // Largest key of the chunk, transformed
+    uint64_t chunk_checksum;        // Checksum of the chunk's words at their payload positions
+};
+
+// Function: compute_dataset_checksum
+// Purpose: Position-keyed sum of mixed little-endian 8-byte words. Any flipped bit or
+//          moved word changes it, and the sums of consecutive pieces add up to the sum
+//          of the whole, so chunks checksum independently.
+// Parameters: checked_bytes - bytes to checksum (a partial last word is zero padded),
+//             first_word_position - payload word index of the first byte (8-byte aligned)
+// Returns: checksum
+uint64_t compute_dataset_checksum(span<const uint8_t> checked_bytes, uint64_t first_word_position = 0) {
+    uint64_t checksum_sum = 0;
+    size_t word_count = (checked_bytes.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    for (size_t word_index = 0; word_index < word_count; word_index++) {
+        uint64_t word_bits = 0;
+        size_t byte_offset = word_index * sizeof(uint64_t);
+        memcpy(&word_bits, checked_bytes.data() + byte_offset, min(sizeof(uint64_t), checked_bytes.size() - byte_offset));
+        checksum_sum += mix_fingerprint_bits(word_bits + (first_word_position + word_index + 1) * SPLITMIX_GOLDEN_GAMMA);
+    }
+    return checksum_sum;
+}
+
+// Function: summarize_dataset_chunk
+// Purpose: Index entry of keys [first_key, first_key + chunk_keys.size()) of a payload
+// Parameters: chunk_keys - the chunk, first_key - its position in the payload
+// Returns: key range and checksum share of the chunk
+template <typename Key>
+dataset_chunk_entry summarize_dataset_chunk(span<const Key> chunk_keys, size_t first_key) {
+    dataset_chunk_entry chunk_entry{numeric_limits<uint64_t>::max(), 0, 0};
+    for (Key chunk_key : chunk_keys) {
+        uint64_t ordered_key = ordered_key_transform<Key>::apply(chunk_key);
+        chunk_entry.minimum_ordered_key = min(chunk_entry.minimum_ordered_key, ordered_key);
+        chunk_entry.maximum_ordered_key = max(chunk_entry.maximum_ordered_key, ordered_key);
+    }
+    chunk_entry.chunk_checksum = compute_dataset_checksum(dataset_key_bytes(chunk_keys), first_key * sizeof(Key) / sizeof(uint64_t));
+    return chunk_entry;
+}
+
+// Function: dataset_chunk_key_count
+// Purpose: Rounds a requested chunk length up so every chunk holds whole checksum words
+template <typename Key>
+constexpr size_t dataset_chunk_key_count(size_t requested_keys) {
+    constexpr size_t keys_per_word = sizeof(uint64_t) / sizeof(Key);
+    return (requested_keys + keys_per_word - 1) / keys_per_word * keys_per_word;
+}
+
+// Function: write_dataset_file
+// Purpose: Writes keys as a dataset file (header, optional chunk index, aligned payload)
+// Parameters: output_path - file to create, dataset_keys - keys in recorded order,
+//             chunk_keys - keys per chunk index entry, 0 for no index
+// Returns: false (with a message on cerr) when the file cannot be written
+template <typename Key>
+bool write_dataset_file(const string& output_path, span<const Key> dataset_keys, size_t chunk_keys) {
+    static_assert(endian::native == endian::little, "dataset files are little-endian");
+    dataset_file_header file_header{};
+    memcpy(file_header.magic_bytes, DATASET_FILE_MAGIC, sizeof(file_header.magic_bytes));
+    file_header.format_version = DATASET_FORMAT_VERSION;
+    file_header.key_type = static_cast<uint32_t>(*dataset_key_type_of<Key>());
+    file_header.key_count = dataset_keys.size();
+
+    vector<dataset_chunk_entry> chunk_index;
+    if (chunk_keys > 0) {
+        file_header.chunk_keys = dataset_chunk_key_count<Key>(chunk_keys);
+        for (size_t first_key = 0; first_key < dataset_keys.size(); first_key += file_header.chunk_keys) {
+            chunk_index.push_back(summarize_dataset_chunk(
+                dataset_keys.subspan(first_key, min<size_t>(file_header.chunk_keys, dataset_keys.size() - first_key)), first_key));
+            file_header.payload_checksum += chunk_index.back().chunk_checksum;
+        }
+    } else {
+        file_header.payload_checksum = compute_dataset_checksum(dataset_key_bytes(dataset_keys));
+    }
+    file_header.chunk_count = chunk_index.size();
+    size_t index_end = sizeof(dataset_file_header) + chunk_index.size() * sizeof(dataset_chunk_entry);
+    file_header.payload_offset = (index_end + DATASET_PAYLOAD_ALIGNMENT - 1) / DATASET_PAYLOAD_ALIGNMENT * DATASET_PAYLOAD_ALIGNMENT;
+    file_header.header_checksum = compute_dataset_checksum(
+        span<const uint8_t>(reinterpret_cast<const uint8_t*>(&file_header), offsetof(dataset_file_header, header_checksum)));
+
+    ofstream output_file(output_path, ios::binary | ios::trunc);
+    output_file.write(reinterpret_cast<const char*>(&file_header), sizeof(file_header));
+    output_file.write(reinterpret_cast<const char*>(chunk_index.data()),
+                      static_cast<streamsize>(chunk_index.size() * sizeof(dataset_chunk_entry)));
+    string alignment_padding(file_header.payload_offset - index_end, '\0');
+    output_file.write(alignment_padding.data(), static_cast<streamsize>(alignment_padding.size()));
+    output_file.write(reinterpret_cast<const char*>(dataset_keys.data()), static_cast<streamsize>(dataset_keys.size_bytes()));
+    output_file.close();
+    if (!output_file) {
+        cerr << "Cannot write dataset file " << output_path << endl;
+        return false;
+    }
+    return true;
+}
+
+// Class: mapped_dataset_file
+// Purpose: Read-only view of a verified dataset file. The file is memory-mapped
+//          read-only and private, so benchmark pools reference its keys with zero copy
+//          and repeated runs share the page cache; without mmap it is read into memory.
+class mapped_dataset_file {
+public:
+    mapped_dataset_file() = default;
+    mapped_dataset_file(const mapped_dataset_file&) = delete;
+    mapped_dataset_file& operator=(const mapped_dataset_file&) = delete;
+
+    // Destructor: unmaps the file
+    ~mapped_dataset_file() {
+#if defined(__unix__) || defined(__APPLE__)
+        if (mapped_bytes != nullptr) {
+            munmap(const_cast<uint8_t*>(mapped_bytes), byte_size);
+        }
+#endif
+    }
+
+    // Function: open_file
+    // Purpose: Maps a dataset file and verifies header, layout, chunk index and payload
+    //          checksum; float keys must not be NaN, which has no strict weak order
+    // Returns: false (with a message on cerr) when the file is unreadable or invalid
+    bool open_file(const string& input_path) {
+        dataset_path = input_path;
+        if (!map_file_bytes()) {
+            return false;
+        }
+        auto reject = [&](const string& problem_description) {
+            cerr << "Invalid dataset file " << dataset_path << ": " << problem_description << endl;
+            return false;
+        };
+        if (byte_size < sizeof(dataset_file_header)) {
+            return reject("shorter than its header");
+        }
+        memcpy(&file_header, mapped_bytes, sizeof(file_header));
+        if (memcmp(file_header.magic_bytes, DATASET_FILE_MAGIC, sizeof(file_header.magic_bytes)) != 0) {
+            return reject("not a dataset file (convert text keys with convert-dataset)");
+        }
+        if (file_header.format_version != DATASET_FORMAT_VERSION) {
+            return reject("unsupported format version " + to_string(file_header.format_version));
+        }
+        if (compute_dataset_checksum(span<const uint8_t>(mapped_bytes, offsetof(dataset_file_header, header_checksum))) !=
+            file_header.header_checksum) {
+            return reject("header checksum mismatch");
+        }
+        if (file_header.key_type < static_cast<uint32_t>(dataset_key_type::int32_keys) ||
+            file_header.key_type > static_cast<uint32_t>(dataset_key_type::double_keys)) {
+            return reject("unknown key type " + to_string(file_header.key_type));
+        }
+
+        size_t key_bytes = visit_dataset_key_type(key_type(), [](auto key_tag) { return sizeof(typename decltype(key_tag)::type); });
+        uint64_t index_end = sizeof(dataset_file_header) + file_header.chunk_count * sizeof(dataset_chunk_entry);
+        if (file_header.chunk_count > byte_size / sizeof(dataset_chunk_entry) || file_header.payload_offset % DATASET_PAYLOAD_ALIGNMENT != 0 ||
+            file_header.payload_offset < index_end || file_header.payload_offset > byte_size ||
+            file_header.key_count != (byte_size - file_header.payload_offset) / key_bytes ||
+            (byte_size - file_header.payload_offset) % key_bytes != 0) {
+            return reject("layout does not match the file size");
+        }
+        if (file_header.key_count == 0) {
+            return reject("holds no keys");
+        }
+        if (file_header.chunk_count > 0 &&
+            (file_header.chunk_keys == 0 || file_header.chunk_keys * key_bytes % sizeof(uint64_t) != 0 ||
+             file_header.chunk_count != (file_header.key_count + file_header.chunk_keys - 1) / file_header.chunk_keys)) {
+            return reject("chunk index does not cover the payload");
+        }
+        return visit_dataset_key_type(key_type(), [&](auto key_tag) {
+            return verify_payload<typename decltype(key_tag)::type>(reject);
+        });
+    }
+
+    // Function: key_type
+    // Returns: encoding of the keys
+    dataset_key_type key_type() const { return static_cast<dataset_key_type>(file_header.key_type); }
+
+    // Function: key_count
+    // Returns: number of keys in the file
+    size_t key_count() const { return file_header.key_count; }
+
+    // Function: chunk_count
+    // Returns: chunk index entries, 0 when the file has no index
+    size_t chunk_count() const { return file_header.chunk_count; }
+
+    // Function: file_path
+    // Returns: path the file was opened from
+    const string& file_path() const { return dataset_path; }
+
+    // Function: keys
+    // Returns: the mapped keys; Key must be the C++ type of key_type()
+    template <typename Key>
+    span<const Key> keys() const {
+        return span<const Key>(reinterpret_cast<const Key*>(mapped_bytes + file_header.payload_offset), file_header.key_count);
+    }
+
+private:
+    // Function: map_file_bytes
+    // Purpose: Maps the whole file, or reads it where mmap is unavailable
+    bool map_file_bytes() {
+#if defined(__unix__) || defined(__APPLE__)
+        int file_descriptor = open(dataset_path.c_str(), O_RDONLY);
+        struct stat file_status {};
+        if (file_descriptor < 0 || fstat(file_descriptor, &file_status) != 0) {
+            cerr << "Cannot open " << dataset_path << ": " << strerror(errno) << endl;
+            if (file_descriptor >= 0) {
+                close(file_descriptor);
+            }
+            return false;
+        }
+        byte_size = static_cast<size_t>(file_status.st_size);
+        void* mapping = byte_size > 0 ? mmap(nullptr, byte_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0) : MAP_FAILED;
+        close(file_descriptor);  // The mapping keeps the file referenced
+        if (mapping != MAP_FAILED) {
+            mapped_bytes = static_cast<const uint8_t*>(mapping);
+            madvise(mapping, byte_size, MADV_WILLNEED);
+            return true;
+        }
+#endif
+        ifstream input_file(dataset_path, ios::binary);
+        if (!input_file) {
+            cerr << "Cannot open " << dataset_path << endl;
+            return false;
+        }
+        copied_bytes.assign(istreambuf_iterator<char>(input_file), istreambuf_iterator<char>());
+        copied_bytes.resize(copied_bytes.size() + DATASET_PAYLOAD_ALIGNMENT);
+        byte_size = copied_bytes.size() - DATASET_PAYLOAD_ALIGNMENT;
+        // Shift the copy so the payload sits as aligned as it would in a mapping
+        size_t misalignment = reinterpret_cast<uintptr_t>(copied_bytes.data()) % DATASET_PAYLOAD_ALIGNMENT;
+        size_t alignment_shift = misalignment == 0 ? 0 : DATASET_PAYLOAD_ALIGNMENT - misalignment;
+        memmove(copied_bytes.data() + alignment_shift, copied_bytes.data(), byte_size);
+        mapped_bytes = reinterpret_cast<const uint8_t*>(copied_bytes.data()) + alignment_shift;
+        return true;
+    }
+
+    // Function: verify_payload
+    // Purpose: Checks every chunk against its index entry (the whole payload is one
+    //          chunk when the file has no index) and the chunk sums against the header
+    template <typename Key, typename Reject>
+    bool verify_payload(Reject& reject) const {
+        span<const Key> payload_keys = keys<Key>();
+        if constexpr (is_floating_point_v<Key>) {
+            if (any_of(payload_keys.begin(), payload_keys.end(), [](Key payload_key) { return isnan(payload_key); })) {
+                return reject("NaN keys have no order the comparison engines can sort by");
+            }
+        }
+
+        size_t chunk_keys = file_header.chunk_count > 0 ? file_header.chunk_keys : payload_keys.size();
+        const uint8_t* index_bytes = mapped_bytes + sizeof(dataset_file_header);
+        uint64_t checksum_sum = 0;
+        for (size_t first_key = 0, chunk_index = 0; first_key < payload_keys.size(); first_key += chunk_keys, chunk_index++) {
+            dataset_chunk_entry chunk_summary = summarize_dataset_chunk(
+                payload_keys.subspan(first_key, min(chunk_keys, payload_keys.size() - first_key)), first_key);
+            if (file_header.chunk_count > 0) {
+                dataset_chunk_entry index_entry;
+                memcpy(&index_entry, index_bytes + chunk_index * sizeof(dataset_chunk_entry), sizeof(index_entry));
+                if (index_entry.minimum_ordered_key != chunk_summary.minimum_ordered_key ||
+                    index_entry.maximum_ordered_key != chunk_summary.maximum_ordered_key ||
+                    index_entry.chunk_checksum != chunk_summary.chunk_checksum) {
+                    return reject("chunk " + to_string(chunk_index) + " does not match its index entry");
+                }
+            }
+            checksum_sum += chunk_summary.chunk_checksum;
+        }
+        if (checksum_sum != file_header.payload_checksum) {
+            return reject("payload checksum mismatch");
+        }
+        return true;
+    }
+
+    string dataset_path;                 // Path given to open_file
+    dataset_file_header file_header{};   // Verified header
+    const uint8_t* mapped_bytes = nullptr;  // Start of the mapping (or of the aligned copy)
+    size_t byte_size = 0;                // File size in bytes
+    vector<char> copied_bytes;           // Backing store when the file could not be mapped
+};
+
+// Function: recorded_key_as_int64
+// Purpose: Recorded key as the int64 key make_element takes - floats are rounded and
+//          clamped, unsigned keys wrap
+template <typename Key>
+int64_t recorded_key_as_int64(Key recorded_key) {
+    if constexpr (is_floating_point_v<Key>) {
+        constexpr double int64_limit = 9.2e18;  // Inside the int64 range, exactly representable
+        return llround(clamp(static_cast<double>(recorded_key), -int64_limit, int64_limit));
+    } else {
+        return static_cast<int64_t>(recorded_key);
+    }
+}
+
+// Function: materialize_recorded_window
+// Purpose: Converts dataset_size keys of a recorded dataset, starting at window_offset
+//          and wrapping around its end, into benchmark elements. Arithmetic element
+//          types take the key by value conversion; records and strings are built from it
+//          like generated keys. Used when a zero-copy view is not possible.
+// Parameters: dataset_file - verified dataset, window_offset - first key, dataset_size - elements
+// Returns: converted elements
+template <typename Element>
+vector<Element> materialize_recorded_window(const mapped_dataset_file& dataset_file, size_t window_offset, size_t dataset_size) {
+    vector<Element> data_container(dataset_size);
+    visit_dataset_key_type(dataset_file.key_type(), [&](auto key_tag) {
+        using Key = typename decltype(key_tag)::type;
+        span<const Key> recorded_keys = dataset_file.keys<Key>();
+        generate_in_parallel_chunks(dataset_size, 0, [&](size_t element_index, counter_based_engine&) {
+            Key recorded_key = recorded_keys[(window_offset + element_index) % recorded_keys.size()];
+            if constexpr (is_floating_point_v<Element> || (is_integral_v<Element> && is_integral_v<Key>)) {
+                data_container[element_index] = static_cast<Element>(recorded_key);
+            } else if constexpr (is_integral_v<Element>) {
+                data_container[element_index] = static_cast<Element>(recorded_key_as_int64(recorded_key));
+            } else {
+                data_container[element_index] = benchmark_element_traits<Element>::make_element(
+                    recorded_key_as_int64(recorded_key), static_cast<int64_t>(element_index));
+            }
+        });
+    });
+    return data_container;
+}
+
+// Structure: dataset_conversion_configuration
+// Purpose: Parameters of "convert-dataset" mode
+struct dataset_conversion_configuration {
+    string input_path;                                   // Text or CSV keys
+    string output_path;                                  // Dataset file to write
+    dataset_key_type key_type = dataset_key_type::int64_keys;  // --type
+    size_t key_column = 0;                               // --column: 0-based CSV field holding the key
+    size_t chunk_keys = DATASET_DEFAULT_CHUNK_KEYS;      // --chunk-keys: 0 writes no chunk index
+};
+
+// Function: parse_text_dataset_keys
+// Purpose: Reads keys from text. Lines with a comma are CSV records contributing field
+//          key_column; other lines contribute every whitespace-separated token. Blank
+//          lines and '#' comments are skipped, and so is the first remaining line when
+//          it holds no parseable key (a CSV header). Fields may be double-quoted.
+// Parameters: input_stream - text source, key_column - CSV field, parsed_keys - output
+// Returns: false (with a message on cerr naming the line) on a malformed or out-of-range key
+template <typename Key>
+bool parse_text_dataset_keys(istream& input_stream, size_t key_column, vector<Key>& parsed_keys) {
+    auto parse_token = [](string_view key_token) -> optional<Key> {
+        while (!key_token.empty() && (isspace(static_cast<unsigned char>(key_token.front())) || key_token.front() == '"')) {
+            key_token.remove_prefix(1);
+        }
+        while (!key_token.empty() && (isspace(static_cast<unsigned char>(key_token.back())) || key_token.back() == '"')) {
+            key_token.remove_suffix(1);
+        }
+        Key parsed_key{};
+        auto [parse_end, parse_error] = from_chars(key_token.data(), key_token.data() + key_token.size(), parsed_key);
+        bool parsed_ok = parse_error == errc{} && parse_end == key_token.data() + key_token.size();
+        if constexpr (is_floating_point_v<Key>) {
+            parsed_ok = parsed_ok && !isnan(parsed_key);
+        }
+        return parsed_ok ? optional<Key>(parsed_key) : nullopt;
+    };
+
+    string line_text;
+    size_t line_number = 0;
+    bool header_allowed = true;  // Only the first non-blank, non-comment line may be a header
+    while (getline(input_stream, line_text)) {
+        line_number++;
+        if (!line_text.empty() && line_text.back() == '\r') {
+            line_text.pop_back();
+        }
+        size_t first_visible = line_text.find_first_not_of(" \t");
+        if (first_visible == string::npos || line_text[first_visible] == '#') {
+            continue;
+        }
+
+        // Key tokens of the line - the key_column field of a CSV record, or every token
+        string_view line_view = line_text;
+        vector<string_view> key_tokens;
+        if (line_view.find(',') != string_view::npos) {
+            size_t field_begin = 0;
+            for (size_t field_index = 0; field_index < key_column && field_begin != string_view::npos; field_index++) {
+                field_begin = line_view.find(',', field_begin);
+                field_begin = field_begin == string_view::npos ? field_begin : field_begin + 1;
+            }
+            if (field_begin == string_view::npos) {
+                if (header_allowed) {
+                    header_allowed = false;
+                    continue;  // A header shorter than the records
+                }
+                cerr << "Line " << line_number << ": no field " << key_column << endl;
+                return false;
+            }
+            size_t field_end = line_view.find(',', field_begin);
+            key_tokens.push_back(line_view.substr(field_begin, field_end == string_view::npos ? string_view::npos : field_end - field_begin));
+        } else {
+            for (size_t token_begin = line_view.find_first_not_of(" \t"); token_begin != string_view::npos;) {
+                size_t token_end = line_view.find_first_of(" \t", token_begin);
+                key_tokens.push_back(line_view.substr(token_begin, token_end == string_view::npos ? string_view::npos : token_end - token_begin));
+                token_begin = token_end == string_view::npos ? token_end : line_view.find_first_not_of(" \t", token_end);
+            }
+        }
+
+        vector<optional<Key>> line_keys;
+        for (string_view key_token : key_tokens) {
+            line_keys.push_back(parse_token(key_token));
+        }
+        bool is_header = header_allowed && none_of(line_keys.begin(), line_keys.end(),
+                                                   [](const optional<Key>& line_key) { return line_key.has_value(); });
+        header_allowed = false;
+        if (is_header) {
+            continue;
+        }
+        for (size_t token_index = 0; token_index < key_tokens.size(); token_index++) {
+            if (!line_keys[token_index]) {
+                cerr << "Line " << line_number << ": cannot read '" << key_tokens[token_index] << "' as a key of type "
+                     << element_type_label<Key>() << endl;
+                return false;
+            }
+            parsed_keys.push_back(*line_keys[token_index]);
+        }
+    }
+    return true;
+}
+
+// Function: convert_text_dataset
+// Purpose: Converts text or CSV keys into a dataset file and verifies the result by
+//          opening it the way the benchmark will
+// Parameters: conversion_configuration - paths, key type, CSV column and chunk length
+// Returns: false (with a message on cerr) when reading, parsing or writing fails
+bool convert_text_dataset(const dataset_conversion_configuration& conversion_configuration) {
+    ifstream input_file(conversion_configuration.input_path);
+    if (!input_file) {
+        cerr << "Cannot open " << conversion_configuration.input_path << endl;
+        return false;
+    }
+    bool converted = visit_dataset_key_type(conversion_configuration.key_type, [&](auto key_tag) {
+        using Key = typename decltype(key_tag)::type;
+        vector<Key> parsed_keys;
+        if (!parse_text_dataset_keys(input_file, conversion_configuration.key_column, parsed_keys)) {
+            return false;
+        }
+        if (parsed_keys.empty()) {
+            cerr << conversion_configuration.input_path << " holds no keys" << endl;
+            return false;
+        }
+        return write_dataset_file(conversion_configuration.output_path, span<const Key>(parsed_keys),
+                                  conversion_configuration.chunk_keys);
+    });
+
+    mapped_dataset_file written_file;
+    if (!converted || !written_file.open_file(conversion_configuration.output_path)) {
+        return false;
+    }
+    cout << "Converted " << written_file.key_count() << " "
+         << visit_dataset_key_type(written_file.key_type(), [](auto key_tag) {
+                return element_type_label<typename decltype(key_tag)::type>();
+            })
+         << " keys into " << conversion_configuration.output_path << " (" << written_file.chunk_count()
+         << " indexed chunks), checksums verified" << endl;
+    return true;
+}
+
+/*
+================================================================================
+INPUT DISTRIBUTIONS - Pluggable key generators for the benchmark inputs
+================================================================================
+*/
+
+// Structure: input_distribution
+// Purpose: Named key generator - adding an entry to registered_distributions is all
+//          it takes to benchmark every engine against a new input shape. Recorded
+//          datasets (--datasets) are entries whose keys come from a file instead.
+struct input_distribution {
+    const char* distribution_label;   // Descriptive name used in headings
+    const char* column_label;         // Short name used in matrix columns
+    void (*generate_keys)(span<int64_t> key_values, uint64_t generator_seed);  // Must depend on the seed only
+    const mapped_dataset_file* recorded_source = nullptr;  // Dataset file of a recorded entry, generate_keys unused
+};
+
+// Function: generate_uniform_keys
+// Purpose: Uniform keys in 1..10000 - the analyzer's original input
+void generate_uniform_keys(span<int64_t> key_values, uint64_t generator_seed) {
+    generate_in_parallel_chunks(key_values.size(), generator_seed, [&](size_t element_index, counter_based_engine& element_engine) {
+        key_values[element_index] = 1 + element_engine.bounded(10000);
+    });
+}
+
+// Function: generate_sorted_keys
+// Purpose: Distinct keys already in ascending order
+void generate_sorted_keys(span<int64_t> key_values, uint64_t /*generator_seed*/) {
+    iota(key_values.begin(), key_values.end(), int64_t{0});
+}
+
+// Function: generate_reverse_keys
+// Purpose: Distinct keys in descending order
+void generate_reverse_keys(span<int64_t> key_values, uint64_t /*generator_seed*/) {
+    for (size_t element_index = 0; element_index < key_values.size(); element_index++) {
+        key_values[element_index] = static_cast<int64_t>(key_values.size() - 1 - element_index);
+    }
+}
+
+// Function: generate_k_sorted_keys
+// Purpose: Ascending keys shuffled within consecutive windows, so no element sits
+//          more than DISTRIBUTION_K_SORTED_DISPLACEMENT - 1 places from its final slot.
+//          Each window is a Fisher-Yates shuffle over its own counter range.
+void generate_k_sorted_keys(span<int64_t> key_values, uint64_t generator_seed) {
+    generate_sorted_keys(key_values, generator_seed);
+    size_t window_count = (key_values.size() + DISTRIBUTION_K_SORTED_DISPLACEMENT - 1) / DISTRIBUTION_K_SORTED_DISPLACEMENT;
+    generate_in_parallel_chunks(window_count, generator_seed, [&](size_t window_index, counter_based_engine& window_engine) {
+        size_t window_begin = window_index * DISTRIBUTION_K_SORTED_DISPLACEMENT;
+        size_t window_end = min(window_begin + DISTRIBUTION_K_SORTED_DISPLACEMENT, key_values.size());
+        for (size_t slot_index = window_end - 1; slot_index > window_begin; slot_index--) {
+            size_t swap_index = window_begin + window_engine.bounded(static_cast<uint32_t>(slot_index - window_begin + 1));
+            swap(key_values[slot_index], key_values[swap_index]);
+        }
+    }, DISTRIBUTION_K_SORTED_DISPLACEMENT);
+}
+
+// Function: generate_few_unique_keys
+// Purpose: Uniform keys drawn from only DISTRIBUTION_FEW_UNIQUE_VALUES values
+void generate_few_unique_keys(span<int64_t> key_values, uint64_t generator_seed) {
+    generate_in_parallel_chunks(key_values.size(), generator_seed, [&](size_t element_index, counter_based_engine& element_engine) {
+        key_values[element_index] = 1 + element_engine.bounded(DISTRIBUTION_FEW_UNIQUE_VALUES);
+    });
+}
+
+// Function: generate_organ_pipe_keys
+// Purpose: Keys rising to the middle and falling back (0 1 2 .. 2 1 0)
+void generate_organ_pipe_keys(span<int64_t> key_values, uint64_t /*generator_seed*/) {
+    for (size_t element_index = 0; element_index < key_values.size(); element_index++) {
+        key_values[element_index] = static_cast<int64_t>(min(element_index, key_values.size() - 1 - element_index));
+    }
+}
+
+// Function: generate_zipf_keys
+// Purpose: Zipf-distributed ranks - a few keys dominate, a long tail is rare
+void generate_zipf_keys(span<int64_t> key_values, uint64_t generator_seed) {
+    // Cumulative weights of rank k proportional to 1 / k^s, sampled by binary search
+    vector<double> cumulative_weights(DISTRIBUTION_ZIPF_UNIVERSE);
+    double running_weight = 0.0;
+    for (int rank_index = 0; rank_index < DISTRIBUTION_ZIPF_UNIVERSE; rank_index++) {
+        running_weight += 1.0 / pow(rank_index + 1.0, DISTRIBUTION_ZIPF_EXPONENT);
+        cumulative_weights[rank_index] = running_weight;
+    }
+
+    generate_in_parallel_chunks(key_values.size(), generator_seed, [&](size_t element_index, counter_based_engine& element_engine) {
+        auto rank_position = upper_bound(cumulative_weights.begin(), cumulative_weights.end(),
+                                         running_weight * element_engine.unit_interval());
+        key_values[element_index] = min<int64_t>(rank_position - cumulative_weights.begin(), DISTRIBUTION_ZIPF_UNIVERSE - 1) + 1;
+    });
+}
+
+// Function: generate_gaussian_keys
+// Purpose: Normally distributed keys around zero - dense centre, sparse tails
+//          (Box-Muller on two draws per element)
+void generate_gaussian_keys(span<int64_t> key_values, uint64_t generator_seed) {
+    generate_in_parallel_chunks(key_values.size(), generator_seed, [&](size_t element_index, counter_based_engine& element_engine) {
+        double radius = sqrt(-2.0 * log(1.0 - element_engine.unit_interval()));  // 1 - u lies in (0, 1]
+        double angle = 2.0 * numbers::pi * element_engine.unit_interval();
+        key_values[element_index] = llround(DISTRIBUTION_GAUSSIAN_DEVIATION * radius * cos(angle));
+    });
+}
+
+// Function: generate_median_of_three_killer_keys
+// Purpose: Adversarial input for this tree's median-of-three introsort, built with
+//          McIlroy's "antiqsort" adversary: the partition loop sorts item indices
+//          while the comparator assigns values lazily, freezing items only when it
+//          must, so every pivot lands near an end and the depth budget runs out
+void generate_median_of_three_killer_keys(span<int64_t> key_values, uint64_t /*generator_seed*/) {
+    const int64_t gas_value = static_cast<int64_t>(key_values.size());  // Not yet decided - compares as largest
+    fill(key_values.begin(), key_values.end(), gas_value);
+    int64_t frozen_count = 0;
+    int64_t pivot_candidate = 0;
+
+    auto adversarial_less = [&](int64_t first_item, int64_t second_item) {
+        if (key_values[first_item] == gas_value && key_values[second_item] == gas_value) {
+            key_values[first_item == pivot_candidate ? first_item : second_item] = frozen_count++;
+        }
+        if (key_values[first_item] == gas_value) {
+            pivot_candidate = first_item;
+        } else if (key_values[second_item] == gas_value) {
+            pivot_candidate = second_item;
+        }
+        return key_values[first_item] < key_values[second_item];
+    };
+
+    // Values are fixed by the comparisons the real partition loop performs
+    vector<int64_t> item_indices(key_values.size());
+    iota(item_indices.begin(), item_indices.end(), int64_t{0});
+    introsort_partition_loop(item_indices.begin(), item_indices.end(),
+                             compute_introsort_depth_budget(item_indices.end() - item_indices.begin()),
+                             adversarial_less);
+}
+
+// Function: generate_full_range_keys
+// Purpose: Uniform keys over the whole signed 32-bit range - every radix digit varies
+void generate_full_range_keys(span<int64_t> key_values, uint64_t generator_seed) {
+    generate_in_parallel_chunks(key_values.size(), generator_seed, [&](size_t element_index, counter_based_engine& element_engine) {
+        key_values[element_index] = static_cast<int32_t>(static_cast<uint32_t>(element_engine() >> 32));
+    });
+}
+
+// Registry: registered_distributions
+// Purpose: Every input shape known to the analyzer, in report order (uniform first)
+const input_distribution registered_distributions[] = {
+    {"uniform 1..10000", "uniform", generate_uniform_keys},
+    {"sorted ascending", "sorted", generate_sorted_keys},
+    {"reverse sorted", "reverse", generate_reverse_keys},
+    {"k-sorted (window 16)", "k-sorted", generate_k_sorted_keys},
+    {"few unique (8 keys)", "few-uniq", generate_few_unique_keys},
+    {"organ pipe", "organpipe", generate_organ_pipe_keys},
+    {"zipf (s = 1.0)", "zipf", generate_zipf_keys},
+    {"gaussian", "gaussian", generate_gaussian_keys},
+    {"median-of-3 killer", "m3-killer", generate_median_of_three_killer_keys},
+    {"full 32-bit range", "full-32", generate_full_range_keys},
+};
+
+// Structure: recorded_distribution
+// Purpose: Registry entry of a dataset file loaded by --datasets, with the label
+//          storage its input_distribution points into
+struct recorded_distribution {
+    mapped_dataset_file dataset_file;   // Verified, mapped keys
+    string distribution_label;          // "recorded <file> (<type>, <N> keys)"
+    string column_label;                // File stem, truncated for matrix columns
+    input_distribution registry_entry{nullptr, nullptr, nullptr};
+};
+
+// Function: recorded_distributions
+// Purpose: Dataset files of the run, in --datasets order; they stay mapped until exit
+// Returns: mutable registry
+vector<unique_ptr<recorded_distribution>>& recorded_distributions() {
+    static vector<unique_ptr<recorded_distribution>> process_recorded_distributions;
+    return process_recorded_distributions;
+}
+
+// Function: benchmark_distributions
+// Purpose: Every benchmarkable input - the generated shapes, then the recorded datasets
+// Returns: registry entries in report order
+vector<const input_distribution*> benchmark_distributions() {
+    vector<const input_distribution*> distribution_entries;
+    for (const input_distribution& distribution : registered_distributions) {
+        distribution_entries.push_back(&distribution);
+    }
+    for (const unique_ptr<recorded_distribution>& recorded_entry : recorded_distributions()) {
+        distribution_entries.push_back(&recorded_entry->registry_entry);
+    }
+    return distribution_entries;
+}
+
+// Function: find_registered_distribution
+// Purpose: Looks a distribution (generated or recorded) up by its matrix column label
+// Returns: registry entry, nullptr when no distribution has that label
+const input_distribution* find_registered_distribution(const string& column_label) {
+    for (const input_distribution* distribution : benchmark_distributions()) {
+        if (column_label == distribution->column_label) {
+            return distribution;
+        }
+    }
+    return nullptr;
+}
+
+// Function: register_recorded_datasets
+// Purpose: Maps and verifies the dataset files of --datasets and makes each one a
+//          distribution labelled by its file stem. Verification is serial because it
+//          runs while options are parsed, before the shared pool may be created.
+// Parameters: dataset_paths - dataset files, replacing any loaded earlier
+// Returns: false (with a message on cerr) on an invalid file or a duplicate label
+bool register_recorded_datasets(const vector<string>& dataset_paths) {
+    vector<unique_ptr<recorded_distribution>>& recorded_entries = recorded_distributions();
+    recorded_entries.clear();
+    for (const string& dataset_path : dataset_paths) {
+        auto recorded_entry = make_unique<recorded_distribution>();
+        if (!recorded_entry->dataset_file.open_file(dataset_path)) {
+            return false;
+        }
+        string file_stem = filesystem::path(dataset_path).stem().string();
+        recorded_entry->column_label = file_stem.substr(0, DATASET_COLUMN_LABEL_CHARACTERS);
+        recorded_entry->distribution_label = "recorded " + file_stem + " (" +
+            visit_dataset_key_type(recorded_entry->dataset_file.key_type(),
+                                   [](auto key_tag) { return string(element_type_label<typename decltype(key_tag)::type>()); }) +
+            ", " + to_string(recorded_entry->dataset_file.key_count()) + " keys)";
+        if (find_registered_distribution(recorded_entry->column_label) != nullptr) {
+            cerr << "Dataset " << dataset_path << " would reuse the distribution label \"" << recorded_entry->column_label
+                 << "\" - rename the file" << endl;
+            return false;
+        }
+        recorded_entry->registry_entry = {recorded_entry->distribution_label.c_str(), recorded_entry->column_label.c_str(),
+                                          nullptr, &recorded_entry->dataset_file};
+        recorded_entries.push_back(move(recorded_entry));
+    }
+    return true;
+}
+
+// Function: suite_input_distribution
+// Purpose: Distribution of the per-type suites - the first one selected by
+//          --distributions, uniform when none is selected
+const input_distribution& suite_input_distribution() {
+    const vector<string>& selected_labels = active_run_configuration().distribution_labels;
+    const input_distribution* selected_distribution =
+        selected_labels.empty() ? nullptr : find_registered_distribution(selected_labels.front());
+    return selected_distribution != nullptr ? *selected_distribution : registered_distributions[0];
+}
+
+// Function: generate_distribution_dataset
+// Purpose: Creates a dataset whose keys follow the given distribution; a recorded
+//          distribution yields its first dataset_size keys (wrapping around)
+// Parameters: distribution - key generator, dataset_size - number of elements,
+//             generator_seed - fixed seed so every run sees identical inputs
+// Returns: vector of elements built from the generated keys
+template <typename Element>
+vector<Element> generate_distribution_dataset(const input_distribution& distribution, int dataset_size,
+                                              uint64_t generator_seed = active_run_configuration().dataset_seed) {
+    if (distribution.recorded_source != nullptr) {
+        return materialize_recorded_window<Element>(*distribution.recorded_source, 0, dataset_size);
+    }
+    vector<int64_t> key_values(dataset_size);
+    distribution.generate_keys(key_values, generator_seed);
+
+    vector<Element> data_container(dataset_size);
+    generate_in_parallel_chunks(data_container.size(), generator_seed, [&](size_t element_index, counter_based_engine&) {
+        data_container[element_index] = benchmark_element_traits<Element>::make_element(
+            key_values[element_index], static_cast<int64_t>(element_index));
+    });
+    return data_container;
+}
+
+/*
+================================================================================
+BENCHMARK INPUT POOLS - Pre-generated, reproducible inputs shared by every engine
+================================================================================
+*/
+
+// Structure: benchmark_input_pool
+// Purpose: Holds inputs generated once from fixed seeds plus one reusable sort buffer,
+//          so every engine sorts identical bytes and no generation or allocation
+//          happens between timed iterations. Variants of a recorded dataset whose key
+//          type is the element type view the mapped file directly (zero copy); the
+//          views point into variant_storage or the mapping, so pools move but never copy.
+template <typename Element>
+struct benchmark_input_pool {
+    string distribution_label;              // Name of the generating distribution
+    vector<span<const Element>> input_variants;  // Immutable inputs, one per variant seed
+    vector<vector<Element>> variant_storage;     // Generated or converted variants the views point into
+    size_t mapped_variant_count = 0;        // Variants viewing a mapped dataset file
+    vector<Element> sort_buffer;            // Pre-allocated, page-touched working buffer
+    vector<uint64_t> variant_fingerprints;  // Multiset fingerprint of each variant
+
+    benchmark_input_pool() = default;
+    benchmark_input_pool(benchmark_input_pool&&) = default;
+    benchmark_input_pool& operator=(benchmark_input_pool&&) = default;
+
+    // Function: load_iteration_input
+    // Purpose: Copies the variant for this iteration into the sort buffer (outside the timer)
+    // Parameters: iteration_index - harness iteration, selects the variant round-robin
+    // Returns: span over the freshly loaded sort buffer
+    span<Element> load_iteration_input(int iteration_index) {
+        span<const Element> source_variant = input_variants[iteration_index % input_variants.size()];
+        copy(source_variant.begin(), source_variant.end(), sort_buffer.begin());
+        return span<Element>(sort_buffer);
+    }
+
+    // Function: expected_fingerprint
+    // Returns: multiset fingerprint the output of this iteration must reproduce
+    uint64_t expected_fingerprint(int iteration_index) const {
+        return variant_fingerprints[iteration_index % variant_fingerprints.size()];
+    }
+};
+
+// Function: build_input_pool
+// Purpose: Generates every input variant once and pre-faults the sort buffer. Variant v
+//          of a recorded dataset is the window starting at key v * dataset_size
+//          (modulo the file length, wrapping around its end).
+// Parameters: dataset_size - elements per input, variant_count - distinct inputs to generate,
+//             distribution - key generator (uniform by default)
+// Returns: ready-to-use pool for the requested distribution
+template <typename Element>
+benchmark_input_pool<Element> build_input_pool(int dataset_size, int variant_count = INPUT_POOL_VARIANTS,
+                                               const input_distribution& distribution = registered_distributions[0]) {
+    benchmark_input_pool<Element> input_pool;
+    input_pool.distribution_label = distribution.distribution_label;
+
+    // Variant seeds derive from the base seed, so pools are identical across runs
+    vector<optional<span<const Element>>> mapped_windows(variant_count);
+    for (int variant_index = 0; variant_index < variant_count; variant_index++) {
+        if (const mapped_dataset_file* dataset_file = distribution.recorded_source) {
+            size_t window_offset = size_t(variant_index) * size_t(dataset_size) % dataset_file->key_count();
+            if constexpr (dataset_key_type_of<Element>().has_value()) {
+                if (dataset_file->key_type() == *dataset_key_type_of<Element>() &&
+                    window_offset + size_t(dataset_size) <= dataset_file->key_count()) {
+                    mapped_windows[variant_index] = dataset_file->keys<Element>().subspan(window_offset, dataset_size);
+                    continue;
+                }
+            }
+            input_pool.variant_storage.push_back(materialize_recorded_window<Element>(*dataset_file, window_offset, dataset_size));
+            continue;
+        }
+        input_pool.variant_storage.push_back(
+            generate_distribution_dataset<Element>(distribution, dataset_size,
+                                                   active_run_configuration().dataset_seed + variant_index));
+    }
+    size_t storage_index = 0;
+    for (const optional<span<const Element>>& mapped_window : mapped_windows) {
+        input_pool.input_variants.push_back(mapped_window ? *mapped_window : span<const Element>(input_pool.variant_storage[storage_index++]));
+        input_pool.mapped_variant_count += mapped_window.has_value();
+    }
+    for (span<const Element> input_variant : input_pool.input_variants) {
+        input_pool.variant_fingerprints.push_back(compute_multiset_fingerprint(input_variant));
+    }
+
+    // Touch every page of the working buffer now rather than inside the first timed run
+    input_pool.sort_buffer.assign(input_pool.input_variants.front().begin(), input_pool.input_variants.front().end());
+    return input_pool;
+}
+
+/*
+================================================================================
+HARDWARE PERFORMANCE COUNTERS - Optional perf_event instrumentation of timed runs
+================================================================================
+*/
+
+// Enumeration: hardware_counter_kind
+// Purpose: Events recorded around every timed repetition
+enum class hardware_counter_kind {
+    cpu_cycles,
+    retired_instructions,
+    branch_misses,
+    l1d_read_misses,
+    llc_read_misses,
+    dtlb_read_misses,
+};
+
+constexpr size_t HARDWARE_COUNTER_KIND_COUNT = 6;  // Entries of hardware_counter_kind
+
+// Function: hardware_counter_label
+// Purpose: Short report name of a counter
+const char* hardware_counter_label(hardware_counter_kind counter_kind) {
+    switch (counter_kind) {
+        case hardware_counter_kind::cpu_cycles: return "cycles";
+        case hardware_counter_kind::retired_instructions: return "instructions";
+        case hardware_counter_kind::branch_misses: return "branch misses";
+        case hardware_counter_kind::l1d_read_misses: return "L1D misses";
+        case hardware_counter_kind::llc_read_misses: return "LLC misses";
+        case hardware_counter_kind::dtlb_read_misses: return "dTLB misses";
+    }
+    return "unknown";
+}
+
+// Structure: hardware_counter_readings
+// Purpose: Per-repetition averages of every counter, with per-counter availability
+struct hardware_counter_readings {
+    bool counters_available = false;                          // Any counter could be opened
+    string unavailable_reason;                                // Why none could, when not available
+    array<bool, HARDWARE_COUNTER_KIND_COUNT> counter_valid{}; // Counter opened and was scheduled
+    array<double, HARDWARE_COUNTER_KIND_COUNT> per_run_values{};  // Multiplex-scaled mean per repetition
+
+    // Function: value_of
+    // Returns: mean count per repetition, NaN when the counter is not valid
+    double value_of(hardware_counter_kind counter_kind) const {
+        size_t counter_index = static_cast<size_t>(counter_kind);
+        return counter_valid[counter_index] ? per_run_values[counter_index] : numeric_limits<double>::quiet_NaN();
+    }
+};
+
+// Function: format_event_count
+// Purpose: Renders an event count with a k/M/G suffix, "n/a" when unavailable
+string format_event_count(double event_count) {
+    if (isnan(event_count)) {
+        return "n/a";
+    }
+    ostringstream formatted_count;
+    formatted_count << fixed << setprecision(2);
+    if (event_count >= 1e9) {
+        formatted_count << event_count / 1e9 << "G";
+    } else if (event_count >= 1e6) {
+        formatted_count << event_count / 1e6 << "M";
+    } else if (event_count >= 1e3) {
+        formatted_count << event_count / 1e3 << "k";
+    } else {
+        formatted_count << setprecision(1) << event_count;
+    }
+    return formatted_count.str();
+}
+
+// Class: hardware_counter_group
+// Purpose: Opens one perf_event per hardware_counter_kind for the calling thread
+//          (user space only) and pauses/resumes them around each timed region.
+//          Every failure degrades to "not available" - the benchmark never depends
+//          on counters. Work done by pool threads is not attributed.
+class hardware_counter_group {
+public:
+    // Constructor: opens every event disabled; unsupported events are left closed
+    hardware_counter_group() {
+        event_descriptors.fill(-1);
+#ifdef __linux__
+        const pair<uint32_t, uint64_t> event_configurations[HARDWARE_COUNTER_KIND_COUNT] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            {PERF_TYPE_HW_CACHE, cache_miss_configuration(PERF_COUNT_HW_CACHE_L1D)},
+            {PERF_TYPE_HW_CACHE, cache_miss_configuration(PERF_COUNT_HW_CACHE_LL)},
+            {PERF_TYPE_HW_CACHE, cache_miss_configuration(PERF_COUNT_HW_CACHE_DTLB)},
+        };
+        int first_errno = 0;
+        for (size_t counter_index = 0; counter_index < HARDWARE_COUNTER_KIND_COUNT; counter_index++) {
+            perf_event_attr event_attributes{};
+            event_attributes.size = sizeof(event_attributes);
+            event_attributes.type = event_configurations[counter_index].first;
+            event_attributes.config = event_configurations[counter_index].second;
+            event_attributes.disabled = 1;
+            event_attributes.exclude_kernel = 1;   // Permitted at perf_event_paranoid <= 2
+            event_attributes.exclude_hv = 1;
+            event_attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            // Separate events rather than one group: a group that exceeds the PMU's
+            // counters is never scheduled, independent events are multiplexed instead
+            long event_descriptor = syscall(SYS_perf_event_open, &event_attributes, 0, -1, -1, 0);
+            if (event_descriptor >= 0) {
+                event_descriptors[counter_index] = static_cast<int>(event_descriptor);
+            } else if (first_errno == 0) {
+                first_errno = errno;
+            }
+        }
+        if (!any_counter_open()) {
+            failure_reason = string("perf_event_open failed: ") + strerror(first_errno);
+        }
+#else
+        failure_reason = "perf_event_open is Linux-only";
+#endif
+    }
+
+    // Destructor: closes every opened event
+    ~hardware_counter_group() {
+#ifdef __linux__
+        for (int event_descriptor : event_descriptors) {
+            if (event_descriptor >= 0) {
+                close(event_descriptor);
+            }
+        }
+#endif
+    }
+
+    hardware_counter_group(const hardware_counter_group&) = delete;
+    hardware_counter_group& operator=(const hardware_counter_group&) = delete;
+
+    // Function: resume
+    // Purpose: Starts counting - called immediately before the timed region
+    void resume() {
+        control_every_event(true);
+    }
+
+    // Function: pause
+    // Purpose: Stops counting - called immediately after the timed region
+    void pause() {
+        control_every_event(false);
+    }
+
+    // Function: read_per_run
+    // Purpose: Reads every counter, scales for multiplexing and averages per repetition
+    // Parameters: measured_runs - timed repetitions the counters were resumed for
+    // Returns: readings with per-counter validity
+    hardware_counter_readings read_per_run(int measured_runs) const {
+        hardware_counter_readings readings;
+        readings.counters_available = any_counter_open();
+        readings.unavailable_reason = failure_reason;
+#ifdef __linux__
+        for (size_t counter_index = 0; counter_index < HARDWARE_COUNTER_KIND_COUNT; counter_index++) {
+            uint64_t counter_values[3] = {};  // value, time enabled, time running
+            if (event_descriptors[counter_index] < 0 || measured_runs <= 0 ||
+                read(event_descriptors[counter_index], counter_values, sizeof(counter_values)) != sizeof(counter_values) ||
+                counter_values[2] == 0) {
+                continue;  // Not opened, or never got a hardware counter
+            }
+            double scaled_value = static_cast<double>(counter_values[0]) * counter_values[1] / counter_values[2];
+            readings.counter_valid[counter_index] = true;
+            readings.per_run_values[counter_index] = scaled_value / measured_runs;
+        }
+#else
+        (void)measured_runs;
+#endif
+        return readings;
+    }
+
+private:
+#ifdef __linux__
+    // Function: cache_miss_configuration
+    // Returns: PERF_TYPE_HW_CACHE config for read misses of the given cache
+    static uint64_t cache_miss_configuration(uint64_t cache_identifier) {
+        return cache_identifier | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    }
+#endif
+
+    // Function: any_counter_open
+    // Returns: true when at least one event was opened
+    bool any_counter_open() const {
+        return any_of(event_descriptors.begin(), event_descriptors.end(),
+                      [](int event_descriptor) { return event_descriptor >= 0; });
+    }
+
+    // Function: control_every_event
+    // Purpose: Enables or disables every opened event
+    void control_every_event(bool enable_counting) {
+#ifdef __linux__
+        for (int event_descriptor : event_descriptors) {
+            if (event_descriptor >= 0) {
+                ioctl(event_descriptor, enable_counting ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+#else
+        (void)enable_counting;
+#endif
+    }
+
+    array<int, HARDWARE_COUNTER_KIND_COUNT> event_descriptors;   // -1 where the event is not open
+    string failure_reason;                                       // Set when no event could be opened
+};
+
+/*
+================================================================================
+STATISTICAL MEASUREMENT CORE - Warmup, adaptive repetition and robust statistics
+================================================================================
+*/
+
+// Structure: timing_statistics
+// Purpose: Summary of the timed samples of one measurement (all times in nanoseconds)
+struct timing_statistics {
+    int sample_count = 0;                // Timed repetitions after warmup
+    int warmup_count = 0;                // Untimed warmup repetitions
+    double mean_time = 0.0;              // Arithmetic mean
+    double median_time = 0.0;            // 50th percentile
+    double p90_time = 0.0;               // 90th percentile
+    double p99_time = 0.0;               // 99th percentile
+    double minimum_time = 0.0;           // Fastest sample
+    double maximum_time = 0.0;           // Slowest sample
+    double standard_deviation = 0.0;     // Sample standard deviation
+    double median_absolute_deviation = 0.0;  // MAD, robust spread estimate
+    double confidence_half_width = 0.0;  // 95% confidence half-width of the mean
+    double nanoseconds_per_element = 0.0;    // Median time divided by elements per run
+    int outlier_count = 0;               // Samples with modified z-score above threshold
+    bool confidence_reached = false;     // Whether the CI target stopped the repetition
+};
+
+// Function: interpolated_percentile
+// Purpose: Percentile of an ascending sample set with linear interpolation
+// Parameters: sorted_samples - ascending samples, percentile_rank - 0..1
+// Returns: interpolated sample value
+double interpolated_percentile(const vector<double>& sorted_samples, double percentile_rank) {
+    if (sorted_samples.empty()) {
+        return 0.0;
+    }
+    double fractional_index = percentile_rank * (sorted_samples.size() - 1);
+    size_t lower_index = static_cast<size_t>(fractional_index);
+    size_t upper_index = min(lower_index + 1, sorted_samples.size() - 1);
+    double blend_weight = fractional_index - lower_index;
+    return sorted_samples[lower_index] * (1.0 - blend_weight) + sorted_samples[upper_index] * blend_weight;
+}
+
+// Function: summarize_timing_samples
+// Purpose: Computes location, spread, percentile and outlier statistics
+// Parameters: timing_samples - raw sample durations in nanoseconds,
+//             elements_per_run - element count used for the per-element cost
+// Returns: populated timing_statistics (warmup and stop-reason fields untouched)
+timing_statistics summarize_timing_samples(vector<double> timing_samples, size_t elements_per_run) {
+    timing_statistics statistics;
+    statistics.sample_count = static_cast<int>(timing_samples.size());
+    if (timing_samples.empty()) {
+        return statistics;
+    }
+    sort(timing_samples.begin(), timing_samples.end());
+
+    size_t sample_count = timing_samples.size();
+    double sample_sum = 0.0;
+    for (double sample_time : timing_samples) {
+        sample_sum += sample_time;
+    }
+    statistics.mean_time = sample_sum / sample_count;
+
+    double squared_deviation_sum = 0.0;
+    for (double sample_time : timing_samples) {
+        squared_deviation_sum += (sample_time - statistics.mean_time) * (sample_time - statistics.mean_time);
+    }
+    statistics.standard_deviation = sample_count > 1 ? sqrt(squared_deviation_sum / (sample_count - 1)) : 0.0;
+    statistics.confidence_half_width = CONFIDENCE_Z_SCORE * statistics.standard_deviation / sqrt(static_cast<double>(sample_count));
+
+    statistics.minimum_time = timing_samples.front();
+    statistics.maximum_time = timing_samples.back();
+    statistics.median_time = interpolated_percentile(timing_samples, 0.50);
+    statistics.p90_time = interpolated_percentile(timing_samples, 0.90);
+    statistics.p99_time = interpolated_percentile(timing_samples, 0.99);
+
+    // Median absolute deviation around the median
+    vector<double> absolute_deviations;
+    absolute_deviations.reserve(sample_count);
+    for (double sample_time : timing_samples) {
+        absolute_deviations.push_back(fabs(sample_time - statistics.median_time));
+    }
+    sort(absolute_deviations.begin(), absolute_deviations.end());
+    statistics.median_absolute_deviation = interpolated_percentile(absolute_deviations, 0.50);
+
+    // Flag outliers by modified z-score (Iglewicz-Hoaglin: 0.6745 * |x - median| / MAD)
+    if (statistics.median_absolute_deviation > 0.0) {
+        for (double sample_time : timing_samples) {
+            double modified_z_score = 0.6745 * fabs(sample_time - statistics.median_time)
+                                      / statistics.median_absolute_deviation;
+            if (modified_z_score > OUTLIER_MODIFIED_Z_THRESHOLD) {
+                statistics.outlier_count++;
+            }
+        }
+    }
+
+    statistics.nanoseconds_per_element = elements_per_run > 0 ? statistics.median_time / elements_per_run : 0.0;
+    return statistics;
+}
+
+// Structure: measurement_policy
+// Purpose: Repetition rules used by collect_timing_samples
+struct measurement_policy {
+    int warmup_iterations = active_run_configuration().warmup_iterations;    // Untimed runs first
+    int minimum_iterations = active_run_configuration().minimum_iterations;  // Timed runs always taken
+    int maximum_iterations = active_run_configuration().maximum_iterations;  // Hard cap on timed runs
+    double target_relative_confidence = active_run_configuration().target_relative_confidence;  // CI half-width / mean goal
+    double time_budget_seconds = active_run_configuration().time_budget_seconds;  // Timed work before giving up
+};
+
+// Function: collect_timing_samples
+// Purpose: Runs warmup repetitions, then timed repetitions until the 95% confidence
+//          interval of the mean is within the relative target, the repetition cap is
+//          hit or the time budget is spent
+// Parameters: prepare_run - untimed setup called before every repetition with its index,
+//             timed_run - the measured body, inspect_run - untimed check after each
+//             timed repetition, elements_per_run - elements processed per repetition,
+//             report_progress - whether to publish progress to the background reporter,
+//             policy - warmup, repetition and budget rules, hardware_counters - optional
+//             counters resumed around each timed repetition (not during warmup)
+// Returns: statistics over the timed repetitions
+template <typename PrepareRun, typename TimedRun, typename InspectRun>
+timing_statistics collect_timing_samples(PrepareRun prepare_run, TimedRun timed_run, InspectRun inspect_run,
+                                         size_t elements_per_run, bool report_progress,
+                                         const measurement_policy& policy = {},
+                                         hardware_counter_group* hardware_counters = nullptr) {
+    // Warmup primes caches, branch predictors and lazily-initialised resources
+    for (int warmup_index = 0; warmup_index < policy.warmup_iterations; warmup_index++) {
+        prepare_run(warmup_index);
+        timed_run(warmup_index);
+    }
+
+    vector<double> timing_samples;
+    timing_samples.reserve(policy.maximum_iterations);
+    auto measurement_start = steady_clock::now();
+    bool confidence_reached = false;
+    // Running mean and squared-deviation sum (Welford) - the stopping rule needs only the
+    // mean's confidence interval, so no repetition re-sorts the samples
+    double running_mean = 0.0;
+    double running_squared_deviations = 0.0;
+    if (report_progress) {
+        active_progress_reporter().begin_phase(policy.minimum_iterations);
+    }
+
+    for (int iteration_counter = 0; iteration_counter < policy.maximum_iterations; iteration_counter++) {
+        prepare_run(iteration_counter);
+
+        // Timed region contains only the measured body; counter syscalls stay outside it
+        if (hardware_counters != nullptr) {
+            hardware_counters->resume();
+        }
+        auto start_timestamp = steady_clock::now();
+        timed_run(iteration_counter);
+        auto end_timestamp = steady_clock::now();
+        if (hardware_counters != nullptr) {
+            hardware_counters->pause();
+        }
+        double sample_time = duration<double, nano>(end_timestamp - start_timestamp).count();
+        timing_samples.push_back(sample_time);
+
+        inspect_run(iteration_counter);
+
+        // Estimate how many samples the confidence target needs for the progress display
+        int sample_count = iteration_counter + 1;
+        double previous_mean = running_mean;
+        running_mean += (sample_time - running_mean) / sample_count;
+        running_squared_deviations += (sample_time - previous_mean) * (sample_time - running_mean);
+        double running_deviation = sample_count > 1 ? sqrt(running_squared_deviations / (sample_count - 1)) : 0.0;
+        double relative_half_width = running_mean > 0.0
+            ? CONFIDENCE_Z_SCORE * running_deviation / sqrt(static_cast<double>(sample_count)) / running_mean : 0.0;
+        confidence_reached = sample_count >= policy.minimum_iterations && relative_half_width <= policy.target_relative_confidence;
+        bool budget_spent = sample_count >= policy.minimum_iterations &&
+            duration<double>(steady_clock::now() - measurement_start).count() >= policy.time_budget_seconds;
+
+        if (report_progress) {
+            double required_samples = relative_half_width > 0.0
+                ? sample_count * pow(relative_half_width / policy.target_relative_confidence, 2.0) : sample_count;
+            int projected_total = static_cast<int>(clamp(required_samples, static_cast<double>(policy.minimum_iterations),
+                                                         static_cast<double>(policy.maximum_iterations)));
+            active_progress_reporter().report_iteration(
+                sample_count, (confidence_reached || budget_spent) ? sample_count : max(projected_total, sample_count),
+                timing_samples.back());
+        }
+        if (confidence_reached || budget_spent) {
+            break;
+        }
+    }
+    if (report_progress) {
+        active_progress_reporter().finish_phase();
+    }
+
+    timing_statistics statistics = summarize_timing_samples(move(timing_samples), elements_per_run);
+    statistics.warmup_count = policy.warmup_iterations;
+    statistics.confidence_reached = confidence_reached;
+    return statistics;
+}
+
+// Function: format_duration
+// Purpose: Renders a nanosecond duration with a readable unit
+// Parameters: duration_nanoseconds - duration to format
+// Returns: string such as "812.0 ns", "14.25 us" or "3.117 ms"
+string format_duration(double duration_nanoseconds) {
+    ostringstream formatted_duration;
+    formatted_duration << fixed;
+    if (duration_nanoseconds < 1e3) {
+        formatted_duration << setprecision(1) << duration_nanoseconds << " ns";
+    } else if (duration_nanoseconds < 1e6) {
+        formatted_duration << setprecision(2) << duration_nanoseconds / 1e3 << " us";
+    } else if (duration_nanoseconds < 1e9) {
+        formatted_duration << setprecision(3) << duration_nanoseconds / 1e6 << " ms";
+    } else {
+        formatted_duration << setprecision(3) << duration_nanoseconds / 1e9 << " s";
+    }
+    return formatted_duration.str();
+}
+
+/*
+================================================================================
+PERFORMANCE ANALYSIS SYSTEM - Algorithm execution measurement and reporting
 ================================================================================
 */
 
@@ -180,159 +7215,4288 @@ PERFORMANCE ANALYSIS SYSTEM - Algorithm execution measurement and reporting
 // Purpose: Encapsulates performance data for individual sorting algorithms
 struct algorithm_performance_metrics {
     string algorithm_identifier;        // Name of sorting algorithm
-    double average_execution_time;      // Mean execution duration in milliseconds
-    double minimum_execution_time;      // Fastest recorded execution time
-    double maximum_execution_time;      // Slowest recorded execution time
+    string element_label;               // Element type that was sorted
+    string distribution_label;          // Input distribution of the pool
+    string complexity_label;            // Asymptotic class from the registry
+    bool declared_stable;               // Stability flag from the registry
+    stability_verdict observed_stability = stability_verdict::not_checked;  // Index-tagged tie check
+    size_t dataset_size;                // Elements per timed run
+    double effective_gigabytes_per_second = 0.0;  // Bytes sorted per run over the median time
+    timing_statistics timing;           // Robust statistics over the timed runs (ns)
     bool correctness_validation;        // Verification of sorting accuracy
+    bool order_validation;              // Every output was in key order
+    bool permutation_validation;        // Every output matched its input's multiset fingerprint
+    double validation_median_time;      // Median cost of one untimed validation (ns)
+    hardware_counter_readings hardware_counters;  // Per-run perf_event counts, when available
+    memory_footprint_readings memory_footprint;   // Peak RSS and page faults over the measurement
+};
+
+// Function: measure_algorithm_performance
+// Purpose: Executes one registered engine repeatedly and collects performance metrics.
+//          Instantiated per descriptor, so the timed call is direct and inlinable.
+// Parameters: input_pool - pre-generated inputs shared by every engine of this element type,
+//             report_progress - print headings and progress bar, policy - repetition limits
+// Returns: performance metrics structure with statistical data
+template <typename Descriptor, typename Element>
+algorithm_performance_metrics measure_algorithm_performance(benchmark_input_pool<Element>& input_pool,
+                                                            bool report_progress = true,
+                                                            const measurement_policy& policy = {}) {
+    const string algorithm_name = Descriptor::algorithm_name;
+    size_t dataset_size = input_pool.sort_buffer.size();
+
+    if (report_progress) {
+        cout << "\nAnalyzing " << algorithm_name << " Algorithm Performance:" << endl;
+        cout << "Executing " << policy.warmup_iterations << " warmup + " << policy.minimum_iterations << ".."
+             << policy.maximum_iterations << " adaptive iterations with "
+             << dataset_size << " " << element_type_label<Element>() << " elements..." << endl;
+    }
+
+    bool outputs_ordered = true;
+    bool outputs_permuted = true;
+    vector<double> validation_samples;
+    span<Element> test_dataset;
+    unique_ptr<hardware_counter_group> hardware_counters =
+        ENABLE_HARDWARE_COUNTERS ? make_unique<hardware_counter_group>() : nullptr;
+    memory_footprint_probe memory_probe;
+
+    timing_statistics timing = collect_timing_samples(
+        // Load the shared input into the reused buffer - copying also warms the cache
+        [&](int iteration_counter) { test_dataset = input_pool.load_iteration_input(iteration_counter); },
+        // Execute sorting engine on test dataset - direct call, no indirection
+        [&](int) { Descriptor::sort(test_dataset, benchmark_element_traits<Element>::key_projection); },
+        // Validate order and permutation for quality assurance - untimed, but costed
+        [&](int iteration_counter) {
+            auto validation_start = steady_clock::now();
+            sort_validation_result validation_result = validate_sorted_permutation(
+                span<const Element>(test_dataset), benchmark_element_traits<Element>::key_projection,
+                input_pool.expected_fingerprint(iteration_counter));
+            validation_samples.push_back(duration<double, nano>(steady_clock::now() - validation_start).count());
+            outputs_ordered = outputs_ordered && validation_result.keys_sorted;
+            outputs_permuted = outputs_permuted && validation_result.permutation_intact;
+        },
+        dataset_size, report_progress, policy, hardware_counters.get());
+
+    if (report_progress) {
+        cout << "\n✓ Analysis Complete (" << timing.sample_count << " samples"
+             << (timing.confidence_reached ? ", confidence target met" : ", stopped by budget") << ")" << endl;
+    }
+
+    // Construct and return performance metrics structure
+    algorithm_performance_metrics metrics;
+    metrics.algorithm_identifier = algorithm_name;
+    metrics.element_label = element_type_label<Element>();
+    metrics.distribution_label = input_pool.distribution_label;
+    metrics.complexity_label = complexity_class_label(Descriptor::time_complexity);
+    metrics.declared_stable = Descriptor::is_stable;
+    metrics.dataset_size = dataset_size;
+    metrics.timing = timing;
+    metrics.effective_gigabytes_per_second =
+        timing.median_time > 0.0 ? dataset_size * sizeof(Element) / timing.median_time : 0.0;
+    metrics.observed_stability = verify_descriptor_stability<Descriptor>(input_pool.input_variants.front());
+    // A declared-stable engine that reorders ties is incorrect, not merely slow
+    bool stability_honoured = !Descriptor::is_stable || metrics.observed_stability != stability_verdict::ties_reordered;
+    metrics.correctness_validation = outputs_ordered && outputs_permuted && stability_honoured;
+    metrics.order_validation = outputs_ordered;
+    metrics.permutation_validation = outputs_permuted;
+    metrics.validation_median_time = summarize_timing_samples(move(validation_samples), dataset_size).median_time;
+    if (hardware_counters) {
+        metrics.hardware_counters = hardware_counters->read_per_run(timing.sample_count);
+    } else {
+        metrics.hardware_counters.unavailable_reason = "disabled by ENABLE_HARDWARE_COUNTERS";
+    }
+    metrics.memory_footprint = memory_probe.finish(timing.warmup_count + timing.sample_count);
+
+    return metrics;
+}
+
+// Function: display_performance_report
+// Purpose: Generates formatted performance analysis report
+// Parameters: metrics_collection - vector containing all algorithm performance data,
+//             element_label - element type the metrics were collected for
+void display_performance_report(const vector<algorithm_performance_metrics>& metrics_collection,
+                                const string& element_label) {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "COMPREHENSIVE ALGORITHM PERFORMANCE ANALYSIS REPORT [" << element_label << " elements]" << endl;
+    cout << string(80, '=') << endl;
+    
+    // Display detailed metrics for each algorithm
+    for (const auto& algorithm_metrics : metrics_collection) {
+        cout << "\nAlgorithm: " << algorithm_metrics.algorithm_identifier << endl;
+        cout << string(40, '-') << endl;
+        cout << "Complexity Class:       " << algorithm_metrics.complexity_label << endl;
+        cout << "Stable Ordering:        " << (algorithm_metrics.declared_stable ? "yes" : "no")
+             << " declared, ties " << stability_verdict_label(algorithm_metrics.observed_stability)
+             << " on the index-tagged input" << endl;
+        const timing_statistics& timing = algorithm_metrics.timing;
+        cout << "Samples:                " << timing.sample_count << " timed + " << timing.warmup_count
+             << " warmup" << (timing.confidence_reached ? "" : " (confidence target not met)") << endl;
+        cout << "Median Execution Time:  " << format_duration(timing.median_time) << endl;
+        cout << "Mean Execution Time:    " << format_duration(timing.mean_time)
+             << " +/- " << format_duration(timing.confidence_half_width) << " (95% CI)" << endl;
+        cout << "P90 / P99:              " << format_duration(timing.p90_time) << " / "
+             << format_duration(timing.p99_time) << endl;
+        cout << "Min / Max:              " << format_duration(timing.minimum_time) << " / "
+             << format_duration(timing.maximum_time) << endl;
+        cout << "Std Deviation / MAD:    " << format_duration(timing.standard_deviation) << " / "
+             << format_duration(timing.median_absolute_deviation) << endl;
+        cout << "Cost Per Element:       " << fixed << setprecision(3) << timing.nanoseconds_per_element << " ns" << endl;
+        cout << "Effective Bandwidth:    " << setprecision(3) << algorithm_metrics.effective_gigabytes_per_second
+             << " GB/s (" << setprecision(1)
+             << 100.0 * algorithm_metrics.effective_gigabytes_per_second / measure_memory_copy_bandwidth()
+             << "% of the copy ceiling)" << endl;
+        cout << "Outliers:               " << timing.outlier_count << " of " << timing.sample_count
+             << " (modified z > " << setprecision(1) << OUTLIER_MODIFIED_Z_THRESHOLD << ")" << endl;
+        const hardware_counter_readings& counters = algorithm_metrics.hardware_counters;
+        if (counters.counters_available) {
+            double cycle_count = counters.value_of(hardware_counter_kind::cpu_cycles);
+            double instruction_count = counters.value_of(hardware_counter_kind::retired_instructions);
+            cout << "Cycles / Instructions:  " << format_event_count(cycle_count) << " / "
+                 << format_event_count(instruction_count) << " per run";
+            if (!isnan(cycle_count) && !isnan(instruction_count) && cycle_count > 0.0) {
+                cout << " (IPC " << fixed << setprecision(2) << instruction_count / cycle_count << ")";
+            }
+            cout << endl;
+            cout << "Branch Misses:          "
+                 << format_event_count(counters.value_of(hardware_counter_kind::branch_misses)) << " per run" << endl;
+            cout << "L1D / LLC / dTLB Miss:  "
+                 << format_event_count(counters.value_of(hardware_counter_kind::l1d_read_misses)) << " / "
+                 << format_event_count(counters.value_of(hardware_counter_kind::llc_read_misses)) << " / "
+                 << format_event_count(counters.value_of(hardware_counter_kind::dtlb_read_misses)) << " per run" << endl;
+        }
+        const memory_footprint_readings& footprint = algorithm_metrics.memory_footprint;
+        cout << "Memory Footprint:       peak RSS " << fixed << setprecision(1) << footprint.peak_resident_megabytes
+             << " MB" << (footprint.peak_scoped ? "" : " (process lifetime)") << ", " << setprecision(2)
+             << footprint.minor_faults_per_run << " minor / " << footprint.major_faults_per_run
+             << " major page faults per run" << endl;
+        cout << "Correctness Validation: " 
+             << (algorithm_metrics.correctness_validation ? "PASSED" : "FAILED")
+             << " (order " << (algorithm_metrics.order_validation ? "ok" : "VIOLATED")
+             << ", permutation " << (algorithm_metrics.permutation_validation ? "ok" : "BROKEN")
+             << (algorithm_metrics.declared_stable && algorithm_metrics.observed_stability == stability_verdict::ties_reordered
+                     ? ", stability BROKEN" : "") << ")" << endl;
+        cout << "Validation Cost:        " << format_duration(algorithm_metrics.validation_median_time)
+             << " per run, untimed (" << fixed << setprecision(1)
+             << 100.0 * algorithm_metrics.validation_median_time / timing.median_time << "% of median sort)" << endl;
+    }
+
+    const scratch_memory_arena& calling_thread_arena = thread_scratch_arena();
+    cout << "\nScratch Arena (calling thread): " << fixed << setprecision(1)
+         << calling_thread_arena.reserved_bytes() / (1024.0 * 1024.0) << " MB reserved, "
+         << scratch_page_backing_label(calling_thread_arena.page_backing()) << endl;
+    const cache_hierarchy_info& cache_info = active_cache_hierarchy();
+    cout << "Memory Hierarchy:               L1d " << cache_info.l1_data_bytes / 1024 << " KB, L2 "
+         << cache_info.l2_bytes / 1024 << " KB, L3 " << cache_info.l3_bytes / 1024 << " KB ("
+         << cache_info.detection_source << "), copy ceiling " << setprecision(2) << measure_memory_copy_bandwidth()
+         << " GB/s" << endl;
+
+    // Per-element counter table, or one line explaining why counters are missing
+    bool counters_collected = any_of(metrics_collection.begin(), metrics_collection.end(),
+        [](const algorithm_performance_metrics& candidate) { return candidate.hardware_counters.counters_available; });
+    if (counters_collected) {
+        cout << "\nHardware Counters Per Element (calling thread, user space):" << endl;
+        cout << left << setw(26) << "Algorithm" << right << setw(9) << "cycles" << setw(7) << "IPC";
+        for (hardware_counter_kind counter_kind : {hardware_counter_kind::branch_misses, hardware_counter_kind::l1d_read_misses,
+                                                   hardware_counter_kind::llc_read_misses, hardware_counter_kind::dtlb_read_misses}) {
+            cout << setw(14) << hardware_counter_label(counter_kind);
+        }
+        cout << endl;
+        for (const auto& algorithm_metrics : metrics_collection) {
+            const hardware_counter_readings& counters = algorithm_metrics.hardware_counters;
+            double element_count = static_cast<double>(algorithm_metrics.dataset_size);
+            auto per_element_cell = [&](double event_count, int cell_width, int cell_precision) {
+                ostringstream cell_text;
+                if (isnan(event_count)) {
+                    cell_text << "n/a";
+                } else {
+                    cell_text << fixed << setprecision(cell_precision) << event_count;
+                }
+                cout << setw(cell_width) << cell_text.str();
+            };
+            double cycle_count = counters.value_of(hardware_counter_kind::cpu_cycles);
+            double instruction_count = counters.value_of(hardware_counter_kind::retired_instructions);
+            cout << left << setw(26) << algorithm_metrics.algorithm_identifier << right;
+            per_element_cell(cycle_count / element_count, 9, 1);
+            per_element_cell(cycle_count > 0.0 ? instruction_count / cycle_count : numeric_limits<double>::quiet_NaN(), 7, 2);
+            for (hardware_counter_kind counter_kind : {hardware_counter_kind::branch_misses, hardware_counter_kind::l1d_read_misses,
+                                                       hardware_counter_kind::llc_read_misses, hardware_counter_kind::dtlb_read_misses}) {
+                per_element_cell(counters.value_of(counter_kind) / element_count, 14, 4);
+            }
+            cout << endl;
+        }
+    } else if (!metrics_collection.empty()) {
+        cout << "\nHardware Counters: unavailable (" << metrics_collection.front().hardware_counters.unavailable_reason << ")" << endl;
+    }
+    
+    // Determine optimal algorithm based on median performance
+    cout << "\n" << string(80, '=') << endl;
+    cout << "PERFORMANCE ANALYSIS SUMMARY" << endl;
+    cout << string(80, '=') << endl;
+    
+    // Find algorithm with minimum median execution time
+    auto optimal_algorithm = min_element(metrics_collection.begin(), metrics_collection.end(),
+        [](const algorithm_performance_metrics& first, const algorithm_performance_metrics& second) {
+            return first.timing.median_time < second.timing.median_time;
+        });
+    
+    cout << "Optimal Performance Algorithm: " << optimal_algorithm->algorithm_identifier << endl;
+    cout << "Performance Advantage: " << format_duration(optimal_algorithm->timing.median_time)
+         << " median execution" << endl;
+    
+    // Calculate and display performance differentials
+    cout << "\nRelative Performance Analysis:" << endl;
+    for (const auto& algorithm_metrics : metrics_collection) {
+        cout << "- " << algorithm_metrics.algorithm_identifier << ": ";
+        if (&algorithm_metrics == &*optimal_algorithm) {
+            cout << "optimal" << endl;
+            continue;
+        }
+        double performance_ratio = algorithm_metrics.timing.median_time / optimal_algorithm->timing.median_time;
+        cout << fixed << setprecision(2) << performance_ratio << "x the optimal median (+"
+             << format_duration(algorithm_metrics.timing.median_time - optimal_algorithm->timing.median_time) << ")" << endl;
+    }
+
+    // Compare every engine directly against the standard library references
+    auto find_reference_metrics = [&](const string& reference_name) {
+        return find_if(metrics_collection.begin(), metrics_collection.end(),
+            [&](const algorithm_performance_metrics& candidate) {
+                return candidate.algorithm_identifier == reference_name;
+            });
+    };
+    auto std_sort_metrics = find_reference_metrics(STD_SORT_REFERENCE_NAME);
+    auto std_stable_sort_metrics = find_reference_metrics(STD_STABLE_SORT_REFERENCE_NAME);
+
+    if (std_sort_metrics != metrics_collection.end() && std_stable_sort_metrics != metrics_collection.end()) {
+        cout << "\nStandard Library Reference Comparison (median time relative to reference):" << endl;
+        cout << left << setw(26) << "Algorithm"
+             << right << setw(16) << "vs std::sort" << setw(22) << "vs std::stable_sort" << setw(14) << "stability" << endl;
+        for (const auto& algorithm_metrics : metrics_collection) {
+            cout << left << setw(26) << algorithm_metrics.algorithm_identifier << right
+                 << setw(15) << fixed << setprecision(2)
+                 << algorithm_metrics.timing.median_time / std_sort_metrics->timing.median_time << "x"
+                 << setw(21) << fixed << setprecision(2)
+                 << algorithm_metrics.timing.median_time / std_stable_sort_metrics->timing.median_time << "x"
+                 << setw(14) << stability_verdict_label(algorithm_metrics.observed_stability)
+                 << endl;
+        }
+    }
+}
+
+// Function: display_parallel_scaling_report
+// Purpose: Measures parallel engine speedup across thread counts and reports
+//          where additional threads stop paying off
+void display_parallel_scaling_report() {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "PARALLEL SCALING ANALYSIS (" << PARALLEL_SCALING_DATASET_SIZE << " elements)" << endl;
+    cout << string(80, '=') << endl;
+
+    // Thread counts double up to the configured thread count, which is always included
+    unsigned hardware_threads = active_run_configuration().resolved_thread_count();
+    vector<unsigned> thread_counts;
+    for (unsigned thread_count = 1; thread_count < hardware_threads; thread_count *= 2) {
+        thread_counts.push_back(thread_count);
+    }
+    thread_counts.push_back(hardware_threads);
+
+    // Engines accepting an explicit pool so the thread count can vary
+    struct parallel_engine_entry {
+        string engine_identifier;
+        void (*engine_function)(span<int>, work_stealing_thread_pool&);
+    };
+    const parallel_engine_entry parallel_engines[] = {
+        {"Parallel Quicksort", [](span<int> data_span, work_stealing_thread_pool& thread_pool) {
+            parallel_quicksort_with_pool(data_span.begin(), data_span.end(), thread_pool);
+        }},
+        {"Parallel Merge Sort", [](span<int> data_span, work_stealing_thread_pool& thread_pool) {
+            parallel_merge_sort_with_pool(data_span.begin(), data_span.end(), thread_pool);
+        }},
+    };
+
+    // One reproducible input and one reused working buffer for every measurement
+    vector<int> reference_dataset = generate_random_dataset(PARALLEL_SCALING_DATASET_SIZE);
+    vector<int> test_dataset = reference_dataset;
+
+    for (const auto& engine_entry : parallel_engines) {
+        cout << "\nEngine: " << engine_entry.engine_identifier << endl;
+        cout << left << setw(10) << "Threads" << right << setw(14) << "Median ms"
+             << setw(12) << "Speedup" << setw(14) << "Efficiency" << endl;
+
+        double single_thread_time = 0.0;
+        double previous_speedup = 0.0;
+        unsigned plateau_thread_count = 0;
+
+        for (unsigned thread_count : thread_counts) {
+            work_stealing_thread_pool scaling_pool(thread_count, active_run_configuration().pin_threads);
+            timing_statistics timing = collect_timing_samples(
+                [&](int) { copy(reference_dataset.begin(), reference_dataset.end(), test_dataset.begin()); },
+                [&](int) { engine_entry.engine_function(test_dataset, scaling_pool); },
+                [](int) {},
+                test_dataset.size(), false);
+
+            double median_execution_time = timing.median_time / 1e6;  // Milliseconds
+            if (thread_count == 1) {
+                single_thread_time = median_execution_time;
+            }
+            double speedup = single_thread_time / median_execution_time;
+
+            // First thread count whose speedup gain over the previous step is under 10%
+            if (plateau_thread_count == 0 && previous_speedup > 0.0 && speedup < previous_speedup * 1.10) {
+                plateau_thread_count = thread_count;
+            }
+            previous_speedup = speedup;
+
+            cout << left << setw(10) << thread_count << right << setw(14) << fixed << setprecision(3)
+                 << median_execution_time << setw(11) << setprecision(2) << speedup << "x"
+                 << setw(13) << setprecision(1) << (speedup / thread_count * 100.0) << "%" << endl;
+        }
+
+        if (plateau_thread_count != 0) {
+            cout << "Scaling levels off at " << plateau_thread_count << " threads" << endl;
+        } else {
+            cout << "Scaling continues up to " << hardware_threads << " threads" << endl;
+        }
+    }
+}
+
+// Function: display_numa_sort_report
+// Purpose: Sorts one input twice - Parallel Quicksort over a vector first-touched by
+//          a single thread, and the NUMA sample sort over node-local partitions - and
+//          reports phase times, per-node bandwidth and remote-access ratios
+void display_numa_sort_report() {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "NUMA-AWARE SORT ANALYSIS (" << PARALLEL_SCALING_DATASET_SIZE << " elements)" << endl;
+    cout << string(80, '=') << endl;
+
+    const vector<numa_node_info>& node_list = active_numa_topology();
+    cout << "Topology: " << node_list.size() << " node(s) -";
+    for (const numa_node_info& node_info : node_list) {
+        cout << " node " << node_info.node_identifier << ": " << node_info.cpu_identifiers.size() << " CPUs;";
+    }
+    cout << endl;
+    if (node_list.size() == 1) {
+        cout << "Single memory node - every access is local, so this run exercises the NUMA path only" << endl;
+    }
+    numa_sort_layout sort_layout = plan_numa_layout(active_run_configuration().resolved_thread_count());
+    cout << "Partitions: " << sort_layout.partition_count() << " (one thread each, bound to its node)" << endl;
+    numa_partition_team partition_team(sort_layout);  // Started and bound once, outside every timed run
+
+    // generate_random_dataset first-touches everything from this thread - the naive setup
+    vector<int> reference_dataset = generate_random_dataset(PARALLEL_SCALING_DATASET_SIZE);
+    uint64_t reference_fingerprint = compute_multiset_fingerprint(span<const int>(reference_dataset));
+    vector<int> naive_dataset = reference_dataset;
+    timing_statistics naive_timing = collect_timing_samples(
+        [&](int) { copy(reference_dataset.begin(), reference_dataset.end(), naive_dataset.begin()); },
+        [&](int) { parallel_quicksort_with_pool(naive_dataset.begin(), naive_dataset.end(), shared_thread_pool()); },
+        [](int) {},
+        naive_dataset.size(), false);
+
+    numa_distributed_array<int> distributed_dataset;
+    numa_sort_statistics sort_statistics;
+    bool outputs_valid = true;
+    timing_statistics numa_timing = collect_timing_samples(
+        // Parallel first touch of a fresh copy - untimed, like the naive copy
+        [&](int) { distributed_dataset = first_touch_numa_array(span<const int>(reference_dataset), partition_team); },
+        [&](int) { sort_statistics = execute_numa_sample_sort(distributed_dataset, partition_team); },
+        [&](int) {
+            outputs_valid = outputs_valid && validate_sorted_permutation(span<const int>(distributed_dataset.whole_array()),
+                                                                         identity{}, reference_fingerprint).passed();
+        },
+        reference_dataset.size(), false);
+
+    cout << "\n" << left << setw(44) << "Configuration" << right << setw(14) << "Median ms" << setw(12) << "Speedup" << endl;
+    cout << left << setw(44) << "Parallel Quicksort, single-thread first touch" << right << setw(14) << fixed
+         << setprecision(3) << naive_timing.median_time / 1e6 << setw(11) << setprecision(2) << 1.0 << "x" << endl;
+    cout << left << setw(44) << "NUMA sample sort, node-local partitions" << right << setw(14) << setprecision(3)
+         << numa_timing.median_time / 1e6 << setw(11) << setprecision(2)
+         << naive_timing.median_time / numa_timing.median_time << "x" << endl;
+    cout << "Phases (last run): splitters " << setprecision(3) << sort_statistics.splitter_seconds * 1e3
+         << " ms, exchange " << sort_statistics.exchange_seconds * 1e3 << " ms, local sort "
+         << sort_statistics.local_sort_seconds * 1e3 << " ms" << endl;
+
+    // Per-node figures: partitions of a node run concurrently, so its slowest one sets the pace
+    cout << "\n" << left << setw(8) << "Node" << right << setw(12) << "Elements" << setw(16) << "Exchange GB/s"
+         << setw(13) << "Sort GB/s" << setw(15) << "Remote writes" << setw(13) << "Home pages" << endl;
+    for (size_t node_index = 0; node_index < node_list.size(); node_index++) {
+        size_t sent_elements = 0;
+        size_t remote_elements = 0;
+        size_t received_elements = 0;
+        double exchange_seconds = 0.0;
+        double sort_seconds = 0.0;
+        double home_fraction_sum = 0.0;
+        int home_fraction_samples = 0;
+        for (size_t partition_index = 0; partition_index < sort_layout.partition_count(); partition_index++) {
+            if (sort_layout.partition_nodes[partition_index] != node_index) {
+                continue;
+            }
+            sent_elements += sort_statistics.partition_sent_elements[partition_index];
+            remote_elements += sort_statistics.partition_remote_elements[partition_index];
+            received_elements += sort_statistics.partition_received_elements[partition_index];
+            exchange_seconds = max(exchange_seconds, sort_statistics.partition_exchange_seconds[partition_index]);
+            sort_seconds = max(sort_seconds, sort_statistics.partition_sort_seconds[partition_index]);
+            span<int> local_output = distributed_dataset.partition(partition_index);
+            double home_fraction = measure_home_node_fraction(local_output.data(), local_output.size_bytes(), node_index);
+            if (!isnan(home_fraction)) {
+                home_fraction_sum += home_fraction;
+                home_fraction_samples++;
+            }
+        }
+        // Exchange moves every sent element twice (read locally, written to its owner)
+        double exchange_bandwidth = exchange_seconds > 0.0 ? 2.0 * sent_elements * sizeof(int) / exchange_seconds / 1e9 : 0.0;
+        double sort_bandwidth = sort_seconds > 0.0 ? received_elements * sizeof(int) / sort_seconds / 1e9 : 0.0;
+        ostringstream home_pages_text;
+        if (home_fraction_samples > 0) {
+            home_pages_text << fixed << setprecision(1) << 100.0 * home_fraction_sum / home_fraction_samples << "%";
+        } else {
+            home_pages_text << "n/a";
+        }
+        cout << left << setw(8) << node_list[node_index].node_identifier << right << setw(12) << received_elements
+             << setw(16) << setprecision(2) << exchange_bandwidth << setw(13) << sort_bandwidth << setw(14)
+             << setprecision(1) << (sent_elements > 0 ? 100.0 * remote_elements / sent_elements : 0.0) << "%"
+             << setw(13) << home_pages_text.str() << endl;
+    }
+    cout << "Correctness Validation: " << (outputs_valid ? "PASSED" : "FAILED") << endl;
+}
+
+// Function: display_small_sort_kernel_report
+// Purpose: Benchmarks the small-array kernels standalone on batches of independent
+//          int32 arrays, and the partition kernels on one large array
+void display_small_sort_kernel_report() {
+    const simd_kernel_table& simd_kernels = active_simd_kernels();
+    cout << "\n" << string(80, '=') << endl;
+    cout << "SMALL-ARRAY KERNEL ANALYSIS (" << simd_kernels.kernel_label << " kernels selected at runtime)" << endl;
+    cout << string(80, '=') << endl;
+
+    struct small_kernel_entry {
+        string kernel_identifier;
+        void (*kernel_function)(int32_t*, size_t);
+    };
+    const small_kernel_entry small_kernels[] = {
+        {"Insertion (branching)", scalar_small_sort_int32},
+        {"Insertion (branchless)", [](int32_t* data_begin, size_t element_count) {
+            branchless_insertion_sort_range(data_begin, data_begin + element_count, ranges::less{});
+        }},
+        {"Bubble (branchless)", [](int32_t* data_begin, size_t element_count) {
+            execute_branchless_bubble_sort_algorithm(data_begin, data_begin + element_count);
+        }},
+        {string("Sorting network (") + simd_kernels.kernel_label + ")", simd_kernels.sort_small},
+    };
+
+    // One batch of independent arrays, reloaded before every timed pass
+    vector<int32_t> reference_batch =
+        generate_distribution_dataset<int32_t>(registered_distributions[0], SMALL_KERNEL_BATCH_ELEMENTS);
+    vector<int32_t> working_batch = reference_batch;
+
+    for (size_t array_size : {8, 16, 32, 64}) {
+        size_t array_count = working_batch.size() / array_size;
+        cout << "\nArray size " << array_size << " (" << array_count << " arrays per pass):" << endl;
+        cout << left << setw(30) << "Kernel" << right << setw(14) << "ns / array" << setw(16) << "vs branching"
+             << setw(12) << "Validated" << endl;
+
+        double branching_time = 0.0;
+        for (const auto& kernel_entry : small_kernels) {
+            bool all_arrays_sorted = true;
+            timing_statistics timing = collect_timing_samples(
+                [&](int) { copy(reference_batch.begin(), reference_batch.end(), working_batch.begin()); },
+                [&](int) {
+                    for (size_t array_begin = 0; array_begin + array_size <= working_batch.size(); array_begin += array_size) {
+                        kernel_entry.kernel_function(working_batch.data() + array_begin, array_size);
+                    }
+                },
+                [&](int) {
+                    for (size_t array_begin = 0; array_begin + array_size <= working_batch.size(); array_begin += array_size) {
+                        all_arrays_sorted = all_arrays_sorted &&
+                            is_sorted(working_batch.begin() + array_begin, working_batch.begin() + array_begin + array_size);
+                    }
+                },
+                working_batch.size(), false);
+
+            double time_per_array = timing.median_time / array_count;
+            if (branching_time == 0.0) {
+                branching_time = time_per_array;
+            }
+            cout << left << setw(30) << kernel_entry.kernel_identifier << right << setw(14) << fixed << setprecision(1)
+                 << time_per_array << setw(15) << setprecision(2) << branching_time / time_per_array << "x"
+                 << setw(12) << (all_arrays_sorted ? "PASSED" : "FAILED") << endl;
+        }
+    }
+
+    // Partition step in isolation, around the median key
+    struct partition_kernel_entry {
+        string kernel_identifier;
+        int32_t* (*kernel_function)(int32_t*, int32_t*, int32_t);
+    };
+    const partition_kernel_entry partition_kernels[] = {
+        {"Hoare (branching)", [](int32_t* range_begin, int32_t* range_end, int32_t pivot_value) {
+            return hoare_partition_range(range_begin, range_end, pivot_value, ranges::less{});
+        }},
+        {"Lomuto (branchless)", [](int32_t* range_begin, int32_t* range_end, int32_t pivot_value) {
+            return branchless_partition_int32(range_begin, range_end, pivot_value, false);
+        }},
+        {string("Vectorized (") + simd_kernels.kernel_label + ")", [](int32_t* range_begin, int32_t* range_end, int32_t pivot_value) {
+            return active_simd_kernels().partition(range_begin, range_end, pivot_value, false);
+        }},
+    };
+
+    vector<int32_t> reference_dataset =
+        generate_distribution_dataset<int32_t>(registered_distributions[0], SIMD_PARTITION_BENCHMARK_SIZE);
+    vector<int32_t> test_dataset = reference_dataset;
+    nth_element(test_dataset.begin(), test_dataset.begin() + test_dataset.size() / 2, test_dataset.end());
+    int32_t median_pivot = test_dataset[test_dataset.size() / 2];
+
+    cout << "\nPartition kernels (" << SIMD_PARTITION_BENCHMARK_SIZE << " elements, median pivot):" << endl;
+    cout << left << setw(30) << "Kernel" << right << setw(14) << "ns / element" << setw(16) << "vs branching"
+         << setw(12) << "Validated" << endl;
+    double branching_cost = 0.0;
+    for (const auto& kernel_entry : partition_kernels) {
+        bool partition_valid = true;
+        int32_t* split_position = nullptr;
+        timing_statistics timing = collect_timing_samples(
+            [&](int) { copy(reference_dataset.begin(), reference_dataset.end(), test_dataset.begin()); },
+            [&](int) {
+                split_position = kernel_entry.kernel_function(test_dataset.data(), test_dataset.data() + test_dataset.size(),
+                                                              median_pivot);
+            },
+            [&](int) {
+                // Hoare may leave pivot-equal keys on either side, so check <= / >=
+                partition_valid = partition_valid &&
+                    all_of(test_dataset.data(), split_position, [&](int32_t key_value) { return key_value <= median_pivot; }) &&
+                    all_of(split_position, test_dataset.data() + test_dataset.size(),
+                           [&](int32_t key_value) { return key_value >= median_pivot; });
+            },
+            test_dataset.size(), false);
+
+        if (branching_cost == 0.0) {
+            branching_cost = timing.nanoseconds_per_element;
+        }
+        cout << left << setw(30) << kernel_entry.kernel_identifier << right << setw(14) << fixed << setprecision(3)
+             << timing.nanoseconds_per_element << setw(15) << setprecision(2) << branching_cost / timing.nanoseconds_per_element
+             << "x" << setw(12) << (partition_valid ? "PASSED" : "FAILED") << endl;
+    }
+}
+
+// Function: display_segmented_batch_report
+// Purpose: Benchmarks the CSR batch API against sorting each array with its own call,
+//          across fixed, uniform and heavy-tailed segment-size distributions
+void display_segmented_batch_report() {
+    const simd_kernel_table& simd_kernels = active_simd_kernels();
+    cout << "\n" << string(80, '=') << endl;
+    cout << "SEGMENTED BATCH SORT ANALYSIS (" << simd_kernels.kernel_label << ", " << simd_kernels.vertical_lanes
+         << " segments per vertical network, " << shared_thread_pool().worker_count() << " threads)" << endl;
+    cout << string(80, '=') << endl;
+
+    struct segment_size_distribution {
+        string distribution_name;
+        size_t (*draw_length)(mt19937_64& generator_engine);
+    };
+    const segment_size_distribution segment_distributions[] = {
+        {"Fixed 8", [](mt19937_64&) -> size_t { return 8; }},
+        {"Fixed 32", [](mt19937_64&) -> size_t { return 32; }},
+        {"Fixed 256", [](mt19937_64&) -> size_t { return 256; }},
+        {"Uniform 8-256", [](mt19937_64& generator_engine) -> size_t {
+            return uniform_int_distribution<size_t>(8, 256)(generator_engine);
+        }},
+        {"Pareto 8-256 (alpha 1.2)", [](mt19937_64& generator_engine) -> size_t {
+            double uniform_draw = uniform_real_distribution<double>(numeric_limits<double>::min(), 1.0)(generator_engine);
+            return min<size_t>(256, static_cast<size_t>(8.0 * pow(uniform_draw, -1.0 / 1.2)));
+        }},
+    };
+
+    struct batch_engine_entry {
+        string engine_identifier;
+        void (*sort_batch)(span<int32_t> flat_keys, span<const size_t> segment_offsets);
+    };
+    const batch_engine_entry batch_engines[] = {
+        {"Per-array insertion sort", [](span<int32_t> flat_keys, span<const size_t> segment_offsets) {
+            for (size_t segment_index = 0; segment_index + 1 < segment_offsets.size(); segment_index++) {
+                execute_insertion_sort_algorithm(flat_keys.subspan(segment_offsets[segment_index],
+                    segment_offsets[segment_index + 1] - segment_offsets[segment_index]));
+            }
+        }},
+        {"Per-array SIMD introsort", [](span<int32_t> flat_keys, span<const size_t> segment_offsets) {
+            for (size_t segment_index = 0; segment_index + 1 < segment_offsets.size(); segment_index++) {
+                execute_simd_introsort_algorithm(flat_keys.subspan(segment_offsets[segment_index],
+                    segment_offsets[segment_index + 1] - segment_offsets[segment_index]));
+            }
+        }},
+        {"Batch, one thread", [](span<int32_t> flat_keys, span<const size_t> segment_offsets) {
+            sort_segment_range(flat_keys.data(), segment_offsets.data(), 0, segment_offsets.size() - 1,
+                               active_simd_kernels());
+        }},
+        {"Batch, thread pool", [](span<int32_t> flat_keys, span<const size_t> segment_offsets) {
+            execute_segmented_batch_sort(flat_keys, segment_offsets);
+        }},
+    };
+
+    vector<int32_t> reference_keys =
+        generate_distribution_dataset<int32_t>(registered_distributions[0], CSR_BATCH_BENCHMARK_ELEMENTS);
+    vector<int32_t> working_keys(reference_keys.size());
+
+    for (const auto& segment_distribution : segment_distributions) {
+        // Cut the shared key buffer into segments of the drawn lengths
+        mt19937_64 generator_engine(active_run_configuration().dataset_seed);
+        vector<size_t> segment_offsets = {0};
+        while (segment_offsets.back() < reference_keys.size()) {
+            segment_offsets.push_back(min(reference_keys.size(),
+                                          segment_offsets.back() + segment_distribution.draw_length(generator_engine)));
+        }
+        size_t segment_count = segment_offsets.size() - 1;
+
+        vector<int32_t> expected_keys = reference_keys;
+        for (size_t segment_index = 0; segment_index < segment_count; segment_index++) {
+            sort(expected_keys.begin() + segment_offsets[segment_index], expected_keys.begin() + segment_offsets[segment_index + 1]);
+        }
+
+        cout << "\n" << segment_distribution.distribution_name << " (" << segment_count << " arrays, "
+             << reference_keys.size() << " keys per pass):" << endl;
+        cout << left << setw(30) << "Engine" << right << setw(14) << "M arrays / s" << setw(16) << "vs insertion"
+             << setw(12) << "Validated" << endl;
+
+        double insertion_rate = 0.0;
+        for (const auto& batch_engine : batch_engines) {
+            bool segments_sorted = true;
+            timing_statistics timing = collect_timing_samples(
+                [&](int) { copy(reference_keys.begin(), reference_keys.end(), working_keys.begin()); },
+                [&](int) { batch_engine.sort_batch(working_keys, segment_offsets); },
+                [&](int) { segments_sorted = segments_sorted && working_keys == expected_keys; },
+                working_keys.size(), false);
+
+            double arrays_per_second = segment_count / (timing.median_time * 1e-9);
+            if (insertion_rate == 0.0) {
+                insertion_rate = arrays_per_second;
+            }
+            cout << left << setw(30) << batch_engine.engine_identifier << right << setw(14) << fixed << setprecision(2)
+                 << arrays_per_second / 1e6 << setw(15) << arrays_per_second / insertion_rate << "x"
+                 << setw(12) << (segments_sorted ? "PASSED" : "FAILED") << endl;
+        }
+    }
+}
+
+// Function: display_key_transform_report
+// Purpose: Sorts doubles and floats (NaN, +-0, +-inf, denormals included), full-range
+//          uint64 and short strings through the ordered key transforms, against
+//          introsort calling the equivalent comparator, validated in totalOrder
+void display_key_transform_report() {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "KEY TRANSFORM ANALYSIS (" << KEY_TRANSFORM_BENCHMARK_SIZE << " elements per key type)" << endl;
+    cout << string(80, '=') << endl;
+
+    auto report_key_type = [](auto element_tag) {
+        using Element = typename decltype(element_tag)::type;
+        using projection_type = key_projection_of<Element>;
+        using key_type = remove_cvref_t<invoke_result_t<projection_type&, const Element&>>;
+        constexpr projection_type key_projection = benchmark_element_traits<Element>::key_projection;
+
+        struct transform_engine_entry {
+            string engine_identifier;
+            void (*sort_elements)(span<Element> data_span);
+        };
+        vector<transform_engine_entry> transform_engines = {
+            {"Introsort (comparator)", [](span<Element> data_span) {
+                execute_introsort_algorithm(data_span, ordered_key_less{}, benchmark_element_traits<Element>::key_projection);
+            }},
+            {"LSD Radix (transform)", [](span<Element> data_span) {
+                execute_lsd_radix_sort_algorithm(data_span, benchmark_element_traits<Element>::key_projection);
+            }},
+            {"MSD Radix (transform)", [](span<Element> data_span) {
+                execute_msd_radix_sort_algorithm(data_span, benchmark_element_traits<Element>::key_projection);
+            }},
+        };
+        if constexpr (is_same_v<Element, float>) {
+            transform_engines.push_back({"SIMD Introsort (transform)", [](span<float> data_span) {
+                execute_simd_introsort_algorithm(data_span);
+            }});
+        }
+
+        vector<Element> reference_dataset = generate_random_dataset<Element>(KEY_TRANSFORM_BENCHMARK_SIZE);
+        vector<Element> test_dataset = reference_dataset;
+        uint64_t reference_fingerprint = compute_multiset_fingerprint(span<const Element>(reference_dataset));
+
+        cout << "\n" << element_type_label<Element>() << " keys ("
+             << (ordered_key_transform<key_type>::is_exact ? "exact" : "prefix") << " transform to "
+             << sizeof(typename ordered_key_transform<key_type>::ordered_type) * 8 << "-bit key):" << endl;
+        cout << left << setw(30) << "Engine" << right << setw(14) << "ns / element" << setw(16) << "vs comparator"
+             << setw(12) << "Validated" << endl;
+        double comparator_cost = 0.0;
+        for (const auto& transform_engine : transform_engines) {
+            bool output_valid = true;
+            timing_statistics timing = collect_timing_samples(
+                [&](int) { copy(reference_dataset.begin(), reference_dataset.end(), test_dataset.begin()); },
+                [&](int) { transform_engine.sort_elements(test_dataset); },
+                [&](int) {
+                    output_valid = output_valid &&
+                        validate_transformed_key_order(span<const Element>(test_dataset), key_projection) &&
+                        compute_multiset_fingerprint(span<const Element>(test_dataset)) == reference_fingerprint;
+                },
+                test_dataset.size(), false);
+
+            double cost_per_element = timing.median_time / test_dataset.size();
+            if (comparator_cost == 0.0) {
+                comparator_cost = cost_per_element;
+            }
+            cout << left << setw(30) << transform_engine.engine_identifier << right << setw(14) << fixed << setprecision(2)
+                 << cost_per_element << setw(15) << comparator_cost / cost_per_element << "x"
+                 << setw(12) << (output_valid ? "PASSED" : "FAILED") << endl;
+        }
+    };
+    report_key_type(type_identity<double>{});
+    report_key_type(type_identity<float>{});
+    report_key_type(type_identity<uint64_t>{});
+    report_key_type(type_identity<short_string_record>{});
+}
+
+// Function: display_dataset_generation_report
+// Purpose: Compares the serial mt19937_64 generator the inputs used to come from with
+//          the counter-based generator on one worker and on the shared pool, and checks
+//          that both pool sizes and the uniform distribution produce identical keys
+void display_dataset_generation_report() {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "DATASET GENERATION ANALYSIS (" << GENERATION_BENCHMARK_SIZE << " uniform int64 keys)" << endl;
+    cout << string(80, '=') << endl;
+
+    uint64_t generator_seed = active_run_configuration().dataset_seed;
+    work_stealing_thread_pool single_worker_pool(1);
+    auto uniform_key_generator = [](span<int64_t> key_values) {
+        return [key_values](size_t element_index, counter_based_engine& element_engine) {
+            key_values[element_index] = 1 + element_engine.bounded(10000);
+        };
+    };
+
+    vector<int64_t> serial_keys(GENERATION_BENCHMARK_SIZE);
+    vector<int64_t> single_worker_keys(GENERATION_BENCHMARK_SIZE);
+    vector<int64_t> pool_keys(GENERATION_BENCHMARK_SIZE);
+    vector<int64_t> distribution_keys(GENERATION_BENCHMARK_SIZE);
+    generate_uniform_keys(distribution_keys, generator_seed);
+
+    struct generator_entry {
+        string generator_identifier;
+        function<void()> generate_keys;
+        const vector<int64_t>* generated_keys;   // Compared with the distribution output, nullptr when not comparable
+    };
+    vector<generator_entry> generators = {
+        {"mt19937_64, serial", [&] {
+            mt19937_64 generator_engine(generator_seed);
+            uniform_int_distribution<int> distribution_range(1, 10000);
+            for (int64_t& key_value : serial_keys) {
+                key_value = distribution_range(generator_engine);
+            }
+        }, nullptr},
+        {"counter-based, 1 worker", [&] {
+            generate_in_parallel_chunks(single_worker_keys.size(), generator_seed, uniform_key_generator(single_worker_keys),
+                                        COUNTER_DRAWS_PER_ELEMENT, single_worker_pool);
+        }, &single_worker_keys},
+        {"counter-based, shared pool (" + to_string(shared_thread_pool().worker_count()) + ")", [&] {
+            generate_in_parallel_chunks(pool_keys.size(), generator_seed, uniform_key_generator(pool_keys));
+        }, &pool_keys},
+    };
+
+    cout << left << setw(30) << "Generator" << right << setw(12) << "ms" << setw(14) << "M keys/s"
+         << setw(14) << "vs serial" << setw(12) << "Identical" << endl;
+    double serial_time = 0.0;
+    for (const generator_entry& generator : generators) {
+        timing_statistics timing = collect_timing_samples(
+            [](int) {}, [&](int) { generator.generate_keys(); }, [](int) {}, GENERATION_BENCHMARK_SIZE, false);
+        if (serial_time == 0.0) {
+            serial_time = timing.median_time;
+        }
+        string identical_label = "-";
+        if (generator.generated_keys != nullptr) {
+            identical_label = *generator.generated_keys == distribution_keys ? "yes" : "NO";
+        }
+        cout << left << setw(30) << generator.generator_identifier << right << fixed << setprecision(2)
+             << setw(12) << timing.median_time / 1e6 << setw(14) << GENERATION_BENCHMARK_SIZE / (timing.median_time / 1e3)
+             << setw(13) << serial_time / timing.median_time << "x" << setw(12) << identical_label << endl;
+    }
+}
+
+// Structure: service_load_configuration
+// Purpose: Parameters of "service" mode
+struct service_load_configuration {
+    vector<double> request_rates{begin(ASYNC_LOAD_DEFAULT_RATES), end(ASYNC_LOAD_DEFAULT_RATES)};  // Offered req/s
+    size_t requests_per_rate = ASYNC_LOAD_REQUESTS_PER_RATE;  // Requests issued at each rate
+};
+
+// Function: issue_service_request
+// Purpose: Load-generator client - awaits one sort and stamps its completion time
+// Parameters: sort_service - service under test, request_keys - keys to sort,
+//             deadline - request deadline, completion_time - receives the completion instant
+detached_sort_task issue_service_request(async_sort_service& sort_service, span<int32_t> request_keys,
+                                         steady_clock::time_point deadline, steady_clock::time_point& completion_time) {
+    co_await sort_service.sort(request_keys, deadline);
+    completion_time = steady_clock::now();
+}
+
+// Function: run_service_load_benchmark
+// Purpose: Open-loop load test of the async sort service. Requests arrive as a Poisson
+//          process at each offered rate, with 80% small (8-256 keys), 19.5% medium
+//          (257-16384, log-uniform) and 0.5% large (128K-256K) sizes. Latency runs
+//          from the scheduled arrival, not the actual issue, so a stalled generator
+//          cannot hide queueing delay.
+// Parameters: load_configuration - rates and request count
+// Returns: false when an output was not sorted
+bool run_service_load_benchmark(const service_load_configuration& load_configuration) {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "ASYNC SORT SERVICE LOAD TEST (" << shared_thread_pool().worker_count() << " threads, "
+         << load_configuration.requests_per_rate << " Poisson-arrival requests per rate)" << endl;
+    cout << string(80, '=') << endl;
+
+    // Request sizes and keys are drawn once and replayed at every rate
+    mt19937_64 generator_engine(active_run_configuration().dataset_seed);
+    vector<size_t> request_offsets = {0};
+    for (size_t request_index = 0; request_index < load_configuration.requests_per_rate; request_index++) {
+        double size_class_draw = uniform_real_distribution<double>(0.0, 1.0)(generator_engine);
+        size_t request_length =
+            size_class_draw < 0.800 ? uniform_int_distribution<size_t>(8, ASYNC_SORT_BATCH_REQUEST_ELEMENTS)(generator_engine)
+          : size_class_draw < 0.995 ? static_cast<size_t>(exp(uniform_real_distribution<double>(log(257.0), log(16384.0))(generator_engine)))
+          :                           uniform_int_distribution<size_t>(1 << 17, 1 << 18)(generator_engine);
+        request_offsets.push_back(request_offsets.back() + request_length);
+    }
+    vector<int32_t> reference_keys =
+        generate_distribution_dataset<int32_t>(registered_distributions[0], static_cast<int>(request_offsets.back()));
+    vector<int32_t> request_keys(reference_keys.size());
+    uint64_t reference_fingerprint = compute_multiset_fingerprint(span<const int32_t>(reference_keys));
+
+    cout << left << setw(12) << "Offered/s" << right << setw(12) << "Achieved/s" << setw(11) << "p50 us"
+         << setw(11) << "p99 us" << setw(11) << "max us" << setw(9) << "missed" << setw(11) << "req/batch"
+         << setw(7) << "split" << setw(11) << "Validated" << endl;
+
+    bool all_outputs_sorted = true;
+    for (double request_rate : load_configuration.request_rates) {
+        copy(reference_keys.begin(), reference_keys.end(), request_keys.begin());
+        exponential_distribution<double> interarrival_seconds(request_rate);
+        vector<steady_clock::time_point> arrival_times(load_configuration.requests_per_rate);
+        vector<steady_clock::time_point> completion_times(load_configuration.requests_per_rate);
+
+        async_sort_service_statistics service_statistics;
+        steady_clock::time_point load_start = steady_clock::now();
+        {
+            async_sort_service sort_service;
+            double arrival_offset_seconds = 0.0;
+            for (size_t request_index = 0; request_index < load_configuration.requests_per_rate; request_index++) {
+                arrival_offset_seconds += interarrival_seconds(generator_engine);
+                arrival_times[request_index] =
+                    load_start + duration_cast<steady_clock::duration>(duration<double>(arrival_offset_seconds));
+                this_thread::sleep_until(arrival_times[request_index]);
+
+                size_t request_length = request_offsets[request_index + 1] - request_offsets[request_index];
+                steady_clock::time_point deadline = arrival_times[request_index] +
+                    microseconds(ASYNC_LOAD_DEADLINE_BASE_MICROSECONDS) +
+                    duration_cast<steady_clock::duration>(duration<double, nano>(request_length * ASYNC_LOAD_DEADLINE_NANOSECONDS_PER_KEY));
+                issue_service_request(sort_service, span<int32_t>(request_keys).subspan(request_offsets[request_index], request_length),
+                                      deadline, completion_times[request_index]);
+            }
+            sort_service.drain();
+            service_statistics = sort_service.statistics();
+        }
+
+        vector<double> latency_microseconds(load_configuration.requests_per_rate);
+        for (size_t request_index = 0; request_index < load_configuration.requests_per_rate; request_index++) {
+            latency_microseconds[request_index] =
+                duration<double, micro>(completion_times[request_index] - arrival_times[request_index]).count();
+        }
+        sort(latency_microseconds.begin(), latency_microseconds.end());
+        auto latency_percentile = [&latency_microseconds](double percentile) {
+            return latency_microseconds[min(latency_microseconds.size() - 1,
+                                            static_cast<size_t>(percentile * latency_microseconds.size()))];
+        };
+        double elapsed_seconds =
+            duration<double>(*max_element(completion_times.begin(), completion_times.end()) - load_start).count();
+
+        bool outputs_sorted = compute_multiset_fingerprint(span<const int32_t>(request_keys)) == reference_fingerprint;
+        for (size_t request_index = 0; outputs_sorted && request_index < load_configuration.requests_per_rate; request_index++) {
+            outputs_sorted = is_sorted(request_keys.begin() + request_offsets[request_index],
+                                       request_keys.begin() + request_offsets[request_index + 1]);
+        }
+        all_outputs_sorted = all_outputs_sorted && outputs_sorted;
+
+        double requests_per_batch = service_statistics.batch_tasks > 0
+            ? static_cast<double>(service_statistics.batched_requests) / service_statistics.batch_tasks : 0.0;
+        cout << left << setw(12) << fixed << setprecision(0) << request_rate << right << setw(12)
+             << load_configuration.requests_per_rate / elapsed_seconds << setw(11) << setprecision(1)
+             << latency_percentile(0.50) << setw(11) << latency_percentile(0.99) << setw(11) << latency_microseconds.back()
+             << setw(8) << setprecision(1) << 100.0 * service_statistics.missed_deadlines / service_statistics.completed_requests
+             << "%" << setw(11) << requests_per_batch << setw(7) << service_statistics.split_requests
+             << setw(11) << (outputs_sorted ? "PASSED" : "FAILED") << endl;
+    }
+    cout << "Deadlines: arrival + " << ASYNC_LOAD_DEADLINE_BASE_MICROSECONDS << " us + "
+         << ASYNC_LOAD_DEADLINE_NANOSECONDS_PER_KEY << " ns per key; small requests coalesce while all "
+         << ASYNC_SORT_TASKS_PER_WORKER << " task slots per worker are busy" << endl;
+    return all_outputs_sorted;
+}
+
+// Function: display_streaming_query_report
+// Purpose: Streams int32 batches and compares answering top-k, partial-sort and
+//          rank queries from the streaming engine against a full sort followed by
+//          truncation or indexing
+void display_streaming_query_report() {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "STREAMING QUERY ANALYSIS (" << STREAMING_BENCHMARK_SIZE << " int32 elements in batches of "
+         << STREAMING_BATCH_SIZE << ", k = " << STREAMING_QUERY_K << ")" << endl;
+    cout << string(80, '=') << endl;
+
+    vector<int32_t> streamed_dataset =
+        generate_distribution_dataset<int32_t>(registered_distributions[0], STREAMING_BENCHMARK_SIZE);
+    size_t median_rank = streamed_dataset.size() / 2;
+
+    // Reference answers from one full sort
+    vector<int32_t> reference_sorted = streamed_dataset;
+    execute_introsort_algorithm(span<int32_t>(reference_sorted));
+    vector<int32_t> reference_smallest(reference_sorted.begin(), reference_sorted.begin() + STREAMING_QUERY_K);
+    int32_t reference_median = reference_sorted[median_rank];
+
+    auto stream_into = [&](streaming_sort_engine<int32_t>& stream_engine) {
+        span<const int32_t> remaining_stream(streamed_dataset);
+        while (!remaining_stream.empty()) {
+            size_t batch_length = min(STREAMING_BATCH_SIZE, remaining_stream.size());
+            stream_engine.append_batch(remaining_stream.first(batch_length));
+            remaining_stream = remaining_stream.subspan(batch_length);
+        }
+    };
+
+    // Each strategy ingests the whole stream, then answers one query; the query is timed separately
+    struct streaming_strategy_entry {
+        string strategy_identifier;
+        function<void()> ingest_stream;
+        function<bool()> answer_query;
+    };
+    vector<int32_t> working_dataset(streamed_dataset.size());
+    unique_ptr<streaming_sort_engine<int32_t>> stream_engine;
+    vector<int32_t> query_answer;
+    int32_t rank_answer = 0;
+
+    const streaming_strategy_entry streaming_strategies[] = {
+        {"Full sort + truncate (top-k)",
+         [&] { copy(streamed_dataset.begin(), streamed_dataset.end(), working_dataset.begin()); },
+         [&] {
+             execute_introsort_algorithm(span<int32_t>(working_dataset));
+             query_answer.assign(working_dataset.begin(), working_dataset.begin() + STREAMING_QUERY_K);
+             return query_answer == reference_smallest;
+         }},
+        {"LSM runs + partial sort (top-k)",
+         [&] { stream_engine = make_unique<streaming_sort_engine<int32_t>>(); stream_into(*stream_engine); },
+         [&] {
+             query_answer = stream_engine->smallest_elements(STREAMING_QUERY_K);
+             return query_answer == reference_smallest;
+         }},
+        {"Online heap (top-k)",
+         [&] {
+             stream_engine = make_unique<streaming_sort_engine<int32_t>>(STREAMING_QUERY_K, false);
+             stream_into(*stream_engine);
+         },
+         [&] {
+             query_answer = stream_engine->tracked_smallest();
+             return query_answer == reference_smallest;
+         }},
+        {"Full sort + index (median)",
+         [&] { copy(streamed_dataset.begin(), streamed_dataset.end(), working_dataset.begin()); },
+         [&] {
+             execute_introsort_algorithm(span<int32_t>(working_dataset));
+             rank_answer = working_dataset[median_rank];
+             return rank_answer == reference_median;
+         }},
+        {"LSM runs + rank select (median)",
+         [&] { stream_engine = make_unique<streaming_sort_engine<int32_t>>(); stream_into(*stream_engine); },
+         [&] {
+             rank_answer = stream_engine->element_at_rank(median_rank);
+             return rank_answer == reference_median;
+         }},
+    };
+
+    cout << left << setw(34) << "Strategy" << right << setw(14) << "Ingest" << setw(14) << "Query"
+         << setw(14) << "Total" << setw(12) << "Validated" << endl;
+    for (const auto& strategy_entry : streaming_strategies) {
+        bool answers_correct = true;
+        timing_statistics ingest_timing = collect_timing_samples(
+            [](int) {}, [&](int) { strategy_entry.ingest_stream(); }, [](int) {},
+            streamed_dataset.size(), false);
+        timing_statistics query_timing = collect_timing_samples(
+            [&](int) { strategy_entry.ingest_stream(); },
+            [&](int) { answers_correct = strategy_entry.answer_query() && answers_correct; },
+            [](int) {}, streamed_dataset.size(), false);
+        cout << left << setw(34) << strategy_entry.strategy_identifier << right
+             << setw(14) << format_duration(ingest_timing.median_time)
+             << setw(14) << format_duration(query_timing.median_time)
+             << setw(14) << format_duration(ingest_timing.median_time + query_timing.median_time)
+             << setw(12) << (answers_correct ? "PASSED" : "FAILED") << endl;
+    }
+    cout << "Ingest = time to accept the whole stream; Query = time to answer once it has arrived" << endl;
+}
+
+// Structure: sized_benchmark_record
+// Purpose: Record of RecordBytes total with a 32-bit key; the payload starts with the
+//          record's original index so outputs can be checked for lost or duplicated records
+template <size_t RecordBytes>
+struct sized_benchmark_record {
+    int32_t sort_key;                             // Sort key
+    array<char, RecordBytes - sizeof(int32_t)> payload;  // Original index, then filler
+};
+
+// Function: measure_record_size_row
+// Purpose: Times direct and indirect sorting of one record size
+// Parameters: record_keys - shared int32 keys, strategy_times - receives median ns/element
+//             per strategy, all_validated - cleared when any output is wrong
+template <size_t RecordBytes>
+void measure_record_size_row(const vector<int32_t>& record_keys, vector<double>& strategy_times, bool& all_validated) {
+    using record_type = sized_benchmark_record<RecordBytes>;
+    constexpr auto record_key = &record_type::sort_key;
+
+    vector<record_type> reference_records(record_keys.size());
+    for (size_t record_index = 0; record_index < record_keys.size(); record_index++) {
+        reference_records[record_index].sort_key = record_keys[record_index];
+        reference_records[record_index].payload.fill(static_cast<char>(record_index));
+        uint32_t original_index = static_cast<uint32_t>(record_index);
+        memcpy(reference_records[record_index].payload.data(), &original_index, sizeof(original_index));
+    }
+    vector<record_type> working_records = reference_records;
+
+    const function<void(span<record_type>)> record_strategies[] = {
+        [&](span<record_type> records) { execute_introsort_algorithm(records, ranges::less{}, record_key); },
+        [&](span<record_type> records) { execute_lsd_radix_sort_algorithm(records, record_key); },
+        [&](span<record_type> records) { execute_indirect_argsort_algorithm(records, ranges::less{}, record_key); },
+        [&](span<record_type> records) { execute_indirect_radix_sort_algorithm(records, record_key); },
+    };
+
+    vector<bool> index_seen(working_records.size());
+    for (const auto& record_strategy : record_strategies) {
+        timing_statistics timing = collect_timing_samples(
+            [&](int) { copy(reference_records.begin(), reference_records.end(), working_records.begin()); },
+            [&](int) { record_strategy(span<record_type>(working_records)); },
+            [&](int) {
+                // Keys ordered, and every original index present exactly once
+                bool output_valid = parallel_is_sorted(span<const record_type>(working_records), record_key);
+                fill(index_seen.begin(), index_seen.end(), false);
+                for (const record_type& output_record : working_records) {
+                    uint32_t original_index = 0;
+                    memcpy(&original_index, output_record.payload.data(), sizeof(original_index));
+                    output_valid = output_valid && original_index < index_seen.size() && !index_seen[original_index];
+                    if (original_index < index_seen.size()) {
+                        index_seen[original_index] = true;
+                    }
+                }
+                all_validated = all_validated && output_valid;
+            },
+            working_records.size(), false);
+        strategy_times.push_back(timing.nanoseconds_per_element);
+    }
+}
+
+// Function: run_record_size_benchmark
+// Purpose: Record-size mode - compares moving whole records (introsort, LSD radix)
+//          against indirect sorting (argsort or packed key/index radix, then one
+//          gather) for records from 16 to 256 bytes
+void run_record_size_benchmark() {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "DIRECT VS INDIRECT RECORD SORTING (" << INDIRECT_BENCHMARK_SIZE << " records, 32-bit keys)" << endl;
+    cout << string(80, '=') << endl;
+
+    vector<int32_t> record_keys = generate_distribution_dataset<int32_t>(registered_distributions[0], INDIRECT_BENCHMARK_SIZE);
+    const char* strategy_labels[] = {"Introsort", "LSD Radix", "Argsort+Gather", "Packed+Gather"};
+
+    cout << left << setw(10) << "Bytes";
+    for (const char* strategy_label : strategy_labels) {
+        cout << right << setw(16) << strategy_label;
+    }
+    cout << setw(14) << "Indirect win" << endl;
+    cout << left << setw(10) << "" << right << setw(64) << "(median ns per record)" << endl;
+
+    bool all_validated = true;
+    auto report_row = [&](size_t record_bytes, const vector<double>& strategy_times) {
+        cout << left << setw(10) << record_bytes << right << fixed << setprecision(2);
+        for (double strategy_time : strategy_times) {
+            cout << setw(16) << strategy_time;
+        }
+        double best_direct = min(strategy_times[0], strategy_times[1]);
+        double best_indirect = min(strategy_times[2], strategy_times[3]);
+        cout << setw(13) << best_direct / best_indirect << "x" << endl;
+        cout.flush();
+    };
+    auto measure_and_report = [&]<size_t RecordBytes>() {
+        vector<double> strategy_times;
+        measure_record_size_row<RecordBytes>(record_keys, strategy_times, all_validated);
+        report_row(RecordBytes, strategy_times);
+    };
+    measure_and_report.template operator()<16>();
+    measure_and_report.template operator()<32>();
+    measure_and_report.template operator()<64>();
+    measure_and_report.template operator()<128>();
+    measure_and_report.template operator()<256>();
+
+    cout << "Indirect win = best direct time / best indirect time (above 1.00x the indirect path is faster)" << endl;
+    cout << "Output Validation: " << (all_validated ? "PASSED" : "FAILED") << " (key order and record identity)" << endl;
+}
+
+// Function: display_adaptive_decision_audit
+// Purpose: Summarises the adaptive dispatcher's decisions - totals per strategy and,
+//          for the recent decision window, how often each rule fired and on what inputs
+void display_adaptive_decision_audit() {
+    array<size_t, ADAPTIVE_STRATEGY_COUNT> strategy_totals{};
+    vector<adaptive_decision_record> recent_decisions;
+    adaptive_dispatch_log().snapshot(strategy_totals, recent_decisions);
+    size_t decision_total = accumulate(strategy_totals.begin(), strategy_totals.end(), size_t{0});
+
+    const adaptive_dispatch_thresholds& thresholds = active_adaptive_thresholds();
+    cout << "\n" << string(80, '=') << endl;
+    cout << "ADAPTIVE DISPATCH AUDIT (" << decision_total << " decisions)" << endl;
+    cout << string(80, '=') << endl;
+    cout << "Thresholds: insertion N <= " << thresholds.insertion_maximum_size << ", radix N >= "
+         << thresholds.radix_minimum_size << ", run merge when >= " << fixed << setprecision(0)
+         << thresholds.run_merge_window_ratio * 100 << "% of sample windows are monotone, counting when key span <= "
+         << thresholds.counting_maximum_range_ratio << " x N" << endl;
+    for (size_t strategy_index = 0; strategy_index < ADAPTIVE_STRATEGY_COUNT; strategy_index++) {
+        cout << "- " << left << setw(12) << adaptive_strategy_label(static_cast<adaptive_strategy>(strategy_index)) << right
+             << setw(10) << strategy_totals[strategy_index] << " calls" << endl;
+    }
+
+    // Group the recent window by rule
+    struct rule_summary {
+        const char* decision_reason;
+        adaptive_strategy chosen_strategy;
+        size_t decision_count = 0;
+        size_t smallest_input = numeric_limits<size_t>::max();
+        size_t largest_input = 0;
+        double descent_sum = 0.0;
+        double duplicate_sum = 0.0;
+    };
+    vector<rule_summary> rule_summaries;
+    for (const adaptive_decision_record& decision : recent_decisions) {
+        auto summary_position = find_if(rule_summaries.begin(), rule_summaries.end(), [&](const rule_summary& candidate) {
+            return candidate.decision_reason == decision.decision_reason;
+        });
+        if (summary_position == rule_summaries.end()) {
+            rule_summaries.push_back({decision.decision_reason, decision.chosen_strategy});
+            summary_position = rule_summaries.end() - 1;
+        }
+        summary_position->decision_count++;
+        summary_position->smallest_input = min(summary_position->smallest_input, decision.sampled_input.element_count);
+        summary_position->largest_input = max(summary_position->largest_input, decision.sampled_input.element_count);
+        summary_position->descent_sum += decision.sampled_input.descent_ratio;
+        summary_position->duplicate_sum += decision.sampled_input.duplicate_ratio;
+    }
+
+    cout << "\nRecent decisions by rule (last " << recent_decisions.size() << "):" << endl;
+    cout << left << setw(44) << "Rule" << setw(11) << "Strategy" << right << setw(8) << "Calls" << setw(18) << "N range"
+         << setw(10) << "Descents" << setw(7) << "Dups" << endl;
+    for (const rule_summary& summary : rule_summaries) {
+        string size_range = to_string(summary.smallest_input) + ".." + to_string(summary.largest_input);
+        cout << left << setw(44) << summary.decision_reason << setw(11) << adaptive_strategy_label(summary.chosen_strategy)
+             << right << setw(8) << summary.decision_count << setw(18) << size_range << setw(10) << fixed << setprecision(2)
+             << summary.descent_sum / summary.decision_count << setw(7) << summary.duplicate_sum / summary.decision_count << endl;
+    }
+}
+
+// Function: run_registered_algorithm
+// Purpose: Benchmarks one descriptor for one element type when it applies - engines
+//          that cannot sort the type are compiled out, engines whose applicable
+//          max N is below the configured size are skipped
+// Parameters: input_pool - shared inputs, performance_results - collection receiving the metrics
+template <typename Descriptor, typename Element>
+void run_registered_algorithm(benchmark_input_pool<Element>& input_pool,
+                              vector<algorithm_performance_metrics>& performance_results) {
+    if constexpr (Descriptor::template supports_element<Element>) {
+        if (!active_run_configuration().selects_algorithm(Descriptor::algorithm_name)) {
+            return;  // Filtered out by --algorithms
+        }
+        size_t dataset_size = input_pool.sort_buffer.size();
+        if (dataset_size > Descriptor::applicable_max_size) {
+            cout << "\nSkipping " << Descriptor::algorithm_name << ": " << dataset_size
+                 << " elements exceeds its applicable max N of " << Descriptor::applicable_max_size << endl;
+            return;
+        }
+        performance_results.push_back(measure_algorithm_performance<Descriptor, Element>(input_pool));
+    }
+}
+
+// Function: run_element_type_benchmark_suite
+// Purpose: Instantiates every registered engine for one element type and benchmarks the
+//          selected ones on the suite distribution
+// Parameters: dataset_size - elements per timed run
+// Returns: performance metrics for each applicable engine, in registry order
+template <typename Element, typename... Descriptors>
+vector<algorithm_performance_metrics> run_element_type_benchmark_suite(algorithm_type_list<Descriptors...>, int dataset_size) {
+    // Generate the inputs once, before any engine runs
+    benchmark_input_pool<Element> input_pool =
+        build_input_pool<Element>(dataset_size, INPUT_POOL_VARIANTS, suite_input_distribution());
+    cout << "\nInput pool ready: " << input_pool.distribution_label << ", " << INPUT_POOL_VARIANTS
+         << " variants, " << dataset_size << " elements, seed 0x" << hex << active_run_configuration().dataset_seed << dec << endl;
+    if (input_pool.mapped_variant_count > 0) {
+        cout << "Zero-copy variants: " << input_pool.mapped_variant_count << " of " << INPUT_POOL_VARIANTS
+             << " view the mapped dataset file" << endl;
+    }
+
+    vector<algorithm_performance_metrics> performance_results;
+    (run_registered_algorithm<Descriptors, Element>(input_pool, performance_results), ...);
+    return performance_results;
+}
+
+// Function: profile_single_cell
+// Purpose: Runs one (algorithm, size) cell in isolation for external profilers such
+//          as "perf record" - no other engine, report or validation pass runs inside
+//          the timed loop (the first run is validated once)
+// Parameters: engine_name - registry name of the engine (case-insensitive),
+//             dataset_size - elements per run
+// Returns: true when an engine with that name sorts Element, cell_passed - validation result
+template <typename Element, typename... Descriptors>
+bool profile_single_cell(algorithm_type_list<Descriptors...>, const string& engine_name, int dataset_size, bool& cell_passed) {
+    auto names_match = [&engine_name](const char* algorithm_name) {
+        string registry_name = algorithm_name;
+        return registry_name.size() == engine_name.size() &&
+               equal(registry_name.begin(), registry_name.end(), engine_name.begin(), [](char left_character, char right_character) {
+                   return tolower(static_cast<unsigned char>(left_character)) == tolower(static_cast<unsigned char>(right_character));
+               });
+    };
+    bool engine_found = false;
+    (..., [&] {
+        if constexpr (Descriptors::template supports_element<Element>) {
+            if (engine_found || !names_match(Descriptors::algorithm_name)) {
+                return;
+            }
+            engine_found = true;
+            benchmark_input_pool<Element> input_pool =
+                build_input_pool<Element>(dataset_size, INPUT_POOL_VARIANTS, suite_input_distribution());
+            cout << "Cell: " << Descriptors::algorithm_name << ", " << dataset_size << " " << element_type_label<Element>()
+                 << " elements, " << input_pool.distribution_label << endl;
+#if defined(__unix__) || defined(__APPLE__)
+            cout << "Process id: " << getpid() << " (attach with perf record -p)" << endl;
+#endif
+
+            span<Element> test_dataset;
+            bool first_run_valid = true;
+            timing_statistics timing = collect_timing_samples(
+                [&](int iteration_counter) { test_dataset = input_pool.load_iteration_input(iteration_counter); },
+                [&](int) { Descriptors::sort(test_dataset, benchmark_element_traits<Element>::key_projection); },
+                [&](int iteration_counter) {
+                    if (iteration_counter == 0) {
+                        sort_validation_result validation_result = validate_sorted_permutation(
+                            span<const Element>(test_dataset), benchmark_element_traits<Element>::key_projection,
+                            input_pool.expected_fingerprint(iteration_counter));
+                        first_run_valid = validation_result.keys_sorted && validation_result.permutation_intact;
+                    }
+                },
+                static_cast<size_t>(dataset_size), false);
+            cell_passed = first_run_valid;
+            cout << "Samples: " << timing.sample_count << " timed + " << timing.warmup_count << " warmup" << endl;
+            cout << "Median " << format_duration(timing.median_time) << ", mean " << format_duration(timing.mean_time)
+                 << " +/- " << format_duration(timing.confidence_half_width) << ", " << fixed << setprecision(3)
+                 << timing.nanoseconds_per_element << " ns/element" << endl;
+            cout << "Validation: " << (first_run_valid ? "PASSED" : "FAILED") << endl;
+        }
+    }());
+    return engine_found;
+}
+
+// Structure: distribution_matrix_table
+// Purpose: Median run time of every (algorithm, distribution) cell - NaN where skipped
+struct distribution_matrix_table {
+    string element_label;                      // Element type the matrix was measured for
+    size_t dataset_size = 0;                   // Elements per timed run
+    vector<string> algorithm_identifiers;      // Registry order
+    vector<const input_distribution*> distributions;  // Registry order
+    vector<vector<double>> median_times;       // [algorithm][distribution] in nanoseconds
+    vector<vector<bool>> correctness_flags;    // [algorithm][distribution] validation result
+    vector<algorithm_performance_metrics> cell_metrics;  // Full metrics of every measured cell, for export
+};
+
+// Function: run_distribution_matrix_cell
+// Purpose: Measures one registered engine on one distribution's pool, quietly
+template <typename Descriptor, typename Element>
+void run_distribution_matrix_cell(benchmark_input_pool<Element>& input_pool, size_t algorithm_index,
+                                  size_t distribution_index, distribution_matrix_table& matrix_table) {
+    if (matrix_table.dataset_size > Descriptor::applicable_max_size) {
+        return;
+    }
+
+    measurement_policy matrix_policy;
+    matrix_policy.time_budget_seconds = DISTRIBUTION_MATRIX_TIME_BUDGET_SECONDS;
+    algorithm_performance_metrics metrics =
+        measure_algorithm_performance<Descriptor, Element>(input_pool, false, matrix_policy);
+    matrix_table.median_times[algorithm_index][distribution_index] = metrics.timing.median_time;
+    matrix_table.correctness_flags[algorithm_index][distribution_index] = metrics.correctness_validation;
+    matrix_table.cell_metrics.push_back(move(metrics));
+}
+
+// Function: run_distribution_matrix
+// Purpose: Benchmarks every selected registered engine that supports the element type
+//          against every selected input distribution
+// Parameters: dataset_size - elements per timed run
+// Returns: filled matrix table
+template <typename Element, typename... Descriptors>
+distribution_matrix_table run_distribution_matrix(algorithm_type_list<Descriptors...>, int dataset_size) {
+    const benchmark_run_configuration& run_configuration = active_run_configuration();
+    distribution_matrix_table matrix_table;
+    matrix_table.element_label = element_type_label<Element>();
+    matrix_table.dataset_size = dataset_size;
+    (..., [&] {
+        if constexpr (Descriptors::template supports_element<Element>) {
+            if (run_configuration.selects_algorithm(Descriptors::algorithm_name)) {
+                matrix_table.algorithm_identifiers.push_back(Descriptors::algorithm_name);
+            }
+        }
+    }());
+    for (const input_distribution* distribution : benchmark_distributions()) {
+        if (run_configuration.selects_distribution(distribution->column_label)) {
+            matrix_table.distributions.push_back(distribution);
+        }
+    }
+    matrix_table.median_times.assign(matrix_table.algorithm_identifiers.size(),
+                                     vector<double>(matrix_table.distributions.size(), numeric_limits<double>::quiet_NaN()));
+    matrix_table.correctness_flags.assign(matrix_table.algorithm_identifiers.size(),
+                                          vector<bool>(matrix_table.distributions.size(), true));
+
+    cout << "\nDistribution matrix: " << matrix_table.algorithm_identifiers.size() << " engines x "
+         << matrix_table.distributions.size() << " distributions, " << dataset_size << " "
+         << matrix_table.element_label << " elements" << endl;
+
+    for (size_t distribution_index = 0; distribution_index < matrix_table.distributions.size(); distribution_index++) {
+        const input_distribution& distribution = *matrix_table.distributions[distribution_index];
+        cout << "Measuring distribution: " << distribution.distribution_label << "..." << endl;
+        benchmark_input_pool<Element> input_pool =
+            build_input_pool<Element>(dataset_size, INPUT_POOL_VARIANTS, distribution);
+
+        size_t algorithm_index = 0;
+        (..., [&] {
+            if constexpr (Descriptors::template supports_element<Element>) {
+                if (!run_configuration.selects_algorithm(Descriptors::algorithm_name)) {
+                    return;
+                }
+                run_distribution_matrix_cell<Descriptors, Element>(input_pool, algorithm_index++,
+                                                                   distribution_index, matrix_table);
+            }
+        }());
+    }
+    return matrix_table;
+}
+
+// Function: display_distribution_matrix_report
+// Purpose: Prints median ns/element per algorithm and distribution plus the fastest
+//          engine for each distribution
+void display_distribution_matrix_report(const distribution_matrix_table& matrix_table) {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "DISTRIBUTION MATRIX [" << matrix_table.element_label << " elements, N = " << matrix_table.dataset_size
+         << "] - median ns per element" << endl;
+    cout << string(80, '=') << endl;
+
+    cout << left << setw(26) << "Algorithm" << right;
+    for (const input_distribution* distribution : matrix_table.distributions) {
+        cout << setw(10) << distribution->column_label;
+    }
+    cout << endl;
+
+    bool any_validation_failed = false;
+    for (size_t algorithm_index = 0; algorithm_index < matrix_table.algorithm_identifiers.size(); algorithm_index++) {
+        cout << left << setw(26) << matrix_table.algorithm_identifiers[algorithm_index] << right;
+        for (size_t distribution_index = 0; distribution_index < matrix_table.distributions.size(); distribution_index++) {
+            double median_time = matrix_table.median_times[algorithm_index][distribution_index];
+            bool cell_correct = matrix_table.correctness_flags[algorithm_index][distribution_index];
+            any_validation_failed = any_validation_failed || !cell_correct;
+            if (isnan(median_time)) {
+                cout << setw(10) << "-";
+            } else {
+                ostringstream cell_text;
+                double cost_per_element = median_time / matrix_table.dataset_size;
+                cell_text << fixed << setprecision(cost_per_element < 100.0 ? 2 : 0) << cost_per_element
+                          << (cell_correct ? "" : "!");
+                cout << setw(10) << cell_text.str();
+            }
+        }
+        cout << endl;
+    }
+    if (any_validation_failed) {
+        cout << "! marks cells whose correctness validation FAILED" << endl;
+    }
+
+    // Fastest engine per distribution
+    cout << "\nFastest engine per distribution:" << endl;
+    for (size_t distribution_index = 0; distribution_index < matrix_table.distributions.size(); distribution_index++) {
+        optional<size_t> fastest_index;  // Stays empty when every engine skipped the column
+        double fastest_time = numeric_limits<double>::infinity();
+        for (size_t algorithm_index = 0; algorithm_index < matrix_table.algorithm_identifiers.size(); algorithm_index++) {
+            double median_time = matrix_table.median_times[algorithm_index][distribution_index];
+            if (!isnan(median_time) && median_time < fastest_time) {
+                fastest_time = median_time;
+                fastest_index = algorithm_index;
+            }
+        }
+        cout << "- " << left << setw(24) << matrix_table.distributions[distribution_index]->distribution_label << " " << right;
+        if (fastest_index) {
+            cout << matrix_table.algorithm_identifiers[*fastest_index] << " (" << format_duration(fastest_time) << ")" << endl;
+        } else {
+            cout << "n/a" << endl;
+        }
+    }
+}
+
+/*
+================================================================================
+DIFFERENTIAL FUZZING - Every engine against std::sort on fuzzer-shaped inputs
+================================================================================
+*/
+
+// Constant: FUZZ_HEADER_BYTES
+// Purpose: Leading input bytes that select element type, key width, shape and tiling
+constexpr size_t FUZZ_HEADER_BYTES = 3;
+
+// Constant: FUZZ_ELEMENT_TYPE_COUNT
+// Purpose: Element types a fuzz input can decode to (int32, int64, uint64, float,
+//          double, string, record16)
+constexpr size_t FUZZ_ELEMENT_TYPE_COUNT = 7;
+
+// Constant: FUZZ_QUADRATIC_MAXIMUM_ELEMENTS
+// Purpose: Largest input handed to the quadratic engines, so tiled inputs stay cheap
+constexpr size_t FUZZ_QUADRATIC_MAXIMUM_ELEMENTS = 1 << 12;
+
+// Constant: FUZZ_TILED_MAXIMUM_ELEMENTS
+// Purpose: Longest decoded input - enough to cross PARALLEL_SEQUENTIAL_CUTOFF
+constexpr size_t FUZZ_TILED_MAXIMUM_ELEMENTS = 1 << 17;
+
+// Enumeration: fuzz_input_shape
+// Purpose: Pre-shaping of the decoded keys, so mutations also reach the run
+//          detection of the adaptive and merge engines rather than only random data
+enum class fuzz_input_shape {
+    raw,               // Keys in decoded order
+    ascending,         // Sorted ascending
+    descending,        // Sorted descending
+    sorted_prefix      // First 15/16 sorted, tail left in decoded order
+};
+
+// Structure: fuzz_input_header
+// Purpose: What the leading bytes of a fuzz input select
+//   byte 0     - element type (mod FUZZ_ELEMENT_TYPE_COUNT)
+//   byte 1     - low 6 bits: key bits kept (63 means all 64), high 2 bits: shape
+//   byte 2     - the decoded block is tiled 2^(byte % 8) times
+//   remainder  - keys, one chunk of the key width each (FUZZ_STRING_CHUNK_BYTES for strings)
+struct fuzz_input_header {
+    size_t element_type_index;       // Index of the decoded element type
+    unsigned key_bits;               // Low key bits kept - fewer bits, more duplicates
+    fuzz_input_shape input_shape;    // Pre-shaping of the decoded keys
+    size_t tile_count;               // Copies of the decoded block
+};
+
+// Function: decode_fuzz_header
+// Parameters: input_bytes - fuzz input of at least FUZZ_HEADER_BYTES bytes
+// Returns: decoded header
+fuzz_input_header decode_fuzz_header(span<const uint8_t> input_bytes) {
+    unsigned width_code = input_bytes[1] & 0x3F;
+    return {input_bytes[0] % FUZZ_ELEMENT_TYPE_COUNT, width_code == 0x3F ? 64u : width_code,
+            static_cast<fuzz_input_shape>(input_bytes[1] >> 6), size_t{1} << (input_bytes[2] % 8)};
+}
+
+// Function: decode_fuzz_key
+// Purpose: Turns one input chunk into a key of the element type. Signed keys are
+//          sign-extended from the kept width so narrow widths still produce negative
+//          keys; NaN becomes 0.0 because the comparison engines need a strict weak order.
+// Parameters: key_chunk - chunk bytes, key_bits - kept low bits
+template <typename Element>
+Element decode_fuzz_key(span<const uint8_t> key_chunk, unsigned key_bits) {
+    if constexpr (is_same_v<Element, short_string_record>) {
+        short_string_record string_key{};
+        size_t alphabet_size = key_bits >= 8 ? 256 : size_t{1} << key_bits;
+        string_key.text_length = static_cast<uint8_t>(key_chunk[0] % key_chunk.size());
+        for (size_t byte_index = 0; byte_index < string_key.text_length; byte_index++) {
+            uint8_t text_byte = key_chunk[1 + byte_index];
+            string_key.text_bytes[byte_index] =
+                static_cast<char>(alphabet_size == 256 ? text_byte : 'a' + text_byte % alphabet_size);
+        }
+        return string_key;
+    } else {
+        using key_type = conditional_t<is_same_v<Element, benchmark_record>, int64_t, Element>;
+        unsigned value_bits = min<unsigned>(key_bits, 8 * sizeof(key_type));
+        uint64_t chunk_bits = 0;
+        memcpy(&chunk_bits, key_chunk.data(), key_chunk.size());
+        uint64_t kept_mask = value_bits >= 64 ? ~uint64_t{0} : (uint64_t{1} << value_bits) - 1;
+        uint64_t key_bits_kept = chunk_bits & kept_mask;
+
+        key_type decoded_key{};
+        if constexpr (is_floating_point_v<key_type>) {
+            using bits_type = conditional_t<sizeof(key_type) == 4, uint32_t, uint64_t>;
+            bits_type sign_bit = bits_type{1} << (8 * sizeof(key_type) - 1);
+            decoded_key = bit_cast<key_type>(static_cast<bits_type>(key_bits_kept | (chunk_bits & sign_bit)));
+            if (isnan(decoded_key)) {
+                decoded_key = 0;
+            }
+        } else if constexpr (is_signed_v<key_type>) {
+            bool sign_extend = value_bits > 0 && value_bits < 64 && ((key_bits_kept >> (value_bits - 1)) & 1);
+            decoded_key = static_cast<key_type>(static_cast<int64_t>(sign_extend ? key_bits_kept | ~kept_mask : key_bits_kept));
+        } else {
+            decoded_key = static_cast<key_type>(key_bits_kept);
+        }
+
+        if constexpr (is_same_v<Element, benchmark_record>) {
+            return benchmark_record{decoded_key, 0};
+        } else {
+            return decoded_key;
+        }
+    }
+}
+
+// Function: decode_fuzz_elements
+// Purpose: Decodes, tiles and shapes the element block of a fuzz input. Records are
+//          tagged with their input position last, so stability can be checked.
+// Parameters: element_bytes - input after the header, input_header - decoded header
+// Returns: elements to sort, at most FUZZ_TILED_MAXIMUM_ELEMENTS
+template <typename Element>
+vector<Element> decode_fuzz_elements(span<const uint8_t> element_bytes, const fuzz_input_header& input_header) {
+    constexpr size_t chunk_bytes = is_same_v<Element, short_string_record> ? FUZZ_STRING_CHUNK_BYTES
+                                   : is_same_v<Element, benchmark_record> ? sizeof(int64_t)
+                                   : sizeof(Element);
+    size_t block_count = min(element_bytes.size() / chunk_bytes, FUZZ_MAXIMUM_ELEMENTS);
+
+    vector<Element> fuzz_elements;
+    fuzz_elements.reserve(min(block_count * input_header.tile_count, FUZZ_TILED_MAXIMUM_ELEMENTS));
+    for (size_t block_index = 0; block_index < block_count; block_index++) {
+        fuzz_elements.push_back(decode_fuzz_key<Element>(element_bytes.subspan(block_index * chunk_bytes, chunk_bytes),
+                                                         input_header.key_bits));
+    }
+    for (size_t tile_index = 1; tile_index < input_header.tile_count && !fuzz_elements.empty(); tile_index++) {
+        size_t copied_count = min(block_count, FUZZ_TILED_MAXIMUM_ELEMENTS - fuzz_elements.size());
+        fuzz_elements.insert(fuzz_elements.end(), fuzz_elements.begin(), fuzz_elements.begin() + copied_count);
+    }
+
+    auto less_than = make_element_comparator(ranges::less{}, benchmark_element_traits<Element>::key_projection);
+    switch (input_header.input_shape) {
+        case fuzz_input_shape::raw:
+            break;
+        case fuzz_input_shape::ascending:
+            sort(fuzz_elements.begin(), fuzz_elements.end(), less_than);
+            break;
+        case fuzz_input_shape::descending:
+            sort(fuzz_elements.begin(), fuzz_elements.end(), [&](const Element& left_element, const Element& right_element) {
+                return less_than(right_element, left_element);
+            });
+            break;
+        case fuzz_input_shape::sorted_prefix:
+            sort(fuzz_elements.begin(), fuzz_elements.begin() + fuzz_elements.size() * 15 / 16, less_than);
+            break;
+    }
+
+    if constexpr (is_same_v<Element, benchmark_record>) {
+        for (size_t element_index = 0; element_index < fuzz_elements.size(); element_index++) {
+            fuzz_elements[element_index].payload = static_cast<int64_t>(element_index);
+        }
+    }
+    return fuzz_elements;
+}
+
+// Structure: fuzz_finding
+// Purpose: One failure or performance anomaly an input caused in one engine
+struct fuzz_finding {
+    string algorithm_identifier;   // Engine the input was run through
+    string finding_kind;           // "order", "permutation", "stability", "heap-fallback" or "slowdown"
+    double severity;               // Slowdown ratio, fallback count, 1 for failures
+    bool correctness_failure;      // Wrong output rather than a slow one
+};
+
+// Function: fuzz_reference_nanoseconds
+// Purpose: Expected run time of an engine - the fastest of FUZZ_REFERENCE_REPETITIONS
+//          runs on uniform input at the power of two below the size, scaled linearly.
+//          Measured once per engine, element type and size class; the function-local
+//          cache is per template instantiation.
+// Parameters: element_count - size of the fuzz input
+// Returns: expected nanoseconds
+template <typename Descriptor, typename Element>
+double fuzz_reference_nanoseconds(size_t element_count) {
+    static map<int, double> reference_nanoseconds_by_class;  // bit_width(N) -> ns at 2^(class - 1)
+    int size_class = bit_width(element_count);
+    size_t reference_count = size_t{1} << (size_class - 1);
+
+    auto cached_reference = reference_nanoseconds_by_class.find(size_class);
+    if (cached_reference == reference_nanoseconds_by_class.end()) {
+        vector<Element> reference_input = generate_distribution_dataset<Element>(
+            registered_distributions[0], static_cast<int>(reference_count));
+        vector<Element> reference_output;
+        double fastest_nanoseconds = numeric_limits<double>::infinity();
+        for (int repetition = 0; repetition < FUZZ_REFERENCE_REPETITIONS; repetition++) {
+            reference_output = reference_input;
+            auto start_time = steady_clock::now();
+            Descriptor::sort(span<Element>(reference_output), benchmark_element_traits<Element>::key_projection);
+            fastest_nanoseconds = min(fastest_nanoseconds,
+                                      static_cast<double>(duration_cast<nanoseconds>(steady_clock::now() - start_time).count()));
+        }
+        cached_reference = reference_nanoseconds_by_class.emplace(size_class, fastest_nanoseconds).first;
+    }
+    return cached_reference->second * static_cast<double>(element_count) / static_cast<double>(reference_count);
+}
+
+// Function: fuzz_check_engine
+// Purpose: Runs one engine on a fuzz input and compares it with std::sort: keys must
+//          match up to equivalence, the output must be a permutation of the input, and
+//          stable engines must keep record ties in input order. Also flags heap sort
+//          fallbacks and runs FUZZ_SLOWDOWN_FACTOR times slower than expected, re-timing
+//          suspects so one preempted run is not reported.
+// Parameters: fuzz_input - decoded input, expected_output - std::sort of it,
+//             input_fingerprint - multiset fingerprint of the input, findings - appended to
+template <typename Descriptor, typename Element>
+void fuzz_check_engine(span<const Element> fuzz_input, span<const Element> expected_output,
+                       uint64_t input_fingerprint, vector<fuzz_finding>& findings) {
+    if constexpr (Descriptor::template supports_element<Element>) {
+        size_t maximum_elements = Descriptor::time_complexity == complexity_class::quadratic_time
+                                      ? FUZZ_QUADRATIC_MAXIMUM_ELEMENTS
+                                      : Descriptor::applicable_max_size;
+        if (fuzz_input.size() > maximum_elements) {
+            return;
+        }
+
+        constexpr auto key_projection = benchmark_element_traits<Element>::key_projection;
+        vector<Element> engine_output(fuzz_input.size());
+        auto time_engine_run = [&] {
+            copy(fuzz_input.begin(), fuzz_input.end(), engine_output.begin());
+            auto start_time = steady_clock::now();
+            Descriptor::sort(span<Element>(engine_output), key_projection);
+            return static_cast<double>(duration_cast<nanoseconds>(steady_clock::now() - start_time).count());
+        };
+
+        size_t fallbacks_before = introsort_heap_fallback_counter().load(memory_order_relaxed);
+        double elapsed_nanoseconds = time_engine_run();
+        size_t heap_fallbacks = introsort_heap_fallback_counter().load(memory_order_relaxed) - fallbacks_before;
+        const string algorithm_identifier = Descriptor::algorithm_name;
+
+        // Correctness against the reference
+        auto less_than = make_element_comparator(ranges::less{}, key_projection);
+        auto keys_equivalent = [&](const Element& engine_element, const Element& expected_element) {
+            return !less_than(engine_element, expected_element) && !less_than(expected_element, engine_element);
+        };
+        if (!equal(engine_output.begin(), engine_output.end(), expected_output.begin(), expected_output.end(), keys_equivalent)) {
+            findings.push_back({algorithm_identifier, "order", 1.0, true});
+        }
+        if (compute_multiset_fingerprint(span<const Element>(engine_output)) != input_fingerprint) {
+            findings.push_back({algorithm_identifier, "permutation", 1.0, true});
+        }
+        if constexpr (is_same_v<Element, benchmark_record>) {
+            if (Descriptor::is_stable && !validate_stable_tie_order(engine_output)) {
+                findings.push_back({algorithm_identifier, "stability", 1.0, true});
+            }
+        }
+
+        // Performance anomalies
+        if (heap_fallbacks > 0) {
+            findings.push_back({algorithm_identifier, "heap-fallback", static_cast<double>(heap_fallbacks), false});
+        }
+        double expected_nanoseconds = fuzz_reference_nanoseconds<Descriptor, Element>(fuzz_input.size());
+        auto exceeds_expectation = [&] {
+            return elapsed_nanoseconds > FUZZ_MINIMUM_ANOMALY_NANOSECONDS &&
+                   elapsed_nanoseconds > FUZZ_SLOWDOWN_FACTOR * expected_nanoseconds;
+        };
+        for (int retry = 1; retry < FUZZ_REFERENCE_REPETITIONS && exceeds_expectation(); retry++) {
+            elapsed_nanoseconds = min(elapsed_nanoseconds, time_engine_run());
+        }
+        if (exceeds_expectation()) {
+            findings.push_back({algorithm_identifier, "slowdown", elapsed_nanoseconds / expected_nanoseconds, false});
+        }
+    }
+}
+
+// Function: fuzz_registered_engines
+// Purpose: Differential run of every registered engine on one decoded input
+// Parameters: fuzz_input - decoded input
+// Returns: findings of all engines, empty when every engine agreed with std::sort
+template <typename Element, typename... Descriptors>
+vector<fuzz_finding> fuzz_registered_engines(const vector<Element>& fuzz_input, algorithm_type_list<Descriptors...>) {
+    vector<fuzz_finding> findings;
+    if (fuzz_input.empty()) {
+        return findings;
+    }
+    vector<Element> expected_output = fuzz_input;
+    sort(expected_output.begin(), expected_output.end(),
+         make_element_comparator(ranges::less{}, benchmark_element_traits<Element>::key_projection));
+    uint64_t input_fingerprint = compute_multiset_fingerprint(span<const Element>(fuzz_input));
+
+    (..., fuzz_check_engine<Descriptors>(span<const Element>(fuzz_input), span<const Element>(expected_output),
+                                         input_fingerprint, findings));
+    return findings;
+}
+
+// Function: run_fuzz_input
+// Purpose: Decodes one fuzz input and runs every engine on it
+// Parameters: input_bytes - raw fuzz input (shorter than the header decodes to nothing)
+// Returns: findings, empty when every engine agreed with std::sort
+vector<fuzz_finding> run_fuzz_input(span<const uint8_t> input_bytes) {
+    if (input_bytes.size() < FUZZ_HEADER_BYTES) {
+        return {};
+    }
+    fuzz_input_header input_header = decode_fuzz_header(input_bytes);
+    span<const uint8_t> element_bytes = input_bytes.subspan(FUZZ_HEADER_BYTES);
+    auto fuzz_element_type = [&]<typename Element>(type_identity<Element>) {
+        return fuzz_registered_engines(decode_fuzz_elements<Element>(element_bytes, input_header), registered_algorithms{});
+    };
+    switch (input_header.element_type_index) {
+        case 0: return fuzz_element_type(type_identity<int32_t>{});
+        case 1: return fuzz_element_type(type_identity<int64_t>{});
+        case 2: return fuzz_element_type(type_identity<uint64_t>{});
+        case 3: return fuzz_element_type(type_identity<float>{});
+        case 4: return fuzz_element_type(type_identity<double>{});
+        case 5: return fuzz_element_type(type_identity<short_string_record>{});
+        default: return fuzz_element_type(type_identity<benchmark_record>{});
+    }
+}
+
+// Class: fuzz_worst_case_corpus
+// Purpose: Directory holding, per engine and finding kind, the most severe input seen
+//          so far ("<engine>-<kind>.bin"). Correctness failures are all kept, each
+//          under its own input hash. Files are plain fuzz inputs, so the directory can
+//          also be handed to libFuzzer as a seed corpus.
+class fuzz_worst_case_corpus {
+public:
+    explicit fuzz_worst_case_corpus(string directory_path) : corpus_directory(move(directory_path)) {
+        error_code directory_error;
+        filesystem::create_directories(corpus_directory, directory_error);
+        if (directory_error) {
+            cerr << "Cannot create fuzz corpus directory " << corpus_directory << ": " << directory_error.message() << endl;
+            saving_enabled = false;
+        }
+    }
+
+    // Function: load_inputs
+    // Returns: every input stored in the directory, in file name order
+    vector<vector<uint8_t>> load_inputs() const {
+        vector<filesystem::path> input_paths;
+        error_code listing_error;
+        for (const auto& directory_entry : filesystem::directory_iterator(corpus_directory, listing_error)) {
+            if (directory_entry.is_regular_file()) {
+                input_paths.push_back(directory_entry.path());
+            }
+        }
+        sort(input_paths.begin(), input_paths.end());
+
+        vector<vector<uint8_t>> stored_inputs;
+        for (const filesystem::path& input_path : input_paths) {
+            ifstream input_file(input_path, ios::binary);
+            stored_inputs.emplace_back(istreambuf_iterator<char>(input_file), istreambuf_iterator<char>());
+        }
+        return stored_inputs;
+    }
+
+    // Function: record
+    // Purpose: Stores the input when the finding is a failure or beats the worst case
+    //          of its engine and kind
+    // Returns: path written, empty when the input was not kept
+    string record(const fuzz_finding& finding, span<const uint8_t> input_bytes) {
+        string case_name = file_name_component(finding.algorithm_identifier) + "-" + finding.finding_kind;
+        if (finding.correctness_failure) {
+            uint64_t input_hash = 0;
+            for (uint8_t input_byte : input_bytes) {
+                input_hash = mix_fingerprint_bits(input_hash ^ input_byte);
+            }
+            stringstream hash_stream;
+            hash_stream << hex << setw(16) << setfill('0') << input_hash;
+            case_name += "-" + hash_stream.str();
+        } else {
+            auto [worst_case, inserted] = worst_severities.try_emplace(case_name, finding.severity);
+            if (!inserted && finding.severity <= worst_case->second) {
+                return {};
+            }
+            worst_case->second = finding.severity;
+        }
+        if (!saving_enabled) {
+            return {};
+        }
+
+        string input_path = (filesystem::path(corpus_directory) / (case_name + ".bin")).string();
+        ofstream input_file(input_path, ios::binary | ios::trunc);
+        input_file.write(reinterpret_cast<const char*>(input_bytes.data()), static_cast<streamsize>(input_bytes.size()));
+        if (!input_file) {
+            cerr << "Cannot write fuzz corpus entry " << input_path << endl;
+            return {};
+        }
+        return input_path;
+    }
+
+    // Function: worst_cases
+    // Returns: highest severity per "<engine>-<kind>" anomaly
+    const map<string, double>& worst_cases() const { return worst_severities; }
+
+private:
+    // Function: file_name_component
+    // Purpose: Lower-case engine name with everything but letters and digits as '_'
+    static string file_name_component(const string& algorithm_identifier) {
+        string name_component;
+        for (char name_character : algorithm_identifier) {
+            name_component += isalnum(static_cast<unsigned char>(name_character))
+                                  ? static_cast<char>(tolower(static_cast<unsigned char>(name_character)))
+                                  : '_';
+        }
+        return name_component;
+    }
+
+    string corpus_directory;
+    bool saving_enabled = true;
+    map<string, double> worst_severities;
+};
+
+// Structure: fuzz_campaign_configuration
+// Purpose: Parameters of "fuzz" mode
+struct fuzz_campaign_configuration {
+    int iterations = FUZZ_DEFAULT_ITERATIONS;                    // Generated inputs tried
+    string corpus_directory = FUZZ_DEFAULT_CORPUS_DIRECTORY;     // Worst-case corpus location
+    size_t maximum_input_bytes = FUZZ_MAXIMUM_INPUT_BYTES;       // Longest generated input
+};
+
+// Function: encode_distribution_seed
+// Purpose: Fuzz input whose int32 keys follow a registered distribution, so the
+//          campaign starts from the shapes the benchmarks already know to be hard
+// Parameters: distribution - key generator, element_count - keys encoded
+// Returns: encoded input (full 32-bit keys, raw shape, no tiling)
+vector<uint8_t> encode_distribution_seed(const input_distribution& distribution, size_t element_count) {
+    vector<int32_t> seed_keys = generate_distribution_dataset<int32_t>(distribution, static_cast<int>(element_count));
+    vector<uint8_t> seed_input = {0, 32, 0};
+    seed_input.resize(FUZZ_HEADER_BYTES + seed_keys.size() * sizeof(int32_t));
+    memcpy(seed_input.data() + FUZZ_HEADER_BYTES, seed_keys.data(), seed_keys.size() * sizeof(int32_t));
+    return seed_input;
+}
+
+// Function: mutate_fuzz_input
+// Purpose: Applies 1..FUZZ_MAXIMUM_MUTATIONS random edits - bit flips, byte and header
+//          rewrites, block copies (runs and duplicates), truncation and extension
+// Parameters: fuzz_input - edited in place, generator_engine - randomness,
+//             maximum_input_bytes - length cap
+void mutate_fuzz_input(vector<uint8_t>& fuzz_input, mt19937_64& generator_engine, size_t maximum_input_bytes) {
+    auto random_below = [&](size_t upper_bound) {
+        return uniform_int_distribution<size_t>(0, upper_bound - 1)(generator_engine);
+    };
+    fuzz_input.resize(clamp(fuzz_input.size(), FUZZ_HEADER_BYTES, maximum_input_bytes));
+
+    int mutation_count = 1 + static_cast<int>(random_below(FUZZ_MAXIMUM_MUTATIONS));
+    for (int mutation_index = 0; mutation_index < mutation_count; mutation_index++) {
+        switch (random_below(6)) {
+            case 0:
+                fuzz_input[random_below(fuzz_input.size())] ^= static_cast<uint8_t>(1u << random_below(8));
+                break;
+            case 1:
+                fuzz_input[random_below(fuzz_input.size())] = static_cast<uint8_t>(generator_engine());
+                break;
+            case 2:
+                fuzz_input[random_below(FUZZ_HEADER_BYTES)] = static_cast<uint8_t>(generator_engine());
+                break;
+            case 3: {
+                size_t source_offset = random_below(fuzz_input.size());
+                size_t target_offset = random_below(fuzz_input.size());
+                size_t block_length = random_below(fuzz_input.size() - max(source_offset, target_offset)) + 1;
+                memmove(fuzz_input.data() + target_offset, fuzz_input.data() + source_offset, block_length);
+                break;
+            }
+            case 4:
+                fuzz_input.resize(FUZZ_HEADER_BYTES + random_below(fuzz_input.size() - FUZZ_HEADER_BYTES + 1));
+                break;
+            default: {
+                size_t appended_bytes = random_below(min<size_t>(4096, maximum_input_bytes - fuzz_input.size() + 1));
+                for (size_t byte_index = 0; byte_index < appended_bytes; byte_index++) {
+                    fuzz_input.push_back(static_cast<uint8_t>(generator_engine()));
+                }
+                break;
+            }
+        }
+    }
+    fuzz_input.resize(min(fuzz_input.size(), maximum_input_bytes));
+}
+
+// Function: run_fuzz_campaign
+// Purpose: Replays the worst-case corpus, then fuzzes every engine with distribution
+//          seeds, fresh random inputs and mutations of earlier inputs. Inputs that set
+//          a new worst case join the mutation pool, so the campaign climbs towards
+//          harder inputs. Reports failures and the worst anomaly per engine.
+// Parameters: campaign_configuration - iterations, corpus directory and input cap
+// Returns: false when any engine produced wrong output
+bool run_fuzz_campaign(const fuzz_campaign_configuration& campaign_configuration) {
+    cout << string(80, '=') << endl;
+    cout << "DIFFERENTIAL FUZZING - every engine against std::sort" << endl;
+    cout << string(80, '=') << endl;
+
+    fuzz_worst_case_corpus worst_case_corpus(campaign_configuration.corpus_directory);
+    vector<vector<uint8_t>> mutation_pool = worst_case_corpus.load_inputs();
+    size_t replayed_inputs = mutation_pool.size();
+    for (const input_distribution& distribution : registered_distributions) {
+        mutation_pool.push_back(encode_distribution_seed(distribution, FUZZ_SEED_ELEMENTS));
+    }
+    size_t seeded_inputs = mutation_pool.size();
+    cout << "Corpus: " << campaign_configuration.corpus_directory << " (" << replayed_inputs << " stored inputs), "
+         << (seeded_inputs - replayed_inputs) << " distribution seeds, " << campaign_configuration.iterations
+         << " generated inputs" << endl;
+
+    mt19937_64 generator_engine(active_run_configuration().dataset_seed);
+    vector<fuzz_finding> correctness_failures;
+    vector<string> failure_paths;
+    size_t anomaly_count = 0;
+
+    int total_inputs = static_cast<int>(seeded_inputs) + campaign_configuration.iterations;
+    active_progress_reporter().begin_phase(total_inputs);
+    for (int input_index = 0; input_index < total_inputs; input_index++) {
+        // Stored and seed inputs first, then fresh (1 in 4) or mutated inputs
+        vector<uint8_t> fuzz_input;
+        if (static_cast<size_t>(input_index) < seeded_inputs) {
+            fuzz_input = mutation_pool[input_index];
+        } else if (generator_engine() % 4 == 0) {
+            int length_exponent = uniform_int_distribution<int>(2, bit_width(campaign_configuration.maximum_input_bytes) - 1)(generator_engine);
+            fuzz_input.resize(max(FUZZ_HEADER_BYTES, size_t{1} << length_exponent));
+            for (uint8_t& input_byte : fuzz_input) {
+                input_byte = static_cast<uint8_t>(generator_engine());
+            }
+            fuzz_input.resize(min(fuzz_input.size(), campaign_configuration.maximum_input_bytes));
+        } else {
+            fuzz_input = mutation_pool[uniform_int_distribution<size_t>(0, mutation_pool.size() - 1)(generator_engine)];
+            mutate_fuzz_input(fuzz_input, generator_engine, campaign_configuration.maximum_input_bytes);
+        }
+
+        auto start_time = steady_clock::now();
+        bool new_worst_case = false;
+        for (const fuzz_finding& finding : run_fuzz_input(fuzz_input)) {
+            string input_path = worst_case_corpus.record(finding, fuzz_input);
+            if (finding.correctness_failure) {
+                correctness_failures.push_back(finding);
+                failure_paths.push_back(input_path);
+            } else {
+                anomaly_count++;
+                new_worst_case = new_worst_case || !input_path.empty();
+            }
+        }
+        if (new_worst_case && static_cast<size_t>(input_index) >= seeded_inputs) {
+            mutation_pool.push_back(fuzz_input);
+        }
+        active_progress_reporter().report_iteration(
+            input_index + 1, total_inputs, static_cast<double>(duration_cast<nanoseconds>(steady_clock::now() - start_time).count()));
+    }
+    active_progress_reporter().finish_phase();
+
+    cout << "\nInputs run: " << total_inputs << ", anomalies: " << anomaly_count
+         << ", correctness failures: " << correctness_failures.size() << endl;
+
+    if (!worst_case_corpus.worst_cases().empty()) {
+        cout << "\nWorst anomaly per engine (heap-fallback: fallbacks, slowdown: x expected):" << endl;
+        for (const auto& [case_name, worst_severity] : worst_case_corpus.worst_cases()) {
+            cout << "- " << left << setw(48) << case_name << right << fixed << setprecision(1) << worst_severity << endl;
+        }
+    }
+    for (size_t failure_index = 0; failure_index < correctness_failures.size(); failure_index++) {
+        const fuzz_finding& finding = correctness_failures[failure_index];
+        cout << "✗ " << finding.algorithm_identifier << ": " << finding.finding_kind << " mismatch"
+             << (failure_paths[failure_index].empty() ? string() : " (" + failure_paths[failure_index] + ")") << endl;
+    }
+    if (correctness_failures.empty()) {
+        cout << "✓ Every engine matched std::sort on every input" << endl;
+    }
+    return correctness_failures.empty();
+}
+
+#ifdef SORTER_FUZZ_TARGET
+// Function: LLVMFuzzerTestOneInput
+// Purpose: libFuzzer entry point (build with -DSORTER_FUZZ_TARGET -fsanitize=fuzzer,address).
+//          Wrong output aborts so libFuzzer keeps the crashing input; anomalies update
+//          the worst-case corpus in $SORTER_FUZZ_CORPUS (FUZZ_DEFAULT_CORPUS_DIRECTORY
+//          when unset).
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* input_data, size_t input_size) {
+    static fuzz_worst_case_corpus worst_case_corpus(
+        getenv("SORTER_FUZZ_CORPUS") != nullptr ? getenv("SORTER_FUZZ_CORPUS") : FUZZ_DEFAULT_CORPUS_DIRECTORY);
+    span<const uint8_t> input_bytes(input_data, input_size);
+    for (const fuzz_finding& finding : run_fuzz_input(input_bytes)) {
+        worst_case_corpus.record(finding, input_bytes);
+        if (finding.correctness_failure) {
+            cerr << finding.algorithm_identifier << ": " << finding.finding_kind << " mismatch against std::sort" << endl;
+            abort();
+        }
+    }
+    return 0;
+}
+#endif
+
+/*
+================================================================================
+RESULT EXPORT - JSON/CSV emitters, baseline loading and regression gating
+================================================================================
+*/
+
+// Structure: host_environment_info
+// Purpose: Where and how a result set was produced - recorded with every export so
+//          a baseline is never compared against a different machine unknowingly
+struct host_environment_info {
+    string host_name = "unknown";         // Network name of the machine
+    string operating_system = "unknown";  // Kernel name and release
+    string cpu_model = "unknown";         // First "model name" of /proc/cpuinfo
+    unsigned hardware_threads = 0;        // thread::hardware_concurrency()
+    string compiler_version;              // __VERSION__ of the compiler that built the analyzer
+    string build_flags;                   // SORTER_BUILD_FLAGS passed by the build
+    string simd_kernels;                  // Kernel table selected at startup
+    string timestamp;                     // UTC time the export was assembled
+};
+
+// Function: collect_host_environment_info
+// Purpose: Gathers host, kernel, CPU and toolchain details - every probe is
+//          best-effort and leaves "unknown" when it fails
+host_environment_info collect_host_environment_info() {
+    host_environment_info host_info;
+#if defined(__unix__) || defined(__APPLE__)
+    char host_name[256] = {};
+    if (gethostname(host_name, sizeof(host_name) - 1) == 0) {
+        host_info.host_name = host_name;
+    }
+    struct utsname kernel_identity;
+    if (uname(&kernel_identity) == 0) {
+        host_info.operating_system = string(kernel_identity.sysname) + " " + kernel_identity.release;
+    }
+#endif
+    ifstream cpu_information("/proc/cpuinfo");
+    string cpu_line;
+    while (getline(cpu_information, cpu_line)) {
+        if (cpu_line.rfind("model name", 0) == 0) {
+            size_t separator_position = cpu_line.find(':');
+            if (separator_position != string::npos) {
+                host_info.cpu_model = cpu_line.substr(cpu_line.find_first_not_of(' ', separator_position + 1));
+            }
+            break;
+        }
+    }
+    host_info.hardware_threads = thread::hardware_concurrency();
+#if defined(__VERSION__)
+    host_info.compiler_version = __VERSION__;
+#else
+    host_info.compiler_version = "unknown";
+#endif
+    host_info.build_flags = SORTER_BUILD_FLAGS;
+    host_info.simd_kernels = active_simd_kernels().kernel_label;
+
+    time_t current_time = time(nullptr);
+    char timestamp_text[32] = {};
+    strftime(timestamp_text, sizeof(timestamp_text), "%Y-%m-%dT%H:%M:%SZ", gmtime(&current_time));
+    host_info.timestamp = timestamp_text;
+    return host_info;
+}
+
+// Structure: exported_benchmark_result
+// Purpose: One measured cell tagged with the report section that produced it
+//          ("suite" for the per-type reports, "matrix" for the distribution matrix)
+struct exported_benchmark_result {
+    string benchmark_section;
+    algorithm_performance_metrics metrics;
+};
+
+// Structure: benchmark_result_export
+// Purpose: Everything a run writes to JSON/CSV and a baseline comparison reads back
+struct benchmark_result_export {
+    host_environment_info host_info;
+    vector<exported_benchmark_result> results;
+
+    // Function: append_section
+    // Purpose: Tags and appends every metric of one report section
+    void append_section(const string& benchmark_section, const vector<algorithm_performance_metrics>& section_metrics) {
+        for (const algorithm_performance_metrics& metrics : section_metrics) {
+            results.push_back({benchmark_section, metrics});
+        }
+    }
+};
+
+// Function: result_cell_key
+// Purpose: Identity of a measured cell when matching a baseline against a candidate
+string result_cell_key(const exported_benchmark_result& result) {
+    return result.benchmark_section + " | " + result.metrics.element_label + " | " + result.metrics.distribution_label +
+           " | N=" + to_string(result.metrics.dataset_size) + " | " + result.metrics.algorithm_identifier;
+}
+
+// Constant: exported_counter_keys
+// Purpose: Field names of the hardware counters, indexed by hardware_counter_kind
+constexpr array<const char*, HARDWARE_COUNTER_KIND_COUNT> exported_counter_keys = {
+    "cycles", "instructions", "branch_misses", "l1d_read_misses", "llc_read_misses", "dtlb_read_misses"};
+
+// Function: json_quoted
+// Purpose: Renders a string as a JSON string literal
+string json_quoted(const string& raw_text) {
+    ostringstream quoted_text;
+    quoted_text << '"';
+    for (unsigned char text_character : raw_text) {
+        switch (text_character) {
+            case '"':  quoted_text << "\\\""; break;
+            case '\\': quoted_text << "\\\\"; break;
+            case '\n': quoted_text << "\\n"; break;
+            case '\r': quoted_text << "\\r"; break;
+            case '\t': quoted_text << "\\t"; break;
+            default:
+                if (text_character < 0x20) {
+                    quoted_text << "\\u" << hex << setw(4) << setfill('0') << static_cast<int>(text_character)
+                                << dec << setfill(' ');
+                } else {
+                    quoted_text << text_character;
+                }
+        }
+    }
+    quoted_text << '"';
+    return quoted_text.str();
+}
+
+// Function: json_number
+// Purpose: Renders a double with 15 significant digits, null when it is not finite
+string json_number(double numeric_value) {
+    if (!isfinite(numeric_value)) {
+        return "null";
+    }
+    ostringstream number_text;
+    number_text << setprecision(15) << numeric_value;
+    return number_text.str();
+}
+
+// Function: csv_field
+// Purpose: Quotes a CSV field when it contains a separator, quote or line break
+string csv_field(const string& raw_text) {
+    if (raw_text.find_first_of(",\"\n\r") == string::npos) {
+        return raw_text;
+    }
+    string quoted_text = "\"";
+    for (char text_character : raw_text) {
+        quoted_text += text_character == '"' ? string("\"\"") : string(1, text_character);
+    }
+    return quoted_text + "\"";
+}
+
+// Function: write_results_json
+// Purpose: Writes host information and every cell's statistics and counters as JSON
+// Parameters: output_path - file to create, result_export - results to write
+// Returns: false (with a message on cerr) when the file cannot be written
+bool write_results_json(const string& output_path, const benchmark_result_export& result_export) {
+    ofstream json_file(output_path);
+    const host_environment_info& host_info = result_export.host_info;
+    json_file << "{\n  \"format_version\": " << RESULT_EXPORT_FORMAT_VERSION << ",\n  \"host\": {\n"
+              << "    \"host_name\": " << json_quoted(host_info.host_name) << ",\n"
+              << "    \"operating_system\": " << json_quoted(host_info.operating_system) << ",\n"
+              << "    \"cpu_model\": " << json_quoted(host_info.cpu_model) << ",\n"
+              << "    \"hardware_threads\": " << host_info.hardware_threads << ",\n"
+              << "    \"compiler_version\": " << json_quoted(host_info.compiler_version) << ",\n"
+              << "    \"build_flags\": " << json_quoted(host_info.build_flags) << ",\n"
+              << "    \"simd_kernels\": " << json_quoted(host_info.simd_kernels) << ",\n"
+              << "    \"timestamp\": " << json_quoted(host_info.timestamp) << ",\n"
+              << "    \"dataset_seed\": " << active_run_configuration().dataset_seed << "\n  },\n  \"results\": [";
+    for (size_t result_index = 0; result_index < result_export.results.size(); result_index++) {
+        const exported_benchmark_result& result = result_export.results[result_index];
+        const algorithm_performance_metrics& metrics = result.metrics;
+        const timing_statistics& timing = metrics.timing;
+        json_file << (result_index == 0 ? "\n" : ",\n") << "    {"
+                  << "\"section\": " << json_quoted(result.benchmark_section)
+                  << ", \"algorithm\": " << json_quoted(metrics.algorithm_identifier)
+                  << ", \"element\": " << json_quoted(metrics.element_label)
+                  << ", \"distribution\": " << json_quoted(metrics.distribution_label)
+                  << ", \"size\": " << metrics.dataset_size
+                  << ", \"complexity\": " << json_quoted(metrics.complexity_label)
+                  << ", \"stable\": " << (metrics.declared_stable ? "true" : "false")
+                  << ", \"stability\": " << json_quoted(stability_verdict_label(metrics.observed_stability))
+                  << ", \"correct\": " << (metrics.correctness_validation ? "true" : "false")
+                  << ", \"order_ok\": " << (metrics.order_validation ? "true" : "false")
+                  << ", \"permutation_ok\": " << (metrics.permutation_validation ? "true" : "false")
+                  << ", \"samples\": " << timing.sample_count
+                  << ", \"warmup\": " << timing.warmup_count
+                  << ", \"confidence_reached\": " << (timing.confidence_reached ? "true" : "false")
+                  << ", \"mean_ns\": " << json_number(timing.mean_time)
+                  << ", \"median_ns\": " << json_number(timing.median_time)
+                  << ", \"p90_ns\": " << json_number(timing.p90_time)
+                  << ", \"p99_ns\": " << json_number(timing.p99_time)
+                  << ", \"min_ns\": " << json_number(timing.minimum_time)
+                  << ", \"max_ns\": " << json_number(timing.maximum_time)
+                  << ", \"stddev_ns\": " << json_number(timing.standard_deviation)
+                  << ", \"mad_ns\": " << json_number(timing.median_absolute_deviation)
+                  << ", \"ci_half_width_ns\": " << json_number(timing.confidence_half_width)
+                  << ", \"ns_per_element\": " << json_number(timing.nanoseconds_per_element)
+                  << ", \"gb_per_second\": " << json_number(metrics.effective_gigabytes_per_second)
+                  << ", \"outliers\": " << timing.outlier_count
+                  << ", \"validation_median_ns\": " << json_number(metrics.validation_median_time)
+                  << ", \"counters\": {";
+        for (size_t counter_index = 0; counter_index < HARDWARE_COUNTER_KIND_COUNT; counter_index++) {
+            json_file << (counter_index == 0 ? "" : ", ") << json_quoted(exported_counter_keys[counter_index]) << ": "
+                      << json_number(metrics.hardware_counters.value_of(static_cast<hardware_counter_kind>(counter_index)));
+        }
+        json_file << "}, \"peak_rss_mb\": " << json_number(metrics.memory_footprint.peak_resident_megabytes)
+                  << ", \"peak_rss_scoped\": " << (metrics.memory_footprint.peak_scoped ? "true" : "false")
+                  << ", \"minor_faults_per_run\": " << json_number(metrics.memory_footprint.minor_faults_per_run)
+                  << ", \"major_faults_per_run\": " << json_number(metrics.memory_footprint.major_faults_per_run) << "}";
+    }
+    json_file << "\n  ]\n}\n";
+    if (!json_file) {
+        cerr << "Cannot write " << output_path << endl;
+        return false;
+    }
+    return true;
+}
+
+// Function: write_results_csv
+// Purpose: Writes one row per cell; host information leads as "# name=value" comments
+// Parameters: output_path - file to create, result_export - results to write
+// Returns: false (with a message on cerr) when the file cannot be written
+bool write_results_csv(const string& output_path, const benchmark_result_export& result_export) {
+    ofstream csv_file(output_path);
+    const host_environment_info& host_info = result_export.host_info;
+    csv_file << "# format_version=" << RESULT_EXPORT_FORMAT_VERSION << "\n"
+             << "# host_name=" << host_info.host_name << "\n"
+             << "# operating_system=" << host_info.operating_system << "\n"
+             << "# cpu_model=" << host_info.cpu_model << "\n"
+             << "# hardware_threads=" << host_info.hardware_threads << "\n"
+             << "# compiler_version=" << host_info.compiler_version << "\n"
+             << "# build_flags=" << host_info.build_flags << "\n"
+             << "# simd_kernels=" << host_info.simd_kernels << "\n"
+             << "# timestamp=" << host_info.timestamp << "\n"
+             << "# dataset_seed=" << active_run_configuration().dataset_seed << "\n";
+    csv_file << "section,algorithm,element,distribution,size,complexity,stable,stability,correct,order_ok,permutation_ok,"
+             << "samples,warmup,confidence_reached,mean_ns,median_ns,p90_ns,p99_ns,min_ns,max_ns,stddev_ns,mad_ns,"
+             << "ci_half_width_ns,ns_per_element,gb_per_second,outliers,validation_median_ns";
+    for (const char* counter_key : exported_counter_keys) {
+        csv_file << "," << counter_key;
+    }
+    csv_file << ",peak_rss_mb,peak_rss_scoped,minor_faults_per_run,major_faults_per_run\n";
+
+    auto csv_number = [](double numeric_value) {
+        return isfinite(numeric_value) ? json_number(numeric_value) : string();  // Empty cell when unavailable
+    };
+    for (const exported_benchmark_result& result : result_export.results) {
+        const algorithm_performance_metrics& metrics = result.metrics;
+        const timing_statistics& timing = metrics.timing;
+        csv_file << csv_field(result.benchmark_section) << "," << csv_field(metrics.algorithm_identifier) << ","
+                 << csv_field(metrics.element_label) << "," << csv_field(metrics.distribution_label) << ","
+                 << metrics.dataset_size << "," << csv_field(metrics.complexity_label) << ","
+                 << metrics.declared_stable << "," << stability_verdict_label(metrics.observed_stability) << ","
+                 << metrics.correctness_validation << ","
+                 << metrics.order_validation << "," << metrics.permutation_validation << ","
+                 << timing.sample_count << "," << timing.warmup_count << "," << timing.confidence_reached << ","
+                 << csv_number(timing.mean_time) << "," << csv_number(timing.median_time) << ","
+                 << csv_number(timing.p90_time) << "," << csv_number(timing.p99_time) << ","
+                 << csv_number(timing.minimum_time) << "," << csv_number(timing.maximum_time) << ","
+                 << csv_number(timing.standard_deviation) << "," << csv_number(timing.median_absolute_deviation) << ","
+                 << csv_number(timing.confidence_half_width) << "," << csv_number(timing.nanoseconds_per_element) << ","
+                 << csv_number(metrics.effective_gigabytes_per_second) << ","
+                 << timing.outlier_count << "," << csv_number(metrics.validation_median_time);
+        for (size_t counter_index = 0; counter_index < HARDWARE_COUNTER_KIND_COUNT; counter_index++) {
+            csv_file << "," << csv_number(metrics.hardware_counters.value_of(static_cast<hardware_counter_kind>(counter_index)));
+        }
+        csv_file << "," << csv_number(metrics.memory_footprint.peak_resident_megabytes) << ","
+                 << metrics.memory_footprint.peak_scoped << ","
+                 << csv_number(metrics.memory_footprint.minor_faults_per_run) << ","
+                 << csv_number(metrics.memory_footprint.major_faults_per_run) << "\n";
+    }
+    if (!csv_file) {
+        cerr << "Cannot write " << output_path << endl;
+        return false;
+    }
+    return true;
+}
+
+// Structure: json_value
+// Purpose: Parsed JSON tree node - just enough of JSON to read exports back
+struct json_value {
+    enum class value_kind { null_value, boolean_value, number_value, string_value, array_value, object_value };
+    value_kind kind = value_kind::null_value;
+    bool boolean_content = false;
+    double number_content = 0.0;
+    string string_content;
+    vector<json_value> array_elements;  // Array items in order
+    vector<string> member_names;        // Object keys in order
+    vector<json_value> member_values;   // Object values, parallel to member_names
+
+    // Function: member
+    // Returns: value of the named object member, nullptr when absent or not an object
+    const json_value* member(const string& member_name) const {
+        auto name_position = find(member_names.begin(), member_names.end(), member_name);
+        return name_position == member_names.end() ? nullptr : &member_values[name_position - member_names.begin()];
+    }
+
+    // Function: number_or
+    // Returns: the named numeric member, fallback when absent or null
+    double number_or(const string& member_name, double fallback_value) const {
+        const json_value* member_value = member(member_name);
+        return member_value != nullptr && member_value->kind == value_kind::number_value ? member_value->number_content : fallback_value;
+    }
+
+    // Function: string_or
+    // Returns: the named string member, fallback when absent
+    string string_or(const string& member_name, const string& fallback_value) const {
+        const json_value* member_value = member(member_name);
+        return member_value != nullptr && member_value->kind == value_kind::string_value ? member_value->string_content : fallback_value;
+    }
+
+    // Function: boolean_or
+    // Returns: the named boolean member, fallback when absent
+    bool boolean_or(const string& member_name, bool fallback_value) const {
+        const json_value* member_value = member(member_name);
+        return member_value != nullptr && member_value->kind == value_kind::boolean_value ? member_value->boolean_content : fallback_value;
+    }
+};
+
+// Class: json_document_parser
+// Purpose: Recursive-descent parser for one JSON document; reports the byte offset
+//          of the first syntax error
+class json_document_parser {
+public:
+    explicit json_document_parser(const string& document_text) : document_text(document_text) {}
+
+    // Function: parse_document
+    // Purpose: Parses the whole document into parsed_value
+    // Returns: false with error_message set on malformed input or trailing content
+    bool parse_document(json_value& parsed_value) {
+        if (!parse_value(parsed_value, 0)) {
+            return false;
+        }
+        skip_whitespace();
+        return read_position == document_text.size() || fail("trailing content");
+    }
+
+    string error_message;  // Description of the first error
+
+private:
+    static constexpr int MAXIMUM_NESTING_DEPTH = 64;  // Guards the recursion on hostile input
+
+    const string& document_text;
+    size_t read_position = 0;
+
+    bool fail(const string& problem_description) {
+        error_message = problem_description + " at offset " + to_string(read_position);
+        return false;
+    }
+
+    void skip_whitespace() {
+        while (read_position < document_text.size() && isspace(static_cast<unsigned char>(document_text[read_position]))) {
+            read_position++;
+        }
+    }
+
+    bool consume_literal(const char* literal_text) {
+        size_t literal_length = strlen(literal_text);
+        if (document_text.compare(read_position, literal_length, literal_text) != 0) {
+            return fail(string("expected ") + literal_text);
+        }
+        read_position += literal_length;
+        return true;
+    }
+
+    bool parse_value(json_value& parsed_value, int nesting_depth) {
+        if (nesting_depth > MAXIMUM_NESTING_DEPTH) {
+            return fail("nesting too deep");
+        }
+        skip_whitespace();
+        if (read_position >= document_text.size()) {
+            return fail("unexpected end of document");
+        }
+        char lead_character = document_text[read_position];
+        switch (lead_character) {
+            case '{': return parse_object(parsed_value, nesting_depth);
+            case '[': return parse_array(parsed_value, nesting_depth);
+            case '"':
+                parsed_value.kind = json_value::value_kind::string_value;
+                return parse_string(parsed_value.string_content);
+            case 't':
+                parsed_value.kind = json_value::value_kind::boolean_value;
+                parsed_value.boolean_content = true;
+                return consume_literal("true");
+            case 'f':
+                parsed_value.kind = json_value::value_kind::boolean_value;
+                return consume_literal("false");
+            case 'n':
+                parsed_value.kind = json_value::value_kind::null_value;
+                return consume_literal("null");
+            default:
+                return parse_number(parsed_value);
+        }
+    }
+
+    bool parse_number(json_value& parsed_value) {
+        const char* number_begin = document_text.c_str() + read_position;
+        char* number_end = nullptr;
+        double numeric_value = strtod(number_begin, &number_end);
+        if (number_end == number_begin) {
+            return fail("expected a value");
+        }
+        read_position += number_end - number_begin;
+        parsed_value.kind = json_value::value_kind::number_value;
+        parsed_value.number_content = numeric_value;
+        return true;
+    }
+
+    bool parse_string(string& parsed_text) {
+        read_position++;  // Opening quote
+        while (read_position < document_text.size()) {
+            char text_character = document_text[read_position++];
+            if (text_character == '"') {
+                return true;
+            }
+            if (text_character != '\\') {
+                parsed_text += text_character;
+                continue;
+            }
+            if (read_position >= document_text.size()) {
+                break;
+            }
+            char escape_character = document_text[read_position++];
+            switch (escape_character) {
+                case '"': case '\\': case '/': parsed_text += escape_character; break;
+                case 'b': parsed_text += '\b'; break;
+                case 'f': parsed_text += '\f'; break;
+                case 'n': parsed_text += '\n'; break;
+                case 'r': parsed_text += '\r'; break;
+                case 't': parsed_text += '\t'; break;
+                case 'u': {
+                    if (read_position + 4 > document_text.size()) {
+                        return fail("truncated unicode escape");
+                    }
+                    unsigned code_point = 0;
+                    for (int digit_index = 0; digit_index < 4; digit_index++) {
+                        char hex_digit = document_text[read_position++];
+                        if (!isxdigit(static_cast<unsigned char>(hex_digit))) {
+                            return fail("malformed unicode escape");
+                        }
+                        code_point = code_point * 16 + (isdigit(static_cast<unsigned char>(hex_digit))
+                            ? hex_digit - '0' : (tolower(static_cast<unsigned char>(hex_digit)) - 'a' + 10));
+                    }
+                    // UTF-8 encode the basic multilingual plane code point
+                    if (code_point < 0x80) {
+                        parsed_text += static_cast<char>(code_point);
+                    } else if (code_point < 0x800) {
+                        parsed_text += static_cast<char>(0xC0 | (code_point >> 6));
+                        parsed_text += static_cast<char>(0x80 | (code_point & 0x3F));
+                    } else {
+                        parsed_text += static_cast<char>(0xE0 | (code_point >> 12));
+                        parsed_text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                        parsed_text += static_cast<char>(0x80 | (code_point & 0x3F));
+                    }
+                    break;
+                }
+                default:
+                    return fail("unknown escape");
+            }
+        }
+        return fail("unterminated string");
+    }
+
+    bool parse_array(json_value& parsed_value, int nesting_depth) {
+        parsed_value.kind = json_value::value_kind::array_value;
+        read_position++;  // '['
+        skip_whitespace();
+        if (read_position < document_text.size() && document_text[read_position] == ']') {
+            read_position++;
+            return true;
+        }
+        while (true) {
+            parsed_value.array_elements.emplace_back();
+            if (!parse_value(parsed_value.array_elements.back(), nesting_depth + 1)) {
+                return false;
+            }
+            skip_whitespace();
+            if (read_position < document_text.size() && document_text[read_position] == ',') {
+                read_position++;
+            } else if (read_position < document_text.size() && document_text[read_position] == ']') {
+                read_position++;
+                return true;
+            } else {
+                return fail("expected ',' or ']'");
+            }
+        }
+    }
+
+    bool parse_object(json_value& parsed_value, int nesting_depth) {
+        parsed_value.kind = json_value::value_kind::object_value;
+        read_position++;  // '{'
+        skip_whitespace();
+        if (read_position < document_text.size() && document_text[read_position] == '}') {
+            read_position++;
+            return true;
+        }
+        while (true) {
+            skip_whitespace();
+            if (read_position >= document_text.size() || document_text[read_position] != '"') {
+                return fail("expected member name");
+            }
+            parsed_value.member_names.emplace_back();
+            if (!parse_string(parsed_value.member_names.back())) {
+                return false;
+            }
+            skip_whitespace();
+            if (read_position >= document_text.size() || document_text[read_position] != ':') {
+                return fail("expected ':'");
+            }
+            read_position++;
+            parsed_value.member_values.emplace_back();
+            if (!parse_value(parsed_value.member_values.back(), nesting_depth + 1)) {
+                return false;
+            }
+            skip_whitespace();
+            if (read_position < document_text.size() && document_text[read_position] == ',') {
+                read_position++;
+            } else if (read_position < document_text.size() && document_text[read_position] == '}') {
+                read_position++;
+                return true;
+            } else {
+                return fail("expected ',' or '}'");
+            }
+        }
+    }
+};
+
+// Function: load_results_json
+// Purpose: Reads an export written by write_results_json back into results
+// Parameters: input_path - JSON export, result_export - receives host info and cells
+// Returns: false (with a message on cerr) when the file is unreadable or not an export
+bool load_results_json(const string& input_path, benchmark_result_export& result_export) {
+    ifstream json_file(input_path);
+    if (!json_file) {
+        cerr << "Cannot read " << input_path << endl;
+        return false;
+    }
+    string document_text((istreambuf_iterator<char>(json_file)), istreambuf_iterator<char>());
+    json_value document_root;
+    json_document_parser document_parser(document_text);
+    if (!document_parser.parse_document(document_root)) {
+        cerr << input_path << ": " << document_parser.error_message << endl;
+        return false;
+    }
+    const json_value* format_version = document_root.member("format_version");
+    const json_value* result_list = document_root.member("results");
+    if (format_version == nullptr || format_version->number_content != RESULT_EXPORT_FORMAT_VERSION ||
+        result_list == nullptr || result_list->kind != json_value::value_kind::array_value) {
+        cerr << input_path << ": not a format " << RESULT_EXPORT_FORMAT_VERSION << " result export" << endl;
+        return false;
+    }
+    if (const json_value* host_object = document_root.member("host")) {
+        result_export.host_info.host_name = host_object->string_or("host_name", "unknown");
+        result_export.host_info.cpu_model = host_object->string_or("cpu_model", "unknown");
+        result_export.host_info.compiler_version = host_object->string_or("compiler_version", "unknown");
+        result_export.host_info.build_flags = host_object->string_or("build_flags", "unknown");
+        result_export.host_info.timestamp = host_object->string_or("timestamp", "unknown");
+    }
+    for (const json_value& result_object : result_list->array_elements) {
+        exported_benchmark_result result;
+        algorithm_performance_metrics& metrics = result.metrics;
+        result.benchmark_section = result_object.string_or("section", "");
+        metrics.algorithm_identifier = result_object.string_or("algorithm", "");
+        metrics.element_label = result_object.string_or("element", "");
+        metrics.distribution_label = result_object.string_or("distribution", "");
+        metrics.dataset_size = static_cast<size_t>(result_object.number_or("size", 0.0));
+        metrics.correctness_validation = result_object.boolean_or("correct", false);
+        metrics.timing.sample_count = static_cast<int>(result_object.number_or("samples", 0.0));
+        metrics.timing.mean_time = result_object.number_or("mean_ns", numeric_limits<double>::quiet_NaN());
+        metrics.timing.median_time = result_object.number_or("median_ns", numeric_limits<double>::quiet_NaN());
+        metrics.timing.standard_deviation = result_object.number_or("stddev_ns", 0.0);
+        result_export.results.push_back(move(result));
+    }
+    return true;
+}
+
+// Function: welch_t_statistic
+// Purpose: Welch's unequal-variance t statistic of candidate mean minus baseline mean
+// Parameters: baseline/candidate - timing statistics of the two cells,
+//             degrees_of_freedom - receives the Welch-Satterthwaite estimate
+// Returns: t statistic (positive when the candidate is slower)
+double welch_t_statistic(const timing_statistics& baseline, const timing_statistics& candidate, double& degrees_of_freedom) {
+    double baseline_variance = baseline.standard_deviation * baseline.standard_deviation / max(1, baseline.sample_count);
+    double candidate_variance = candidate.standard_deviation * candidate.standard_deviation / max(1, candidate.sample_count);
+    double variance_sum = baseline_variance + candidate_variance;
+    double mean_difference = candidate.mean_time - baseline.mean_time;
+    if (variance_sum <= 0.0) {
+        degrees_of_freedom = numeric_limits<double>::infinity();
+        return mean_difference > 0.0 ? numeric_limits<double>::infinity()
+             : (mean_difference < 0.0 ? -numeric_limits<double>::infinity() : 0.0);
+    }
+    double satterthwaite_denominator =
+        baseline_variance * baseline_variance / max(1, baseline.sample_count - 1) +
+        candidate_variance * candidate_variance / max(1, candidate.sample_count - 1);
+    degrees_of_freedom = satterthwaite_denominator > 0.0 ? variance_sum * variance_sum / satterthwaite_denominator
+                                                         : numeric_limits<double>::infinity();
+    return mean_difference / sqrt(variance_sum);
+}
+
+// Function: student_t_critical_value
+// Purpose: One-sided 95% Student t quantile from the normal quantile via the
+//          Cornish-Fisher expansion - accurate to ~1% from 3 degrees of freedom
+double student_t_critical_value(double degrees_of_freedom) {
+    double normal_quantile = REGRESSION_Z_SCORE;
+    if (!isfinite(degrees_of_freedom)) {
+        return normal_quantile;
+    }
+    degrees_of_freedom = max(degrees_of_freedom, 1.0);
+    double cubed_quantile = normal_quantile * normal_quantile * normal_quantile;
+    double fifth_quantile = cubed_quantile * normal_quantile * normal_quantile;
+    return normal_quantile + (cubed_quantile + normal_quantile) / (4.0 * degrees_of_freedom) +
+           (5.0 * fifth_quantile + 16.0 * cubed_quantile + 3.0 * normal_quantile) / (96.0 * degrees_of_freedom * degrees_of_freedom);
+}
+
+// Function: compare_against_baseline
+// Purpose: Matches candidate cells to baseline cells and flags a regression when the
+//          median slowed by more than minimum_slowdown AND Welch's test on the means
+//          is significant at one-sided 95%; candidate validation failures always count.
+//          Baseline cells the candidate no longer produces (a removed or renamed engine,
+//          distribution or size) are reported and fail the gate unless allowed.
+// Parameters: baseline/candidate - result sets, minimum_slowdown - relative median gate,
+//             allow_missing_cells - report missing baseline cells without failing
+// Returns: number of failing cells (regressions plus disallowed missing cells)
+size_t compare_against_baseline(const benchmark_result_export& baseline, const benchmark_result_export& candidate,
+                                double minimum_slowdown, bool allow_missing_cells = false) {
+    cout << "\n" << string(80, '=') << endl;
+    cout << "BASELINE COMPARISON (regression when median > +" << fixed << setprecision(1) << minimum_slowdown * 100
+         << "% and Welch t significant at one-sided 95%)" << endl;
+    cout << string(80, '=') << endl;
+    cout << "Baseline:  " << baseline.host_info.timestamp << " on " << baseline.host_info.cpu_model << " ("
+         << baseline.host_info.compiler_version << ", " << baseline.host_info.build_flags << ")" << endl;
+    cout << "Candidate: " << candidate.host_info.timestamp << " on " << candidate.host_info.cpu_model << " ("
+         << candidate.host_info.compiler_version << ", " << candidate.host_info.build_flags << ")" << endl;
+    if (baseline.host_info.cpu_model != candidate.host_info.cpu_model) {
+        cout << "Warning: CPU models differ - timings are not directly comparable" << endl;
+    }
+
+    size_t regression_count = 0;
+    size_t improvement_count = 0;
+    size_t matched_count = 0;
+    for (const exported_benchmark_result& candidate_result : candidate.results) {
+        string cell_key = result_cell_key(candidate_result);
+        auto baseline_position = find_if(baseline.results.begin(), baseline.results.end(),
+            [&](const exported_benchmark_result& baseline_result) { return result_cell_key(baseline_result) == cell_key; });
+        if (baseline_position == baseline.results.end()) {
+            continue;
+        }
+        matched_count++;
+        const timing_statistics& baseline_timing = baseline_position->metrics.timing;
+        const timing_statistics& candidate_timing = candidate_result.metrics.timing;
+        double median_ratio = candidate_timing.median_time / baseline_timing.median_time;
+        double degrees_of_freedom = 0.0;
+        double t_statistic = welch_t_statistic(baseline_timing, candidate_timing, degrees_of_freedom);
+        double critical_value = student_t_critical_value(degrees_of_freedom);
+        bool validation_failed = !candidate_result.metrics.correctness_validation;
+        bool regressed = validation_failed || (median_ratio > 1.0 + minimum_slowdown && t_statistic > critical_value);
+        bool improved = !validation_failed && median_ratio < 1.0 - minimum_slowdown && -t_statistic > critical_value;
+        if (regressed) {
+            regression_count++;
+            cout << "REGRESSION  " << cell_key << ": ";
+            if (validation_failed) {
+                cout << "validation FAILED" << endl;
+            } else {
+                cout << format_duration(baseline_timing.median_time) << " -> " << format_duration(candidate_timing.median_time)
+                     << " (" << fixed << setprecision(2) << median_ratio << "x, t = " << t_statistic << ")" << endl;
+            }
+        } else if (improved) {
+            improvement_count++;
+            cout << "improvement " << cell_key << ": " << format_duration(baseline_timing.median_time) << " -> "
+                 << format_duration(candidate_timing.median_time) << " (" << fixed << setprecision(2) << median_ratio << "x)" << endl;
+        }
+    }
+    size_t missing_count = 0;
+    for (const exported_benchmark_result& baseline_result : baseline.results) {
+        string cell_key = result_cell_key(baseline_result);
+        if (none_of(candidate.results.begin(), candidate.results.end(),
+                    [&](const exported_benchmark_result& candidate_result) { return result_cell_key(candidate_result) == cell_key; })) {
+            missing_count++;
+            cout << "MISSING     " << cell_key << ": no candidate result" << endl;
+        }
+    }
+    cout << "\n" << matched_count << " cells compared (" << candidate.results.size() - matched_count
+         << " candidate cells without a baseline, " << missing_count << " baseline cells missing"
+         << (allow_missing_cells && missing_count > 0 ? " - allowed" : "") << "), " << regression_count << " regressions, "
+         << improvement_count << " significant improvements" << endl;
+    return regression_count + (allow_missing_cells ? 0 : missing_count);
+}
+
+// Structure: benchmark_output_configuration
+// Purpose: Export and regression-gate options of the default benchmark run
+struct benchmark_output_configuration {
+    string json_output_path;                              // --json: structured results
+    string csv_output_path;                               // --csv: one row per cell
+    string baseline_path;                                 // --baseline: JSON export to gate against
+    double minimum_slowdown = REGRESSION_MINIMUM_SLOWDOWN;  // --threshold: relative median gate
+    bool allow_missing_cells = false;                     // --allow-missing: baseline cells may be absent
+};
+
+// Function: run_baseline_comparison
+// Purpose: Compare-mode entry point - gates one saved export against another
+// Parameters: baseline_path/candidate_path - JSON exports, minimum_slowdown - relative median gate,
+//             allow_missing_cells - do not fail on baseline cells absent from the candidate
+// Returns: 0 when nothing regressed, 1 on regressions or missing cells, 2 when an export cannot be loaded
+int run_baseline_comparison(const string& baseline_path, const string& candidate_path, double minimum_slowdown,
+                            bool allow_missing_cells) {
+    benchmark_result_export baseline;
+    benchmark_result_export candidate;
+    if (!load_results_json(baseline_path, baseline) || !load_results_json(candidate_path, candidate)) {
+        return 2;
+    }
+    return compare_against_baseline(baseline, candidate, minimum_slowdown, allow_missing_cells) == 0 ? 0 : 1;
+}
+
+/*
+================================================================================
+SCALING SWEEP MODE - Geometric size sweep, growth exponents and crossovers
+================================================================================
+*/
+
+// Structure: scaling_sweep_configuration
+// Purpose: Size range, step and per-cell time budget of a sweep run
+struct scaling_sweep_configuration {
+    size_t minimum_size = SWEEP_MINIMUM_SIZE;              // Smallest dataset size
+    size_t maximum_size = SWEEP_MAXIMUM_SIZE;              // Largest dataset size
+    double growth_factor = SWEEP_GROWTH_FACTOR;            // Ratio between consecutive sizes
+    double cell_time_budget_seconds = SWEEP_CELL_TIME_BUDGET_SECONDS;  // Median run time that retires an engine
+    string calibration_output_path;                        // Where calibrated adaptive thresholds are written
+};
+
+// Structure: scaling_sweep_table
+// Purpose: Median run time of every (algorithm, size) cell - NaN where not measured
+struct scaling_sweep_table {
+    vector<size_t> dataset_sizes;              // Swept sizes, ascending
+    vector<string> algorithm_identifiers;      // Registry order
+    vector<vector<double>> median_times;       // [algorithm][size] in nanoseconds
+    vector<string> retirement_notes;           // [algorithm] why larger sizes were skipped
+};
+
+// Function: build_sweep_sizes
+// Purpose: Geometric size sequence from minimum to maximum (maximum always included)
+// Returns: ascending, de-duplicated dataset sizes
+vector<size_t> build_sweep_sizes(const scaling_sweep_configuration& sweep_configuration) {
+    vector<size_t> dataset_sizes;
+    for (double dataset_size = static_cast<double>(sweep_configuration.minimum_size);
+         dataset_size < static_cast<double>(sweep_configuration.maximum_size);
+         dataset_size *= sweep_configuration.growth_factor) {
+        size_t rounded_size = static_cast<size_t>(llround(dataset_size));
+        if (dataset_sizes.empty() || rounded_size > dataset_sizes.back()) {
+            dataset_sizes.push_back(rounded_size);
+        }
+    }
+    if (dataset_sizes.empty() || dataset_sizes.back() != sweep_configuration.maximum_size) {
+        dataset_sizes.push_back(sweep_configuration.maximum_size);
+    }
+    return dataset_sizes;
+}
+
+// Function: run_sweep_cell
+// Purpose: Measures one registered engine at one size unless it is retired or not applicable
+// Parameters: input_pool - shared int32 input for this size, algorithm_index - registry
+//             position, size_index - column in the table, sweep_configuration - budgets,
+//             sweep_table - results being filled in
+template <typename Descriptor>
+void run_sweep_cell(benchmark_input_pool<int32_t>& input_pool, size_t algorithm_index, size_t size_index,
+                    const scaling_sweep_configuration& sweep_configuration, scaling_sweep_table& sweep_table) {
+    size_t dataset_size = sweep_table.dataset_sizes[size_index];
+    string& retirement_note = sweep_table.retirement_notes[algorithm_index];
+    if (!retirement_note.empty()) {
+        return;  // Exceeded the budget at a smaller size
+    }
+    if (!active_run_configuration().selects_algorithm(Descriptor::algorithm_name)) {
+        retirement_note = "filtered out";
+        return;
+    }
+    if (dataset_size > Descriptor::applicable_max_size) {
+        retirement_note = "beyond applicable max N";
+        return;
+    }
+
+    // Few repetitions per cell - the sweep trades precision for coverage
+    measurement_policy sweep_policy;
+    sweep_policy.warmup_iterations = 1;
+    sweep_policy.minimum_iterations = 3;
+    sweep_policy.maximum_iterations = 50;
+    sweep_policy.time_budget_seconds = sweep_configuration.cell_time_budget_seconds;
+
+    span<int32_t> test_dataset;
+    timing_statistics timing = collect_timing_samples(
+        [&](int iteration_counter) { test_dataset = input_pool.load_iteration_input(iteration_counter); },
+        [&](int) { Descriptor::sort(test_dataset, identity{}); },
+        [](int) {},
+        dataset_size, false, sweep_policy);
+
+    sweep_table.median_times[algorithm_index][size_index] = timing.median_time;
+    if (timing.median_time / 1e9 > sweep_configuration.cell_time_budget_seconds) {
+        retirement_note = "exceeded time budget at N=" + to_string(dataset_size);
+    }
+}
+
+// Function: run_sweep_size
+// Purpose: Measures every registered int32 engine at one dataset size
+template <typename... Descriptors>
+void run_sweep_size(algorithm_type_list<Descriptors...>, size_t size_index,
+                    const scaling_sweep_configuration& sweep_configuration, scaling_sweep_table& sweep_table) {
+    // One variant keeps memory bounded at the largest sizes
+    benchmark_input_pool<int32_t> input_pool =
+        build_input_pool<int32_t>(static_cast<int>(sweep_table.dataset_sizes[size_index]), 1);
+
+    size_t algorithm_index = 0;
+    (run_sweep_cell<Descriptors>(input_pool, algorithm_index++, size_index, sweep_configuration, sweep_table), ...);
+}
+
+// Function: fit_growth_exponent
+// Purpose: Least-squares slope of log(time) against log(N) - 1 means linear,
+//          ~1.1 n log n over typical ranges, 2 quadratic
+// Parameters: dataset_sizes - swept sizes, median_times - times for one algorithm
+// Returns: fitted exponent, or NaN with fewer than two usable points
+double fit_growth_exponent(const vector<size_t>& dataset_sizes, const vector<double>& median_times) {
+    vector<pair<double, double>> log_points;
+    for (size_t size_index = 0; size_index < dataset_sizes.size(); size_index++) {
+        if (dataset_sizes[size_index] >= SWEEP_FIT_MINIMUM_SIZE && !isnan(median_times[size_index])) {
+            log_points.emplace_back(log(static_cast<double>(dataset_sizes[size_index])), log(median_times[size_index]));
+        }
+    }
+    if (log_points.size() < 2) {
+        return numeric_limits<double>::quiet_NaN();
+    }
+
+    double mean_x = 0.0, mean_y = 0.0;
+    for (const auto& [log_size, log_time] : log_points) {
+        mean_x += log_size;
+        mean_y += log_time;
+    }
+    mean_x /= log_points.size();
+    mean_y /= log_points.size();
+
+    double covariance_sum = 0.0, variance_sum = 0.0;
+    for (const auto& [log_size, log_time] : log_points) {
+        covariance_sum += (log_size - mean_x) * (log_time - mean_y);
+        variance_sum += (log_size - mean_x) * (log_size - mean_x);
+    }
+    return covariance_sum / variance_sum;
+}
+
+// Function: display_scaling_sweep_report
+// Purpose: Prints the ns/element table, growth exponents and pairwise crossover points
+void display_scaling_sweep_report(const scaling_sweep_table& sweep_table) {
+    size_t algorithm_count = sweep_table.algorithm_identifiers.size();
+
+    cout << "\n" << string(80, '=') << endl;
+    cout << "SCALING SWEEP RESULTS - median ns per element" << endl;
+    cout << string(80, '=') << endl;
+    for (size_t algorithm_index = 0; algorithm_index < algorithm_count; algorithm_index++) {
+        cout << "[" << setw(2) << algorithm_index + 1 << "] " << sweep_table.algorithm_identifiers[algorithm_index] << endl;
+    }
+
+    cout << "\n" << left << setw(12) << "N" << right;
+    for (size_t algorithm_index = 0; algorithm_index < algorithm_count; algorithm_index++) {
+        cout << setw(9) << ("[" + to_string(algorithm_index + 1) + "]");
+    }
+    cout << endl;
+    for (size_t size_index = 0; size_index < sweep_table.dataset_sizes.size(); size_index++) {
+        size_t dataset_size = sweep_table.dataset_sizes[size_index];
+        cout << left << setw(12) << dataset_size << right;
+        for (size_t algorithm_index = 0; algorithm_index < algorithm_count; algorithm_index++) {
+            double median_time = sweep_table.median_times[algorithm_index][size_index];
+            if (isnan(median_time)) {
+                cout << setw(9) << "-";
+            } else {
+                cout << setw(9) << fixed << setprecision(median_time / dataset_size < 100.0 ? 2 : 0)
+                     << median_time / dataset_size;
+            }
+        }
+        cout << endl;
+    }
+
+    // Growth exponents and retirement reasons
+    cout << "\nEmpirical growth exponents (fit over N >= " << SWEEP_FIT_MINIMUM_SIZE << "):" << endl;
+    for (size_t algorithm_index = 0; algorithm_index < algorithm_count; algorithm_index++) {
+        double growth_exponent = fit_growth_exponent(sweep_table.dataset_sizes, sweep_table.median_times[algorithm_index]);
+        cout << "- " << left << setw(27) << sweep_table.algorithm_identifiers[algorithm_index] << right;
+        if (isnan(growth_exponent)) {
+            cout << "n/a";
+        } else {
+            cout << "N^" << fixed << setprecision(2) << growth_exponent;
+        }
+        if (!sweep_table.retirement_notes[algorithm_index].empty()) {
+            cout << "  (skipped larger sizes: " << sweep_table.retirement_notes[algorithm_index] << ")";
+        }
+        cout << endl;
+    }
+
+    // Crossovers: consecutive sizes where the faster engine of a pair flips
+    cout << "\nCrossover points (log-interpolated N where the faster engine changes by more than "
+         << static_cast<int>(SWEEP_CROSSOVER_MARGIN * 100) << "%):" << endl;
+    int crossover_count = 0;
+    for (size_t first_index = 0; first_index < algorithm_count; first_index++) {
+        for (size_t second_index = first_index + 1; second_index < algorithm_count; second_index++) {
+            const vector<double>& first_times = sweep_table.median_times[first_index];
+            const vector<double>& second_times = sweep_table.median_times[second_index];
+            for (size_t size_index = 1; size_index < sweep_table.dataset_sizes.size(); size_index++) {
+                double previous_first = first_times[size_index - 1], previous_second = second_times[size_index - 1];
+                double current_first = first_times[size_index], current_second = second_times[size_index];
+                if (isnan(previous_first) || isnan(previous_second) || isnan(current_first) || isnan(current_second)) {
+                    continue;
+                }
+                double previous_log_ratio = log(previous_first / previous_second);
+                double current_log_ratio = log(current_first / current_second);
+                if ((previous_log_ratio < 0.0) == (current_log_ratio < 0.0)) {
+                    continue;
+                }
+                // Ignore flips between near-ties - they are measurement noise, not crossovers
+                double significance_threshold = log1p(SWEEP_CROSSOVER_MARGIN);
+                if (fabs(previous_log_ratio) < significance_threshold || fabs(current_log_ratio) < significance_threshold) {
+                    continue;
+                }
+
+                // Zero of the log-ratio between the two sizes, interpolated in log N
+                double blend_weight = previous_log_ratio / (previous_log_ratio - current_log_ratio);
+                double crossover_size = exp(log(static_cast<double>(sweep_table.dataset_sizes[size_index - 1])) * (1.0 - blend_weight)
+                                            + log(static_cast<double>(sweep_table.dataset_sizes[size_index])) * blend_weight);
+                const string& faster_below = previous_log_ratio < 0.0
+                    ? sweep_table.algorithm_identifiers[first_index] : sweep_table.algorithm_identifiers[second_index];
+                const string& faster_above = previous_log_ratio < 0.0
+                    ? sweep_table.algorithm_identifiers[second_index] : sweep_table.algorithm_identifiers[first_index];
+                cout << "- N ~ " << left << setw(12) << static_cast<size_t>(crossover_size) << right
+                     << faster_below << " faster below, " << faster_above << " faster above" << endl;
+                crossover_count++;
+            }
+        }
+    }
+    if (crossover_count == 0) {
+        cout << "- none within the swept range" << endl;
+    }
+}
+
+// Function: calibrate_adaptive_thresholds
+// Purpose: Derives the dispatcher's size thresholds from a sweep - insertion sort is
+//          used up to the last N where it still beats introsort, radix sort from the
+//          first N after which LSD radix beats introsort at every larger size
+// Parameters: sweep_table - measured sweep, thresholds - receives the calibrated values
+// Returns: false when the sweep lacks the engines or sizes needed
+bool calibrate_adaptive_thresholds(const scaling_sweep_table& sweep_table, adaptive_dispatch_thresholds& thresholds) {
+    auto times_of = [&](const char* algorithm_name) -> const vector<double>* {
+        auto name_position = find(sweep_table.algorithm_identifiers.begin(), sweep_table.algorithm_identifiers.end(), algorithm_name);
+        return name_position == sweep_table.algorithm_identifiers.end()
+            ? nullptr : &sweep_table.median_times[name_position - sweep_table.algorithm_identifiers.begin()];
+    };
+    const vector<double>* insertion_times = times_of(insertion_sort_descriptor::algorithm_name);
+    const vector<double>* introsort_times = times_of(introsort_descriptor::algorithm_name);
+    const vector<double>* radix_times = times_of(lsd_radix_sort_descriptor::algorithm_name);
+    if (insertion_times == nullptr || introsort_times == nullptr || radix_times == nullptr) {
+        return false;
+    }
+
+    bool insertion_calibrated = false;
+    bool radix_calibrated = false;
+    size_t radix_streak_start = 0;
+    for (size_t size_index = 0; size_index < sweep_table.dataset_sizes.size(); size_index++) {
+        double introsort_time = (*introsort_times)[size_index];
+        if (isnan(introsort_time)) {
+            continue;
+        }
+        if (!isnan((*insertion_times)[size_index]) && (*insertion_times)[size_index] <= introsort_time) {
+            thresholds.insertion_maximum_size = sweep_table.dataset_sizes[size_index];
+            insertion_calibrated = true;
+        }
+        if (!isnan((*radix_times)[size_index]) && (*radix_times)[size_index] < introsort_time) {
+            if (radix_streak_start == 0) {
+                radix_streak_start = sweep_table.dataset_sizes[size_index];
+            }
+        } else {
+            radix_streak_start = 0;  // Introsort won again - the streak must restart higher
+        }
+    }
+    if (radix_streak_start != 0) {
+        thresholds.radix_minimum_size = radix_streak_start;
+        radix_calibrated = true;
+    }
+    return insertion_calibrated || radix_calibrated;
+}
+
+// Function: run_scaling_sweep
+// Purpose: Sweep-mode entry point - measures every registered int32 engine across
+//          a geometric size range and prints the scaling report
+void run_scaling_sweep(const scaling_sweep_configuration& sweep_configuration) {
+    scaling_sweep_table sweep_table;
+    sweep_table.dataset_sizes = build_sweep_sizes(sweep_configuration);
+    [&]<typename... Descriptors>(algorithm_type_list<Descriptors...>) {
+        (sweep_table.algorithm_identifiers.push_back(Descriptors::algorithm_name), ...);
+    }(registered_algorithms{});
+    sweep_table.median_times.assign(sweep_table.algorithm_identifiers.size(),
+                                    vector<double>(sweep_table.dataset_sizes.size(), numeric_limits<double>::quiet_NaN()));
+    sweep_table.retirement_notes.assign(sweep_table.algorithm_identifiers.size(), "");
+
+    cout << "Scaling sweep: N = " << sweep_configuration.minimum_size << " .. " << sweep_configuration.maximum_size
+         << ", factor " << sweep_configuration.growth_factor << ", cell budget "
+         << sweep_configuration.cell_time_budget_seconds << " s" << endl;
+
+    for (size_t size_index = 0; size_index < sweep_table.dataset_sizes.size(); size_index++) {
+        cout << "Sweeping N = " << sweep_table.dataset_sizes[size_index] << "..." << endl;
+        run_sweep_size(registered_algorithms{}, size_index, sweep_configuration, sweep_table);
+    }
+
+    display_scaling_sweep_report(sweep_table);
+
+    // Dispatcher calibration from the measured crossovers
+    adaptive_dispatch_thresholds calibrated_thresholds = active_adaptive_thresholds();
+    if (!calibrate_adaptive_thresholds(sweep_table, calibrated_thresholds)) {
+        cout << "\nAdaptive calibration: not enough overlapping measurements" << endl;
+        return;
+    }
+    cout << "\nAdaptive calibration: insertion_maximum_size=" << calibrated_thresholds.insertion_maximum_size
+         << ", radix_minimum_size=" << calibrated_thresholds.radix_minimum_size << endl;
+    if (!sweep_configuration.calibration_output_path.empty()) {
+        ofstream calibration_file(sweep_configuration.calibration_output_path);
+        calibration_file << "# Adaptive dispatch thresholds calibrated by the scaling sweep\n"
+                         << "insertion_maximum_size=" << calibrated_thresholds.insertion_maximum_size << "\n"
+                         << "radix_minimum_size=" << calibrated_thresholds.radix_minimum_size << "\n"
+                         << "run_merge_window_ratio=" << calibrated_thresholds.run_merge_window_ratio << "\n"
+                         << "counting_maximum_range_ratio=" << calibrated_thresholds.counting_maximum_range_ratio << "\n";
+        if (!calibration_file) {
+            cerr << "Cannot write " << sweep_configuration.calibration_output_path << endl;
+            return;
+        }
+        cout << "Written to " << sweep_configuration.calibration_output_path
+             << " - set SORTER_ADAPTIVE_CALIBRATION to that path to apply it" << endl;
+    }
+}
+
+/*
+================================================================================
+EXTERNAL MERGE SORT - Out-of-core sorting of raw int32 files
+================================================================================
+*/
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// Structure: external_sort_configuration
+// Purpose: Paths and memory sizing of one external sort
+struct external_sort_configuration {
+    string input_path;                                   // Raw native-endian int32 keys
+    string output_path;                                  // Sorted keys, same format
+    string temporary_path;                               // Run file (defaults next to the output)
+    size_t run_bytes = EXTERNAL_RUN_BYTES;               // Keys sorted in memory per run
+    size_t merge_block_bytes = EXTERNAL_MERGE_BLOCK_BYTES;  // Largest read block per run while merging
+    bool verify_output = false;                          // Re-read and validate the output
+};
+
+// Structure: external_run_extent
+// Purpose: Location of one sorted run inside the run file
+struct external_run_extent {
+    off_t byte_offset;       // First byte of the run
+    size_t element_count;    // Keys in the run
+};
+
+// Structure: external_phase_statistics
+// Purpose: Bytes moved and wall time of one external sort phase
+struct external_phase_statistics {
+    string phase_label;
+    double processed_bytes = 0.0;
+    double elapsed_seconds = 0.0;
+
+    double megabytes_per_second() const {
+        return elapsed_seconds > 0.0 ? processed_bytes / (1024.0 * 1024.0) / elapsed_seconds : 0.0;
+    }
+};
+
+// Function: read_file_range
+// Purpose: pread loop that tolerates short reads and EINTR
+// Returns: false on I/O error or unexpected end of file
+bool read_file_range(int file_descriptor, void* target_buffer, size_t byte_count, off_t file_offset) {
+    char* target_bytes = static_cast<char*>(target_buffer);
+    while (byte_count > 0) {
+        ssize_t transferred = pread(file_descriptor, target_bytes, byte_count, file_offset);
+        if (transferred < 0 && errno == EINTR) {
+            continue;
+        }
+        if (transferred <= 0) {
+            return false;
+        }
+        target_bytes += transferred;
+        byte_count -= transferred;
+        file_offset += transferred;
+    }
+    return true;
+}
+
+// Function: write_file_range
+// Purpose: pwrite loop that tolerates short writes and EINTR
+// Returns: false on I/O error
+bool write_file_range(int file_descriptor, const void* source_buffer, size_t byte_count, off_t file_offset) {
+    const char* source_bytes = static_cast<const char*>(source_buffer);
+    while (byte_count > 0) {
+        ssize_t transferred = pwrite(file_descriptor, source_bytes, byte_count, file_offset);
+        if (transferred < 0 && errno == EINTR) {
+            continue;
+        }
+        if (transferred <= 0) {
+            return false;
+        }
+        source_bytes += transferred;
+        byte_count -= transferred;
+        file_offset += transferred;
+    }
+    return true;
+}
+
+// Class: background_io_service
+// Purpose: One I/O thread executing read/write jobs in submission order, so disk
+//          transfers overlap with sorting and merging on the calling thread
+class background_io_service {
+public:
+    // Constructor: starts the I/O thread
+    background_io_service() {
+        io_thread = thread([this] { run_io_loop(); });
+    }
+
+    // Destructor: drains queued jobs and joins the I/O thread
+    ~background_io_service() {
+        {
+            lock_guard<mutex> queue_lock(queue_mutex);
+            shutdown_requested = true;
+        }
+        queue_condition.notify_one();
+        io_thread.join();
+    }
+
+    background_io_service(const background_io_service&) = delete;
+    background_io_service& operator=(const background_io_service&) = delete;
+
+    // Function: submit
+    // Purpose: Queues an I/O job
+    // Returns: future carrying the job's success flag
+    future<bool> submit(function<bool()> io_job) {
+        packaged_task<bool()> queued_job(move(io_job));
+        future<bool> job_result = queued_job.get_future();
+        {
+            lock_guard<mutex> queue_lock(queue_mutex);
+            pending_jobs.push_back(move(queued_job));
+        }
+        queue_condition.notify_one();
+        return job_result;
+    }
+
+private:
+    // Function: run_io_loop
+    // Purpose: I/O thread body - runs jobs until shutdown and the queue is empty
+    void run_io_loop() {
+        while (true) {
+            packaged_task<bool()> next_job;
+            {
+                unique_lock<mutex> queue_lock(queue_mutex);
+                queue_condition.wait(queue_lock, [this] { return shutdown_requested || !pending_jobs.empty(); });
+                if (pending_jobs.empty()) {
+                    return;
+                }
+                next_job = move(pending_jobs.front());
+                pending_jobs.pop_front();
+            }
+            next_job();
+        }
+    }
+
+    mutex queue_mutex;
+    condition_variable queue_condition;
+    deque<packaged_task<bool()>> pending_jobs;
+    bool shutdown_requested = false;
+    thread io_thread;
+};
+
+// Class: external_input_file
+// Purpose: Read access to the input - memory-mapped with sequential advice, or
+//          large preads when the file cannot be mapped
+class external_input_file {
+public:
+    // Function: open_file
+    // Returns: false (with a message on cerr) when the file cannot be opened
+    bool open_file(const string& input_path) {
+        file_descriptor = open(input_path.c_str(), O_RDONLY);
+        struct stat file_status {};
+        if (file_descriptor < 0 || fstat(file_descriptor, &file_status) != 0) {
+            cerr << "Cannot open " << input_path << ": " << strerror(errno) << endl;
+            return false;
+        }
+        byte_size = static_cast<size_t>(file_status.st_size);
+        if (byte_size % sizeof(int32_t) != 0) {
+            cerr << input_path << " is not a raw int32 file (" << byte_size << " bytes)" << endl;
+            return false;
+        }
+        if (byte_size > 0) {
+            void* mapping = mmap(nullptr, byte_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+            if (mapping != MAP_FAILED) {
+                mapped_bytes = static_cast<const char*>(mapping);
+                madvise(mapping, byte_size, MADV_SEQUENTIAL);
+            }
+        }
+        return true;
+    }
+
+    // Destructor: unmaps and closes
+    ~external_input_file() {
+        if (mapped_bytes != nullptr) {
+            munmap(const_cast<char*>(mapped_bytes), byte_size);
+        }
+        if (file_descriptor >= 0) {
+            close(file_descriptor);
+        }
+    }
+
+    // Function: element_count
+    // Returns: number of int32 keys in the file
+    size_t element_count() const {
+        return byte_size / sizeof(int32_t);
+    }
+
+    // Function: copy_elements
+    // Purpose: Copies keys [element_offset, element_offset + count) into target_keys;
+    //          mapped pages are released afterwards so the page cache can recycle them
+    // Returns: false on read failure
+    bool copy_elements(size_t element_offset, size_t copy_count, int32_t* target_keys) {
+        size_t byte_offset = element_offset * sizeof(int32_t);
+        size_t byte_count = copy_count * sizeof(int32_t);
+        if (mapped_bytes == nullptr) {
+            return read_file_range(file_descriptor, target_keys, byte_count, static_cast<off_t>(byte_offset));
+        }
+        memcpy(target_keys, mapped_bytes + byte_offset, byte_count);
+
+        // madvise needs page-aligned starts; release whole pages covered by this copy
+        size_t page_bytes = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t release_begin = byte_offset / page_bytes * page_bytes;
+        size_t release_end = (byte_offset + byte_count) / page_bytes * page_bytes;
+        if (release_end > release_begin) {
+            madvise(const_cast<char*>(mapped_bytes) + release_begin, release_end - release_begin, MADV_DONTNEED);
+        }
+        return true;
+    }
+
+private:
+    int file_descriptor = -1;
+    size_t byte_size = 0;
+    const char* mapped_bytes = nullptr;  // Null when falling back to pread
 };
 
-// Function: measure_algorithm_performance
-// Purpose: Executes sorting algorithm multiple times and collects performance metrics
-// Parameters: algorithm_function - pointer to sorting function, algorithm_name - identifier string
-// Returns: performance metrics structure with statistical data
-algorithm_performance_metrics measure_algorithm_performance(
-    void (*algorithm_function)(vector<int>&), 
-    const string& algorithm_name
-) {
-    cout << "\nAnalyzing " << algorithm_name << " Algorithm Performance:" << endl;
-    cout << "Executing " << ALGORITHM_ITERATIONS << " iterations with " 
-         << DATASET_SIZE << " elements..." << endl;
-    
-    // Initialize performance tracking variables
-    double total_execution_time = 0.0;
-    double minimum_time = numeric_limits<double>::max();
-    double maximum_time = 0.0;
-    bool all_sorts_correct = true;
-    
-    // Execute algorithm multiple times for statistical analysis
-    for (int iteration_counter = 0; iteration_counter < ALGORITHM_ITERATIONS; iteration_counter++) {
-        // Generate fresh dataset for each iteration
-        vector<int> test_dataset = generate_random_dataset(DATASET_SIZE);
-        
-        // Record execution start timestamp
-        auto start_timestamp = high_resolution_clock::now();
-        
-        // Execute sorting algorithm on test dataset
-        algorithm_function(test_dataset);
-        
-        // Record execution completion timestamp
-        auto end_timestamp = high_resolution_clock::now();
-        
-        // Calculate iteration execution duration
-        auto duration_microseconds = duration_cast<microseconds>(end_timestamp - start_timestamp);
-        double iteration_time = duration_microseconds.count() / 1000.0;  // Convert to milliseconds
-        
-        // Update statistical tracking variables
-        total_execution_time += iteration_time;
-        minimum_time = min(minimum_time, iteration_time);
-        maximum_time = max(maximum_time, iteration_time);
-        
-        // Validate sorting correctness for quality assurance
-        if (!validate_sorting_correctness(test_dataset)) {
-            all_sorts_correct = false;
-        }
-        
-        // Display progress indicator for user feedback
-        display_progress_indicator(iteration_counter + 1, ALGORITHM_ITERATIONS);
+// Function: form_sorted_runs
+// Purpose: Phase 1 - sorts run-sized chunks with LSD radix sort (the fastest int32
+//          engine in the distribution matrix) and writes them through two buffers,
+//          so writing run r overlaps reading and sorting run r + 1
+// Parameters: input_file - opened input, run_file_descriptor - destination of the runs,
+//             run_elements - keys per run, io_service - background writer,
+//             run_extents - receives the run layout, input_fingerprint - multiset hash
+//             of the input, sort_seconds - time spent sorting
+// Returns: false on I/O failure
+bool form_sorted_runs(external_input_file& input_file, int run_file_descriptor, size_t run_elements,
+                      background_io_service& io_service, vector<external_run_extent>& run_extents,
+                      uint64_t& input_fingerprint, double& sort_seconds) {
+    size_t total_elements = input_file.element_count();
+    vector<int32_t> run_buffers[2];
+    future<bool> pending_writes[2];
+    input_fingerprint = 0;
+    sort_seconds = 0.0;
+
+    size_t run_index = 0;
+    for (size_t element_offset = 0; element_offset < total_elements; element_offset += run_elements, run_index++) {
+        size_t run_length = min(run_elements, total_elements - element_offset);
+        vector<int32_t>& run_buffer = run_buffers[run_index % 2];
+        future<bool>& pending_write = pending_writes[run_index % 2];
+        if (pending_write.valid() && !pending_write.get()) {
+            cerr << "Writing a sorted run failed: " << strerror(errno) << endl;
+            return false;
+        }
+
+        run_buffer.resize(run_length);
+        if (!input_file.copy_elements(element_offset, run_length, run_buffer.data())) {
+            cerr << "Reading the input failed: " << strerror(errno) << endl;
+            return false;
+        }
+        input_fingerprint += compute_multiset_fingerprint(span<const int32_t>(run_buffer));
+
+        auto sort_start = steady_clock::now();
+        execute_lsd_radix_sort_algorithm(span<int32_t>(run_buffer));
+        sort_seconds += duration<double>(steady_clock::now() - sort_start).count();
+
+        off_t run_offset = static_cast<off_t>(element_offset * sizeof(int32_t));
+        run_extents.push_back({run_offset, run_length});
+        pending_write = io_service.submit([run_file_descriptor, &run_buffer, run_offset] {
+            return write_file_range(run_file_descriptor, run_buffer.data(), run_buffer.size() * sizeof(int32_t), run_offset);
+        });
     }
-    
-    cout << "\n✓ Analysis Complete" << endl;
-    
-    // Construct and return performance metrics structure
-    algorithm_performance_metrics metrics;
-    metrics.algorithm_identifier = algorithm_name;
-    metrics.average_execution_time = total_execution_time / ALGORITHM_ITERATIONS;
-    metrics.minimum_execution_time = minimum_time;
-    metrics.maximum_execution_time = maximum_time;
-    metrics.correctness_validation = all_sorts_correct;
-    
-    return metrics;
+
+    for (future<bool>& pending_write : pending_writes) {
+        if (pending_write.valid() && !pending_write.get()) {
+            cerr << "Writing a sorted run failed: " << strerror(errno) << endl;
+            return false;
+        }
+    }
+    return true;
 }
 
-// Function: display_performance_report
-// Purpose: Generates formatted performance analysis report
-// Parameters: metrics_collection - vector containing all algorithm performance data
-void display_performance_report(const vector<algorithm_performance_metrics>& metrics_collection) {
-    cout << "\n" << string(80, '=') << endl;
-    cout << "COMPREHENSIVE ALGORITHM PERFORMANCE ANALYSIS REPORT" << endl;
-    cout << string(80, '=') << endl;
-    
-    // Display detailed metrics for each algorithm
-    for (const auto& algorithm_metrics : metrics_collection) {
-        cout << "\nAlgorithm: " << algorithm_metrics.algorithm_identifier << endl;
-        cout << string(40, '-') << endl;
-        cout << "Average Execution Time: " << fixed << setprecision(3) 
-             << algorithm_metrics.average_execution_time << " ms" << endl;
-        cout << "Minimum Execution Time: " << fixed << setprecision(3) 
-             << algorithm_metrics.minimum_execution_time << " ms" << endl;
-        cout << "Maximum Execution Time: " << fixed << setprecision(3) 
-             << algorithm_metrics.maximum_execution_time << " ms" << endl;
-        cout << "Correctness Validation: " 
-             << (algorithm_metrics.correctness_validation ? "PASSED" : "FAILED") << endl;
+// Structure: external_run_reader
+// Purpose: Double-buffered cursor over one run - while the merge consumes one block
+//          the I/O thread refills the other
+struct external_run_reader {
+    external_run_extent run_extent;        // Run location
+    size_t elements_requested = 0;         // Keys already handed to the I/O thread
+    vector<int32_t> block_buffers[2];      // Alternating read blocks
+    size_t block_lengths[2] = {0, 0};      // Valid keys per block
+    future<bool> block_fills[2];           // Outstanding reads
+    int active_block = 0;                  // Block being consumed
+    size_t block_cursor = 0;               // Next key in the active block
+
+    // Function: request_block
+    // Purpose: Queues the next slice of the run into the given block
+    void request_block(int block_index, int run_file_descriptor, background_io_service& io_service) {
+        size_t block_length = min(block_buffers[block_index].size(), run_extent.element_count - elements_requested);
+        block_lengths[block_index] = block_length;
+        if (block_length == 0) {
+            return;  // Run fully requested - leave the future empty
+        }
+        off_t read_offset = run_extent.byte_offset + static_cast<off_t>(elements_requested * sizeof(int32_t));
+        elements_requested += block_length;
+        int32_t* block_data = block_buffers[block_index].data();
+        block_fills[block_index] = io_service.submit([run_file_descriptor, block_data, block_length, read_offset] {
+            return read_file_range(run_file_descriptor, block_data, block_length * sizeof(int32_t), read_offset);
+        });
     }
-    
-    // Determine optimal algorithm based on average performance
-    cout << "\n" << string(80, '=') << endl;
-    cout << "PERFORMANCE ANALYSIS SUMMARY" << endl;
-    cout << string(80, '=') << endl;
-    
-    // Find algorithm with minimum average execution time
-    auto optimal_algorithm = min_element(metrics_collection.begin(), metrics_collection.end(),
-        [](const algorithm_performance_metrics& first, const algorithm_performance_metrics& second) {
-            return first.average_execution_time < second.average_execution_time;
+
+    // Function: await_active_block
+    // Returns: false when the read failed; an empty block means the run is exhausted
+    bool await_active_block() {
+        block_cursor = 0;
+        if (!block_fills[active_block].valid()) {
+            block_lengths[active_block] = 0;
+            return true;
+        }
+        return block_fills[active_block].get();
+    }
+
+    // Function: has_key
+    // Returns: true while the active block still holds keys
+    bool has_key() const {
+        return block_cursor < block_lengths[active_block];
+    }
+
+    // Function: advance
+    // Purpose: Steps to the next key, refilling the finished block in the background
+    // Returns: false when a read failed
+    bool advance(int run_file_descriptor, background_io_service& io_service) {
+        if (++block_cursor < block_lengths[active_block]) {
+            return true;
+        }
+        request_block(active_block, run_file_descriptor, io_service);
+        active_block ^= 1;
+        return await_active_block();
+    }
+
+    // Function: current_key
+    // Returns: key under the cursor
+    int32_t current_key() const {
+        return block_buffers[active_block][block_cursor];
+    }
+};
+
+// Function: merge_sorted_runs
+// Purpose: Phase 2 - k-way merge of every run through a loser tree, with
+//          double-buffered reads per run and a double-buffered output writer
+// Returns: false on I/O failure
+bool merge_sorted_runs(int run_file_descriptor, int output_file_descriptor, const vector<external_run_extent>& run_extents,
+                       size_t block_elements, background_io_service& io_service) {
+    vector<external_run_reader> run_readers(run_extents.size());
+    for (size_t run_index = 0; run_index < run_extents.size(); run_index++) {
+        external_run_reader& run_reader = run_readers[run_index];
+        run_reader.run_extent = run_extents[run_index];
+        for (int block_index = 0; block_index < 2; block_index++) {
+            run_reader.block_buffers[block_index].resize(block_elements);
+            run_reader.request_block(block_index, run_file_descriptor, io_service);
+        }
+    }
+
+    vector<int32_t> head_keys(run_readers.size());
+    vector<bool> run_exhausted(run_readers.size());
+    for (size_t run_index = 0; run_index < run_readers.size(); run_index++) {
+        if (!run_readers[run_index].await_active_block()) {
+            cerr << "Reading a sorted run failed: " << strerror(errno) << endl;
+            return false;
+        }
+        run_exhausted[run_index] = !run_readers[run_index].has_key();
+        head_keys[run_index] = run_exhausted[run_index] ? 0 : run_readers[run_index].current_key();
+    }
+    loser_tree<int32_t> merge_tree(move(head_keys), move(run_exhausted));
+
+    // Output alternates between two blocks; a block is reused only after its write finished
+    vector<int32_t> output_blocks[2] = {vector<int32_t>(block_elements), vector<int32_t>(block_elements)};
+    future<bool> pending_writes[2];
+    int active_output = 0;
+    size_t output_cursor = 0;
+    off_t output_offset = 0;
+    auto flush_output_block = [&]() {
+        int32_t* block_data = output_blocks[active_output].data();
+        size_t block_bytes = output_cursor * sizeof(int32_t);
+        off_t write_offset = output_offset;
+        pending_writes[active_output] = io_service.submit([output_file_descriptor, block_data, block_bytes, write_offset] {
+            return write_file_range(output_file_descriptor, block_data, block_bytes, write_offset);
         });
-    
-    cout << "Optimal Performance Algorithm: " << optimal_algorithm->algorithm_identifier << endl;
-    cout << "Performance Advantage: " << fixed << setprecision(2) 
-         << optimal_algorithm->average_execution_time << " ms average execution" << endl;
-    
-    // Calculate and display performance differentials
-    cout << "\nRelative Performance Analysis:" << endl;
-    for (const auto& algorithm_metrics : metrics_collection) {
-        double performance_ratio = algorithm_metrics.average_execution_time / optimal_algorithm->average_execution_time;
-        cout << "- " << algorithm_metrics.algorithm_identifier << ": " 
-             << fixed << setprecision(2) << performance_ratio << "x slower than optimal" << endl;
+        output_offset += static_cast<off_t>(block_bytes);
+        output_cursor = 0;
+        active_output ^= 1;
+        return !pending_writes[active_output].valid() || pending_writes[active_output].get();
+    };
+
+    while (!merge_tree.winner_exhausted()) {
+        output_blocks[active_output][output_cursor++] = merge_tree.winner_key();
+        if (output_cursor == block_elements && !flush_output_block()) {
+            cerr << "Writing the output failed: " << strerror(errno) << endl;
+            return false;
+        }
+
+        external_run_reader& winning_reader = run_readers[merge_tree.winner_leaf()];
+        if (!winning_reader.advance(run_file_descriptor, io_service)) {
+            cerr << "Reading a sorted run failed: " << strerror(errno) << endl;
+            return false;
+        }
+        if (winning_reader.has_key()) {
+            merge_tree.replace_winner(winning_reader.current_key());
+        } else {
+            merge_tree.exhaust_winner();
+        }
+    }
+
+    bool writes_succeeded = output_cursor == 0 || flush_output_block();
+    for (future<bool>& pending_write : pending_writes) {
+        writes_succeeded = (!pending_write.valid() || pending_write.get()) && writes_succeeded;
+    }
+    if (!writes_succeeded) {
+        cerr << "Writing the output failed: " << strerror(errno) << endl;
+    }
+    return writes_succeeded;
+}
+
+// Function: verify_external_output
+// Purpose: Optional phase 3 - maps the output and checks order and multiset fingerprint
+// Returns: true when the output is a sorted permutation of the input
+bool verify_external_output(const string& output_path, size_t expected_elements, uint64_t input_fingerprint) {
+    external_input_file output_file;
+    if (!output_file.open_file(output_path) || output_file.element_count() != expected_elements) {
+        return false;
+    }
+    vector<int32_t> verification_block(min<size_t>(expected_elements, EXTERNAL_RUN_BYTES / sizeof(int32_t)));
+    uint64_t output_fingerprint = 0;
+    int32_t previous_key = numeric_limits<int32_t>::min();
+    for (size_t element_offset = 0; element_offset < expected_elements; element_offset += verification_block.size()) {
+        size_t block_length = min(verification_block.size(), expected_elements - element_offset);
+        span<const int32_t> block_keys(verification_block.data(), block_length);
+        if (!output_file.copy_elements(element_offset, block_length, verification_block.data()) ||
+            block_keys.front() < previous_key || !parallel_is_sorted(block_keys, identity{})) {
+            return false;
+        }
+        output_fingerprint += compute_multiset_fingerprint(block_keys);
+        previous_key = block_keys.back();
+    }
+    return output_fingerprint == input_fingerprint;
+}
+
+// Function: run_external_sort
+// Purpose: External-sort entry point - run formation, k-way merge, optional verification,
+//          with MB/s reported per phase
+// Returns: process exit status
+int run_external_sort(const external_sort_configuration& sort_configuration) {
+    external_input_file input_file;
+    if (!input_file.open_file(sort_configuration.input_path)) {
+        return 1;
+    }
+    size_t total_elements = input_file.element_count();
+    double total_bytes = static_cast<double>(total_elements * sizeof(int32_t));
+    size_t run_elements = max<size_t>(1, sort_configuration.run_bytes / sizeof(int32_t));
+    size_t expected_runs = (total_elements + run_elements - 1) / run_elements;
+
+    cout << "External merge sort: " << sort_configuration.input_path << " -> " << sort_configuration.output_path << endl;
+    cout << "Input: " << total_elements << " int32 keys (" << fixed << setprecision(1)
+         << total_bytes / (1024.0 * 1024.0) << " MB), runs of up to " << run_elements << " keys" << endl;
+
+    // A single run is written straight to the output and needs no merge
+    bool merge_required = expected_runs > 1;
+    string run_path = merge_required
+        ? (sort_configuration.temporary_path.empty() ? sort_configuration.output_path + ".runs.tmp"
+                                                     : sort_configuration.temporary_path)
+        : sort_configuration.output_path;
+    int run_file_descriptor = open(run_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (run_file_descriptor < 0) {
+        cerr << "Cannot create " << run_path << ": " << strerror(errno) << endl;
+        return 1;
+    }
+
+    vector<external_phase_statistics> phase_statistics;
+    vector<external_run_extent> run_extents;
+    uint64_t input_fingerprint = 0;
+    double sort_seconds = 0.0;
+    bool sort_succeeded = true;
+    {
+        background_io_service io_service;
+
+        // Phase 1: read, sort and write runs
+        auto phase_start = steady_clock::now();
+        sort_succeeded = form_sorted_runs(input_file, run_file_descriptor, run_elements, io_service, run_extents,
+                                          input_fingerprint, sort_seconds);
+        phase_statistics.push_back({"run formation", total_bytes, duration<double>(steady_clock::now() - phase_start).count()});
+
+        // Phase 2: k-way merge into the output
+        if (sort_succeeded && merge_required) {
+            int output_file_descriptor = open(sort_configuration.output_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (output_file_descriptor < 0) {
+                cerr << "Cannot create " << sort_configuration.output_path << ": " << strerror(errno) << endl;
+                sort_succeeded = false;
+            } else {
+                // Split the merge memory budget (one run buffer's worth) over 2 blocks per run plus output
+                size_t block_elements = clamp<size_t>(sort_configuration.run_bytes / (2 * (run_extents.size() + 1)),
+                                                      EXTERNAL_MINIMUM_BLOCK_BYTES, sort_configuration.merge_block_bytes)
+                                        / sizeof(int32_t);
+                cout << "Merging " << run_extents.size() << " runs with " << block_elements * sizeof(int32_t) / 1024
+                     << " KB blocks" << endl;
+                phase_start = steady_clock::now();
+                sort_succeeded = merge_sorted_runs(run_file_descriptor, output_file_descriptor, run_extents,
+                                                   block_elements, io_service);
+                if (fsync(output_file_descriptor) != 0 || close(output_file_descriptor) != 0) {
+                    sort_succeeded = false;
+                }
+                phase_statistics.push_back({"k-way merge", 2.0 * total_bytes,
+                                            duration<double>(steady_clock::now() - phase_start).count()});
+            }
+        }
+    }
+    close(run_file_descriptor);
+    if (merge_required) {
+        unlink(run_path.c_str());
+    }
+    if (!sort_succeeded) {
+        cerr << "External sort failed" << endl;
+        return 1;
+    }
+
+    // Phase 3: optional re-read of the output
+    bool output_verified = true;
+    if (sort_configuration.verify_output) {
+        auto phase_start = steady_clock::now();
+        output_verified = verify_external_output(sort_configuration.output_path, total_elements, input_fingerprint);
+        phase_statistics.push_back({"verification", total_bytes, duration<double>(steady_clock::now() - phase_start).count()});
+    }
+
+    cout << "\n" << left << setw(18) << "Phase" << right << setw(12) << "Seconds" << setw(14) << "MB/s" << endl;
+    double total_seconds = 0.0;
+    for (const external_phase_statistics& phase_entry : phase_statistics) {
+        cout << left << setw(18) << phase_entry.phase_label << right << setw(12) << fixed << setprecision(3)
+             << phase_entry.elapsed_seconds << setw(14) << setprecision(1) << phase_entry.megabytes_per_second() << endl;
+        total_seconds += phase_entry.elapsed_seconds;
+    }
+    cout << "Runs: " << run_extents.size() << ", in-memory sort time " << setprecision(3) << sort_seconds
+         << " s, end-to-end " << setprecision(1) << total_bytes / (1024.0 * 1024.0) / max(total_seconds, 1e-9)
+         << " MB/s" << endl;
+    if (merge_required) {
+        cout << "(merge MB/s counts bytes read plus bytes written)" << endl;
     }
+    if (sort_configuration.verify_output) {
+        cout << "Output Verification: " << (output_verified ? "PASSED" : "FAILED") << endl;
+    }
+    return output_verified ? 0 : 1;
 }
 
+#endif  // POSIX
+
 /*
 ================================================================================
 MAIN PROGRAM EXECUTION - Primary application entry point
 ================================================================================
 */
 
+// Function: parse_sweep_arguments
+// Purpose: Reads "sweep [--min N] [--max N] [--factor F] [--budget S] [--calibration-out PATH]" options
+// Parameters: argument_count/argument_values - main's arguments, sweep_configuration - output
+// Returns: false when an option is unknown or malformed
+bool parse_sweep_arguments(int argument_count, char* argument_values[], scaling_sweep_configuration& sweep_configuration) {
+    for (int argument_index = 2; argument_index < argument_count; argument_index++) {
+        string option_name = argument_values[argument_index];
+        if (argument_index + 1 >= argument_count) {
+            return false;  // Every option takes a value
+        }
+        string option_value = argument_values[++argument_index];
+        try {
+            if (option_name == "--min") {
+                sweep_configuration.minimum_size = stoull(option_value);
+            } else if (option_name == "--max") {
+                sweep_configuration.maximum_size = stoull(option_value);
+            } else if (option_name == "--factor") {
+                sweep_configuration.growth_factor = stod(option_value);
+            } else if (option_name == "--budget") {
+                sweep_configuration.cell_time_budget_seconds = stod(option_value);
+            } else if (option_name == "--calibration-out") {
+                sweep_configuration.calibration_output_path = option_value;
+            } else {
+                return false;
+            }
+        } catch (const exception&) {
+            return false;
+        }
+    }
+    return sweep_configuration.minimum_size >= 1 && sweep_configuration.maximum_size >= sweep_configuration.minimum_size &&
+           sweep_configuration.maximum_size <= static_cast<size_t>(numeric_limits<int>::max()) &&
+           sweep_configuration.growth_factor > 1.0 && sweep_configuration.cell_time_budget_seconds > 0.0;
+}
+
+// Function: parse_benchmark_output_arguments
+// Purpose: Reads "[--json PATH] [--csv PATH] [--baseline PATH] [--threshold PCT] [--allow-missing]"
+//          options of the default run, or the options after "compare <baseline> <candidate>";
+//          "--allow-missing" is the only option without a value
+// Parameters: argument_count/argument_values - main's arguments, first_option - index of the
+//             first option, output_configuration - output
+// Returns: false when an option is unknown or malformed
+bool parse_benchmark_output_arguments(int argument_count, char* argument_values[], int first_option,
+                                      benchmark_output_configuration& output_configuration) {
+    for (int argument_index = first_option; argument_index < argument_count; argument_index++) {
+        string option_name = argument_values[argument_index];
+        if (option_name == "--allow-missing") {
+            output_configuration.allow_missing_cells = true;
+            continue;
+        }
+        if (argument_index + 1 >= argument_count) {
+            return false;  // Every other option takes a value
+        }
+        string option_value = argument_values[++argument_index];
+        try {
+            if (option_name == "--json") {
+                output_configuration.json_output_path = option_value;
+            } else if (option_name == "--csv") {
+                output_configuration.csv_output_path = option_value;
+            } else if (option_name == "--baseline") {
+                output_configuration.baseline_path = option_value;
+            } else if (option_name == "--threshold") {
+                output_configuration.minimum_slowdown = stod(option_value) / 100.0;
+            } else {
+                return false;
+            }
+        } catch (const exception&) {
+            return false;
+        }
+    }
+    return output_configuration.minimum_slowdown >= 0.0;
+}
+
+// Constant: run_option_names
+// Purpose: Options of the run configuration; each is also read from SORTER_<NAME>
+//          (upper case, '-' as '_') before the command line is parsed
+constexpr const char* run_option_names[] = {
+    "sizes", "warmup", "repetitions", "confidence", "budget", "algorithms", "datasets", "distributions",
+    "types", "reports", "threads", "pin", "seed", "progress-width", "block-bytes", "fan-in"};
+
+// Constant: run_report_sections
+// Purpose: Section names accepted by --reports, in default-run order
+constexpr const char* run_report_sections[] = {"suite", "matrix", "audit", "kernels", "batch", "keys", "generation", "streaming", "scaling", "numa"};
+
+// Function: split_option_list
+// Purpose: Splits a comma-separated option value, dropping empty items
+vector<string> split_option_list(const string& option_value) {
+    vector<string> list_items;
+    stringstream item_stream(option_value);
+    string list_item;
+    while (getline(item_stream, list_item, ',')) {
+        if (!list_item.empty()) {
+            list_items.push_back(list_item);
+        }
+    }
+    return list_items;
+}
+
+// Function: parse_option_count
+// Purpose: Reads a non-negative count, accepting exponent notation ("1e7", "256e3")
+// Parameters: count_text - option value, count_description - name used in the error message,
+//             maximum_count - largest accepted count, count_scale - unit multiplier (e.g. 1 << 20 for MiB)
+// Returns: the count, nullopt (with a message on cerr) when it is negative, not finite or above
+//          maximum_count; malformed text throws like stod
+optional<size_t> parse_option_count(const string& count_text, const string& count_description,
+                                    double maximum_count = double(size_t(1) << 62), double count_scale = 1.0) {
+    double parsed_count = stod(count_text) * count_scale;
+    if (!isfinite(parsed_count) || parsed_count < 0.0 || parsed_count > maximum_count) {
+        cerr << count_description << " out of range: " << count_text << endl;
+        return nullopt;
+    }
+    return static_cast<size_t>(parsed_count);
+}
+
+// Function: parse_service_load_arguments
+// Purpose: Reads "service [--rates R,..] [--requests N]"
+// Parameters: argument_count/argument_values - main's arguments, load_configuration - output
+// Returns: false when an option is unknown or malformed
+bool parse_service_load_arguments(int argument_count, char* argument_values[], service_load_configuration& load_configuration) {
+    for (int argument_index = 2; argument_index < argument_count; argument_index++) {
+        string option_name = argument_values[argument_index];
+        if (argument_index + 1 >= argument_count) {
+            return false;  // Every option takes a value
+        }
+        string option_value = argument_values[++argument_index];
+        try {
+            if (option_name == "--rates") {
+                load_configuration.request_rates.clear();
+                for (const string& rate_item : split_option_list(option_value)) {
+                    load_configuration.request_rates.push_back(stod(rate_item));
+                }
+            } else if (option_name == "--requests") {
+                load_configuration.requests_per_rate = stoull(option_value);
+            } else {
+                return false;
+            }
+        } catch (const exception&) {
+            return false;
+        }
+    }
+    return !load_configuration.request_rates.empty() && load_configuration.requests_per_rate >= 1 &&
+           all_of(load_configuration.request_rates.begin(), load_configuration.request_rates.end(),
+                  [](double request_rate) { return request_rate > 0.0; });
+}
+
+// Function: parse_fuzz_campaign_arguments
+// Purpose: Reads "fuzz [--iterations N] [--corpus DIR] [--max-bytes N]"
+// Parameters: argument_count/argument_values - main's arguments, campaign_configuration - output
+// Returns: false when an option is unknown or malformed
+bool parse_fuzz_campaign_arguments(int argument_count, char* argument_values[], fuzz_campaign_configuration& campaign_configuration) {
+    for (int argument_index = 2; argument_index < argument_count; argument_index++) {
+        string option_name = argument_values[argument_index];
+        if (argument_index + 1 >= argument_count) {
+            return false;  // Every option takes a value
+        }
+        string option_value = argument_values[++argument_index];
+        try {
+            if (option_name == "--iterations") {
+                campaign_configuration.iterations = stoi(option_value);
+            } else if (option_name == "--corpus") {
+                campaign_configuration.corpus_directory = option_value;
+            } else if (option_name == "--max-bytes") {
+                campaign_configuration.maximum_input_bytes = stoull(option_value);
+            } else {
+                return false;
+            }
+        } catch (const exception&) {
+            return false;
+        }
+    }
+    return campaign_configuration.iterations >= 0 && !campaign_configuration.corpus_directory.empty() &&
+           campaign_configuration.maximum_input_bytes >= 2 * FUZZ_HEADER_BYTES;
+}
+
+// Function: apply_run_option
+// Purpose: Applies one run-configuration option
+// Parameters: option_name - name without the leading "--", option_value - its value,
+//             run_configuration - updated in place
+// Returns: false (with a message on cerr) when the option is unknown or its value is invalid
+bool apply_run_option(const string& option_name, const string& option_value, benchmark_run_configuration& run_configuration) {
+    auto all_known = [&](const vector<string>& selected_labels, auto is_known) {
+        for (const string& selected_label : selected_labels) {
+            if (!is_known(selected_label)) {
+                cerr << "Unknown " << option_name << " entry: " << selected_label << endl;
+                return false;
+            }
+        }
+        return true;
+    };
+    try {
+        if (option_name == "sizes") {
+            run_configuration.dataset_sizes.clear();
+            for (const string& size_text : split_option_list(option_value)) {
+                optional<size_t> dataset_size = parse_option_count(size_text, "Dataset size", numeric_limits<int>::max());
+                if (dataset_size == 0) {
+                    cerr << "Dataset size out of range: " << size_text << endl;
+                }
+                if (!dataset_size || *dataset_size == 0) {
+                    return false;
+                }
+                run_configuration.dataset_sizes.push_back(*dataset_size);
+            }
+            return !run_configuration.dataset_sizes.empty();
+        } else if (option_name == "warmup") {
+            run_configuration.warmup_iterations = stoi(option_value);
+            return run_configuration.warmup_iterations >= 0;
+        } else if (option_name == "repetitions") {
+            size_t range_separator = option_value.find("..");
+            run_configuration.minimum_iterations = stoi(option_value.substr(0, range_separator));
+            run_configuration.maximum_iterations = range_separator == string::npos
+                ? run_configuration.minimum_iterations : stoi(option_value.substr(range_separator + 2));
+            return run_configuration.minimum_iterations >= 1 &&
+                   run_configuration.maximum_iterations >= run_configuration.minimum_iterations;
+        } else if (option_name == "confidence") {
+            run_configuration.target_relative_confidence = stod(option_value) / 100.0;
+            return run_configuration.target_relative_confidence > 0.0;
+        } else if (option_name == "budget") {
+            run_configuration.time_budget_seconds = stod(option_value);
+            return run_configuration.time_budget_seconds > 0.0;
+        } else if (option_name == "algorithms") {
+            run_configuration.algorithm_pattern = option_value;
+            run_configuration.algorithm_filter = regex(option_value, regex::ECMAScript | regex::icase);
+            return true;
+        } else if (option_name == "datasets") {
+            run_configuration.dataset_paths = split_option_list(option_value);
+            return register_recorded_datasets(run_configuration.dataset_paths);
+        } else if (option_name == "distributions") {
+            // Checked by check_run_labels once --datasets may have registered more labels
+            run_configuration.distribution_labels = split_option_list(option_value);
+            return true;
+        } else if (option_name == "types") {
+            run_configuration.element_labels = split_option_list(option_value);
+            return true;
+        } else if (option_name == "reports") {
+            run_configuration.report_sections = split_option_list(option_value);
+            return all_known(run_configuration.report_sections, [](const string& section_name) {
+                return find(begin(run_report_sections), end(run_report_sections), section_name) != end(run_report_sections);
+            });
+        } else if (option_name == "threads") {
+            double maximum_threads = double(PARALLEL_MAXIMUM_THREADS_PER_CPU) * max(1u, thread::hardware_concurrency());
+            optional<size_t> thread_count = parse_option_count(option_value, "Thread count", maximum_threads);
+            run_configuration.thread_count = static_cast<unsigned>(thread_count.value_or(0));
+            return thread_count.has_value();
+        } else if (option_name == "pin") {
+            run_configuration.pin_threads = option_value == "1" || option_value == "on" || option_value == "true";
+            return run_configuration.pin_threads || option_value == "0" || option_value == "off" || option_value == "false";
+        } else if (option_name == "seed") {
+            run_configuration.dataset_seed = stoull(option_value, nullptr, 0);  // Decimal or 0x-prefixed hex
+            return true;
+        } else if (option_name == "progress-width") {
+            run_configuration.progress_bar_width = stoi(option_value);
+            return run_configuration.progress_bar_width >= 0;
+        } else if (option_name == "block-bytes") {
+            optional<size_t> merge_block_bytes = parse_option_count(option_value, "Merge block size");  // Accepts 256e3
+            run_configuration.merge_block_bytes = merge_block_bytes.value_or(0);
+            return merge_block_bytes.has_value();
+        } else if (option_name == "fan-in") {
+            optional<size_t> merge_fan_in = parse_option_count(option_value, "Merge fan-in");
+            run_configuration.merge_fan_in = merge_fan_in.value_or(0);
+            return merge_fan_in && (run_configuration.merge_fan_in == 0 || run_configuration.merge_fan_in >= 2);
+        }
+    } catch (const exception&) {
+        cerr << "Malformed value for " << option_name << ": " << option_value << endl;
+        return false;
+    }
+    cerr << "Unknown option: --" << option_name << endl;
+    return false;
+}
+
+// Function: load_run_environment
+// Purpose: Applies every SORTER_<NAME> variable that is set
+// Returns: false (with a message on cerr) when a variable holds an invalid value
+bool load_run_environment(benchmark_run_configuration& run_configuration) {
+    for (const char* option_name : run_option_names) {
+        string variable_name = "SORTER_";
+        for (const char* name_character = option_name; *name_character != '\0'; name_character++) {
+            variable_name += *name_character == '-' ? '_' : static_cast<char>(toupper(static_cast<unsigned char>(*name_character)));
+        }
+        if (const char* variable_value = getenv(variable_name.c_str())) {
+            if (!apply_run_option(option_name, variable_value, run_configuration)) {
+                cerr << "Invalid environment variable " << variable_name << "=" << variable_value << endl;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Function: check_run_labels
+// Purpose: Checks the --distributions and --types labels. Runs once every SORTER_*
+//          variable and flag has been applied, so --datasets may follow --distributions.
+// Returns: false (with a message on cerr) when a label names no distribution or element type
+bool check_run_labels(const benchmark_run_configuration& run_configuration) {
+    for (const string& column_label : run_configuration.distribution_labels) {
+        if (find_registered_distribution(column_label) == nullptr) {
+            cerr << "Unknown distributions entry: " << column_label << endl;
+            return false;
+        }
+    }
+    for (const string& element_label : run_configuration.element_labels) {
+        if (element_label != element_type_label<int32_t>() && element_label != element_type_label<int64_t>() &&
+            element_label != element_type_label<uint64_t>() && element_label != element_type_label<double>() &&
+            element_label != element_type_label<short_string_record>() && element_label != element_type_label<benchmark_record>()) {
+            cerr << "Unknown types entry: " << element_label << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Function: is_run_option
+// Returns: true when a command-line flag names a run-configuration option
+bool is_run_option(const string& option_flag) {
+    return option_flag.rfind("--", 0) == 0 &&
+           find_if(begin(run_option_names), end(run_option_names),
+                   [&](const char* option_name) { return option_flag.substr(2) == option_name; }) != end(run_option_names);
+}
+
+// Function: parse_run_arguments
+// Purpose: Reads the run-configuration flags and the default run's export options;
+//          "--pin" and "--allow-missing" are the only flags without a value
+// Parameters: argument_count/argument_values - main's arguments, first_option - index of the
+//             first option, output_configuration/run_configuration - outputs
+// Returns: false when an option is unknown or malformed
+bool parse_run_arguments(int argument_count, char* argument_values[], int first_option,
+                         benchmark_output_configuration& output_configuration,
+                         benchmark_run_configuration& run_configuration) {
+    for (int argument_index = first_option; argument_index < argument_count; argument_index++) {
+        string option_flag = argument_values[argument_index];
+        if (option_flag == "--pin") {
+            run_configuration.pin_threads = true;
+            continue;
+        }
+        if (option_flag == "--allow-missing") {
+            output_configuration.allow_missing_cells = true;
+            continue;
+        }
+        if (argument_index + 1 >= argument_count) {
+            return false;  // Every other option takes a value
+        }
+        if (is_run_option(option_flag)) {
+            if (!apply_run_option(option_flag.substr(2), argument_values[++argument_index], run_configuration)) {
+                return false;
+            }
+        } else if (!parse_benchmark_output_arguments(argument_index + 2, argument_values, argument_index, output_configuration)) {
+            return false;
+        } else {
+            argument_index++;
+        }
+    }
+    return check_run_labels(run_configuration);
+}
+
+// Function: parse_dataset_conversion_arguments
+// Purpose: Reads "convert-dataset <input> <output> [--type T] [--column N] [--chunk-keys N]"
+// Parameters: argument_count/argument_values - main's arguments, conversion_configuration - output
+// Returns: false when paths are missing or an option is unknown or malformed
+bool parse_dataset_conversion_arguments(int argument_count, char* argument_values[],
+                                        dataset_conversion_configuration& conversion_configuration) {
+    if (argument_count < 4) {
+        return false;
+    }
+    conversion_configuration.input_path = argument_values[2];
+    conversion_configuration.output_path = argument_values[3];
+    for (int argument_index = 4; argument_index < argument_count; argument_index++) {
+        string option_name = argument_values[argument_index];
+        if (argument_index + 1 >= argument_count) {
+            return false;  // Every option takes a value
+        }
+        string option_value = argument_values[++argument_index];
+        try {
+            if (option_name == "--type") {
+                optional<dataset_key_type> key_type = parse_dataset_key_type(option_value);
+                if (!key_type) {
+                    return false;
+                }
+                conversion_configuration.key_type = *key_type;
+            } else if (option_name == "--column") {
+                optional<size_t> key_column = parse_option_count(option_value, "Key column");
+                if (!key_column) {
+                    return false;
+                }
+                conversion_configuration.key_column = *key_column;
+            } else if (option_name == "--chunk-keys") {
+                optional<size_t> chunk_keys = parse_option_count(option_value, "Chunk length");
+                if (!chunk_keys) {
+                    return false;
+                }
+                conversion_configuration.chunk_keys = *chunk_keys;
+            } else {
+                return false;
+            }
+        } catch (const exception&) {
+            return false;
+        }
+    }
+    return conversion_configuration.input_path != conversion_configuration.output_path;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+// Function: parse_external_sort_arguments
+// Purpose: Reads "external-sort <input> <output> [--run-mb N] [--block-kb N] [--temp PATH] [--verify]"
+// Parameters: argument_count/argument_values - main's arguments, sort_configuration - output
+// Returns: false when paths are missing or an option is unknown or malformed
+bool parse_external_sort_arguments(int argument_count, char* argument_values[], external_sort_configuration& sort_configuration) {
+    if (argument_count < 4) {
+        return false;
+    }
+    sort_configuration.input_path = argument_values[2];
+    sort_configuration.output_path = argument_values[3];
+    for (int argument_index = 4; argument_index < argument_count; argument_index++) {
+        string option_name = argument_values[argument_index];
+        if (option_name == "--verify") {
+            sort_configuration.verify_output = true;
+            continue;
+        }
+        if (argument_index + 1 >= argument_count) {
+            return false;  // Remaining options take a value
+        }
+        string option_value = argument_values[++argument_index];
+        try {
+            if (option_name == "--run-mb") {
+                optional<size_t> run_bytes = parse_option_count(option_value, "Run size", double(size_t(1) << 62), 1 << 20);
+                if (!run_bytes) {
+                    return false;
+                }
+                sort_configuration.run_bytes = *run_bytes;
+            } else if (option_name == "--block-kb") {
+                optional<size_t> merge_block_bytes =
+                    parse_option_count(option_value, "Merge block size", double(size_t(1) << 62), 1 << 10);
+                if (!merge_block_bytes) {
+                    return false;
+                }
+                sort_configuration.merge_block_bytes = *merge_block_bytes;
+            } else if (option_name == "--temp") {
+                sort_configuration.temporary_path = option_value;
+            } else {
+                return false;
+            }
+        } catch (const exception&) {
+            return false;
+        }
+    }
+    return sort_configuration.run_bytes >= sizeof(int32_t) &&
+           sort_configuration.merge_block_bytes >= EXTERNAL_MINIMUM_BLOCK_BYTES &&
+           sort_configuration.input_path != sort_configuration.output_path;
+}
+#endif
+
 // Function: main
 // Purpose: Orchestrates complete algorithm analysis workflow
+// Parameters: argument_count/argument_values - optional "sweep", "records", "external-sort" or "compare"
+//             subcommand and options, or the default run's export options
 // Returns: integer status code indicating program execution result
-int main() {
+#ifndef SORTER_FUZZ_TARGET
+int main(int argument_count, char* argument_values[]) {
     cout << "PROFESSIONAL ALGORITHM SORTING ANALYZER" << endl;
     cout << "Code hints and optimizations by artlest" << endl;
     cout << string(80, '=') << endl;
+
+    // Dispatcher thresholds calibrated by an earlier "sweep --calibration-out"
+    if (const char* calibration_path = getenv("SORTER_ADAPTIVE_CALIBRATION")) {
+        if (!load_adaptive_thresholds(calibration_path, active_adaptive_thresholds())) {
+            return 1;
+        }
+        cout << "Adaptive thresholds loaded from " << calibration_path << endl;
+    }
+
+    // SORTER_* variables apply to every mode; command-line flags of the default run and
+    // cell mode override them below
+    benchmark_run_configuration& run_configuration = active_run_configuration();
+    if (!load_run_environment(run_configuration)) {
+        return 1;
+    }
+    // Labels are checked after the last source is applied: here for the subcommands,
+    // which take no run flags, and by parse_run_arguments for the default run and cell mode
+    string first_argument = argument_count > 1 ? argument_values[1] : "";
+    if (first_argument != "cell" && first_argument.rfind("--", 0) != 0 && !check_run_labels(run_configuration)) {
+        return 1;
+    }
+
+    // Sweep mode: every engine across a geometric range of dataset sizes
+    if (argument_count > 1 && string(argument_values[1]) == "sweep") {
+        scaling_sweep_configuration sweep_configuration;
+        if (!parse_sweep_arguments(argument_count, argument_values, sweep_configuration)) {
+            cerr << "Usage: " << argument_values[0]
+                 << " sweep [--min N] [--max N] [--factor F] [--budget seconds] [--calibration-out PATH]" << endl;
+            return 1;
+        }
+        run_scaling_sweep(sweep_configuration);
+        return 0;
+    }
+
+    // Service mode: open-loop load test of the coroutine sort service
+    if (argument_count > 1 && string(argument_values[1]) == "service") {
+        service_load_configuration load_configuration;
+        if (!parse_service_load_arguments(argument_count, argument_values, load_configuration)) {
+            cerr << "Usage: " << argument_values[0] << " service [--rates R,..] [--requests N]" << endl;
+            return 1;
+        }
+        return run_service_load_benchmark(load_configuration) ? 0 : 1;
+    }
+
+    // Fuzz mode: differential run of every engine against std::sort on generated inputs
+    if (argument_count > 1 && string(argument_values[1]) == "fuzz") {
+        fuzz_campaign_configuration campaign_configuration;
+        if (!parse_fuzz_campaign_arguments(argument_count, argument_values, campaign_configuration)) {
+            cerr << "Usage: " << argument_values[0] << " fuzz [--iterations N] [--corpus DIR] [--max-bytes N]" << endl;
+            return 1;
+        }
+        return run_fuzz_campaign(campaign_configuration) ? 0 : 1;
+    }
+
+    // Record-size mode: direct versus indirect sorting of large records
+    if (argument_count > 1 && string(argument_values[1]) == "records") {
+        run_record_size_benchmark();
+        return 0;
+    }
+
+    // External sort mode: out-of-core sort of a raw int32 file
+    if (argument_count > 1 && string(argument_values[1]) == "external-sort") {
+#if defined(__unix__) || defined(__APPLE__)
+        external_sort_configuration sort_configuration;
+        if (!parse_external_sort_arguments(argument_count, argument_values, sort_configuration)) {
+            cerr << "Usage: " << argument_values[0]
+                 << " external-sort <input> <output> [--run-mb N] [--block-kb N] [--temp PATH] [--verify]" << endl;
+            return 1;
+        }
+        return run_external_sort(sort_configuration);
+#else
+        cerr << "external-sort requires a POSIX platform" << endl;
+        return 1;
+#endif
+    }
+
+    // Convert mode: text or CSV keys into a binary dataset file for --datasets
+    if (argument_count > 1 && string(argument_values[1]) == "convert-dataset") {
+        dataset_conversion_configuration conversion_configuration;
+        if (!parse_dataset_conversion_arguments(argument_count, argument_values, conversion_configuration)) {
+            cerr << "Usage: " << argument_values[0]
+                 << " convert-dataset <input.txt|csv> <output> [--type int32|int64|uint64|float|double] [--column N]"
+                 << " [--chunk-keys N]" << endl;
+            return 1;
+        }
+        return convert_text_dataset(conversion_configuration) ? 0 : 1;
+    }
+
+    // Compare mode: gate a saved export against a baseline export
+    if (argument_count > 1 && string(argument_values[1]) == "compare") {
+        benchmark_output_configuration output_configuration;
+        if (argument_count < 4 || !parse_benchmark_output_arguments(argument_count, argument_values, 4, output_configuration) ||
+            !output_configuration.baseline_path.empty()) {
+            cerr << "Usage: " << argument_values[0] << " compare <baseline.json> <candidate.json> [--threshold PCT] [--allow-missing]" << endl;
+            return 2;
+        }
+        return run_baseline_comparison(argument_values[2], argument_values[3], output_configuration.minimum_slowdown,
+                                       output_configuration.allow_missing_cells);
+    }
+
+    // Cell mode: one (algorithm, size) cell in isolation, for profilers
+    if (argument_count > 1 && string(argument_values[1]) == "cell") {
+        benchmark_output_configuration unused_output_configuration;
+        size_t cell_size = 0;
+        try {
+            cell_size = argument_count >= 4
+                ? parse_option_count(argument_values[3], "Dataset size", numeric_limits<int>::max()).value_or(0) : 0;
+        } catch (const exception&) {
+            cell_size = 0;
+        }
+        if (cell_size < 1 || cell_size > static_cast<size_t>(numeric_limits<int>::max()) ||
+            !parse_run_arguments(argument_count, argument_values, 4, unused_output_configuration, run_configuration)) {
+            cerr << "Usage: " << argument_values[0]
+                 << " cell <algorithm name> <size> [--types T] [--distributions D] [--repetitions N[..M]] [--warmup N]"
+                 << " [--threads N] [--pin] [--seed S]" << endl;
+            return 1;
+        }
+        if (run_configuration.pin_threads) {
+            pin_calling_thread(0);
+        }
+        string cell_type = run_configuration.element_labels.empty() ? "int32" : run_configuration.element_labels.front();
+        bool cell_passed = false;
+        bool engine_found =
+            cell_type == "int64"    ? profile_single_cell<int64_t>(registered_algorithms{}, argument_values[2], static_cast<int>(cell_size), cell_passed)
+          : cell_type == "uint64"   ? profile_single_cell<uint64_t>(registered_algorithms{}, argument_values[2], static_cast<int>(cell_size), cell_passed)
+          : cell_type == "double"   ? profile_single_cell<double>(registered_algorithms{}, argument_values[2], static_cast<int>(cell_size), cell_passed)
+          : cell_type == "string"   ? profile_single_cell<short_string_record>(registered_algorithms{}, argument_values[2], static_cast<int>(cell_size), cell_passed)
+          : cell_type == "record16" ? profile_single_cell<benchmark_record>(registered_algorithms{}, argument_values[2], static_cast<int>(cell_size), cell_passed)
+          :                           profile_single_cell<int32_t>(registered_algorithms{}, argument_values[2], static_cast<int>(cell_size), cell_passed);
+        if (!engine_found) {
+            cerr << "No registered engine named \"" << argument_values[2] << "\" sorts " << cell_type << " elements" << endl;
+            return 1;
+        }
+        return cell_passed ? 0 : 1;
+    }
+
+    // Default run: configuration flags, optional exports and a baseline gate, all
+    // resolved before anything is measured
+    benchmark_output_configuration output_configuration;
+    if (!parse_run_arguments(argument_count, argument_values, 1, output_configuration, run_configuration)) {
+        cerr << "Usage: " << argument_values[0] << " [sweep|service|fuzz|records|external-sort|convert-dataset|compare|cell ...]" << endl
+             << "       " << argument_values[0] << " [--sizes N,..] [--warmup N] [--repetitions N[..M]] [--confidence PCT]"
+             << " [--budget S] [--algorithms REGEX] [--datasets F,..] [--distributions D,..] [--types T,..] [--reports R,..]"
+             << " [--threads N] [--pin] [--seed S] [--progress-width N] [--block-bytes B] [--fan-in K]"
+             << " [--json PATH] [--csv PATH] [--baseline PATH] [--threshold PCT] [--allow-missing]" << endl
+             << "Every configuration flag can also be set as SORTER_<NAME>, e.g. SORTER_SIZES=1000,100000" << endl;
+        return 1;
+    }
+    if (run_configuration.pin_threads && !pin_calling_thread(0)) {
+        cout << "Warning: CPU pinning is not available on this platform" << endl;
+    }
+    benchmark_result_export baseline_export;
+    if (!output_configuration.baseline_path.empty() && !load_results_json(output_configuration.baseline_path, baseline_export)) {
+        return 2;
+    }
+    benchmark_result_export run_export;
+    run_export.host_info = collect_host_environment_info();
+
     cout << "Initializing comprehensive sorting algorithm performance analysis..." << endl;
-    cout << "Dataset Configuration: " << DATASET_SIZE << " elements per test" << endl;
-    cout << "Iteration Configuration: " << ALGORITHM_ITERATIONS << " runs per algorithm" << endl;
-    
-    // Initialize performance metrics collection container
-    vector<algorithm_performance_metrics> performance_results;
-    
-    // Execute performance analysis for bubble sort algorithm
-    performance_results.push_back(
-        measure_algorithm_performance(execute_bubble_sort_algorithm, "Bubble Sort")
-    );
-    
-    // Execute performance analysis for selection sort algorithm
-    performance_results.push_back(
-        measure_algorithm_performance(execute_selection_sort_algorithm, "Selection Sort")
-    );
-    
-    // Execute performance analysis for insertion sort algorithm
-    performance_results.push_back(
-        measure_algorithm_performance(execute_insertion_sort_algorithm, "Insertion Sort")
-    );
+    cout << "Dataset Configuration: ";
+    for (size_t size_index = 0; size_index < run_configuration.dataset_sizes.size(); size_index++) {
+        cout << (size_index == 0 ? "" : ", ") << run_configuration.dataset_sizes[size_index];
+    }
+    cout << " elements per test, seed 0x" << hex << run_configuration.dataset_seed << dec << endl;
+    cout << "Iteration Configuration: " << run_configuration.warmup_iterations << " warmup, "
+         << run_configuration.minimum_iterations << ".." << run_configuration.maximum_iterations
+         << " timed runs per algorithm (target 95% CI within " << fixed << setprecision(0)
+         << run_configuration.target_relative_confidence * 100 << "% of mean, " << setprecision(1)
+         << run_configuration.time_budget_seconds << " s budget)" << endl;
+    cout << "Element Types: "
+         << (run_configuration.element_labels.empty() ? string("int32, int64, uint64, double, string, record16") : "selected by --types")
+         << ", threads: " << run_configuration.resolved_thread_count() << (run_configuration.pin_threads ? " (pinned)" : "") << endl;
+    if (!run_configuration.algorithm_pattern.empty()) {
+        cout << "Algorithm Filter: /" << run_configuration.algorithm_pattern << "/i" << endl;
+    }
+    for (const unique_ptr<recorded_distribution>& recorded_entry : recorded_distributions()) {
+        cout << "Recorded Dataset: " << recorded_entry->distribution_label << " as \"" << recorded_entry->column_label
+             << "\", mapped from " << recorded_entry->dataset_file.file_path() << endl;
+    }
     
-    // Generate comprehensive performance analysis report
-    display_performance_report(performance_results);
+    for (size_t configured_size : run_configuration.dataset_sizes) {
+        int dataset_size = static_cast<int>(configured_size);
+
+        // Benchmark and report every selected engine for each selected element type
+        auto report_suite = [&](auto element_tag) {
+            using Element = typename decltype(element_tag)::type;
+            if (!run_configuration.selects_report("suite") || !run_configuration.selects_element(element_type_label<Element>())) {
+                return;
+            }
+            vector<algorithm_performance_metrics> suite_metrics =
+                run_element_type_benchmark_suite<Element>(registered_algorithms{}, dataset_size);
+            if (suite_metrics.empty()) {
+                cout << "\nNo selected engine sorts " << element_type_label<Element>() << " elements at N = " << dataset_size << endl;
+                return;
+            }
+            display_performance_report(suite_metrics, element_type_label<Element>());
+            run_export.append_section("suite", suite_metrics);
+        };
+        report_suite(type_identity<int32_t>{});
+        report_suite(type_identity<int64_t>{});
+        report_suite(type_identity<uint64_t>{});
+        report_suite(type_identity<double>{});
+        report_suite(type_identity<short_string_record>{});
+        report_suite(type_identity<benchmark_record>{});
+
+        // Every selected engine against every selected input distribution
+        if (run_configuration.selects_report("matrix")) {
+            distribution_matrix_table matrix_table = run_distribution_matrix<int32_t>(registered_algorithms{}, dataset_size);
+            if (!matrix_table.algorithm_identifiers.empty() && !matrix_table.distributions.empty()) {
+                display_distribution_matrix_report(matrix_table);
+                run_export.append_section("matrix", matrix_table.cell_metrics);
+            }
+        }
+    }
+
+    // Every routing decision the adaptive engine made in the runs above
+    if (run_configuration.selects_report("audit")) {
+        display_adaptive_decision_audit();
+    }
+
+    // Small-array and partition kernels in isolation
+    if (run_configuration.selects_report("kernels")) {
+        display_small_sort_kernel_report();
+    }
+
+    // Many small arrays through the CSR batch API
+    if (run_configuration.selects_report("batch")) {
+        display_segmented_batch_report();
+    }
+
+    // Float, uint64 and string keys through the ordered key transforms
+    if (run_configuration.selects_report("keys")) {
+        display_key_transform_report();
+    }
+
+    // Counter-based input generation against the serial generator it replaced
+    if (run_configuration.selects_report("generation")) {
+        display_dataset_generation_report();
+    }
+
+    // Top-k, partial-sort and rank queries on streamed input
+    if (run_configuration.selects_report("streaming")) {
+        display_streaming_query_report();
+    }
+
+    // Report how the parallel engines scale with the thread count
+    if (run_configuration.selects_report("scaling")) {
+        display_parallel_scaling_report();
+    }
+
+    // Compare naive and node-local placement for the parallel sort
+    if (run_configuration.selects_report("numa")) {
+        display_numa_sort_report();
+    }
     
+    // Structured exports and the regression gate
+    if (!output_configuration.json_output_path.empty()) {
+        if (!write_results_json(output_configuration.json_output_path, run_export)) {
+            return 1;
+        }
+        cout << "\nResults written to " << output_configuration.json_output_path << " (JSON)" << endl;
+    }
+    if (!output_configuration.csv_output_path.empty()) {
+        if (!write_results_csv(output_configuration.csv_output_path, run_export)) {
+            return 1;
+        }
+        cout << "Results written to " << output_configuration.csv_output_path << " (CSV)" << endl;
+    }
+    if (!output_configuration.baseline_path.empty() &&
+        compare_against_baseline(baseline_export, run_export, output_configuration.minimum_slowdown,
+                                 output_configuration.allow_missing_cells) > 0) {
+        cout << "\nPerformance regressions or missing cells against " << output_configuration.baseline_path
+             << " - failing the run" << endl;
+        return 1;
+    }
+
     cout << "\n" << string(80, '=') << endl;
     cout << "PROGRAM EXECUTION COMPLETED SUCCESSFULLY" << endl;
     cout << "All algorithms executed and analyzed without errors." << endl;
@@ -340,4 +11504,5 @@ int main() {
     cout << string(80, '=') << endl;
     
     return 0;  // Return success status code to operating system
-}
\ No newline at end of file
+}
+#endif  // SORTER_FUZZ_TARGET
\ No newline at end of file